@@ -0,0 +1,502 @@
+#include "AsyncFileWriter.h"
+#include <iostream>
+#include <cstring>
+#include <algorithm>
+#include <new>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace px {
+
+/* Unbuffered I/O needs sector aligned buffers, offsets and lengths. */
+const static std::size_t DIRECT_ALIGNMENT = 4096;
+
+/* The flush thread is woken once this much data is waiting (or on its poll period). */
+const static std::size_t WAKE_THRESHOLD = 256 << 10;
+const static std::chrono::milliseconds FLUSH_POLL_PERIOD(10);
+
+typedef std::chrono::duration<double, std::milli> Milliseconds;
+
+AsyncFileWriter::AsyncFileWriter(std::size_t memory_limit, FileSyncPolicy policy, FileOverflowPolicy overflow) {
+	std::size_t blocks = std::max<std::size_t>((memory_limit + DIRECT_ALIGNMENT - 1) / DIRECT_ALIGNMENT, 1);
+	this->capacity = blocks * DIRECT_ALIGNMENT;
+	this->ring = static_cast<uint8_t*>(::operator new(this->capacity, std::align_val_t(DIRECT_ALIGNMENT)));
+	this->policy = policy;
+	this->sync_interval = std::chrono::milliseconds(1000);
+	this->bDirect = false;
+	this->overflow = overflow;
+	this->pending = 0;
+	this->bInFrame = false;
+	this->bDropping = false;
+	this->peak_buffered = 0;
+	this->dropped_frames = 0;
+	this->dropped_bytes = 0;
+	this->committed = 0;
+	this->consumed = 0;
+	this->status = FILE_OK;
+	this->bOpen = false;
+	this->bStop = false;
+	this->bFlushRequested = false;
+	this->max_stall_ms = 0.0;
+#ifdef _WIN32
+	this->file_handle = INVALID_HANDLE_VALUE;
+#else
+	this->file_descriptor = -1;
+#endif
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+	this->close();
+	::operator delete(this->ring, std::align_val_t(DIRECT_ALIGNMENT));
+}
+
+/* Appending to a file of arbitrary length breaks the alignment that direct
+ * writes need, so appends use cached writes.
+ */
+bool AsyncFileWriter::open(const std::string& filename, bool append) {
+	if ( this->bOpen ) this->close();
+
+	this->bDirect = (this->policy == SYNC_DIRECT) && (append == false);
+	if ( this->openFile(filename, append, this->bDirect) == false ) {
+		if ( this->bDirect == false ) return false;
+
+		std::cerr << "[AsyncFileWriter:open] Warning: Unbuffered writes not available, using synced writes: " << filename << std::endl;
+		this->bDirect = false;
+		if ( this->openFile(filename, append, false) == false ) return false;
+	}
+
+	this->filename = filename;
+	this->pending = 0;
+	this->bInFrame = false;
+	this->bDropping = false;
+	this->peak_buffered = 0;
+	this->dropped_frames = 0;
+	this->dropped_bytes = 0;
+	this->committed = 0;
+	this->consumed = 0;
+	this->status = FILE_OK;
+	this->max_stall_ms = 0.0;
+	this->bStop = false;
+	this->bFlushRequested = false;
+	this->bOpen = true;
+	this->flusher = std::thread(&AsyncFileWriter::flushLoop, this);
+	return true;
+}
+
+bool AsyncFileWriter::close() {
+	if ( this->bOpen == false ) return false;
+	if ( this->bInFrame ) this->endFrame();
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->bStop = true;
+	}
+
+	this->wake.notify_one();
+	if ( this->flusher.joinable() ) this->flusher.join();
+
+	if ( this->bDirect ) this->finishDirect();
+	if ( this->policy != SYNC_NONE ) this->syncFile();
+	this->closeFile();
+	this->bOpen = false;
+	return this->status == FILE_OK;
+}
+
+bool AsyncFileWriter::isOpen() const {
+	return this->bOpen;
+}
+
+/* Direct writes can only move whole blocks, so up to one block may stay
+ * buffered until close().
+ */
+bool AsyncFileWriter::flush() {
+	if ( this->bOpen == false ) return false;
+
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->bFlushRequested = true;
+	this->wake.notify_one();
+
+	std::size_t residue = this->bDirect ? DIRECT_ALIGNMENT : 1;
+	this->flushed.wait(lock, [this, residue]() {
+		return this->committed.load() - this->consumed.load() < residue || this->status != FILE_OK;
+	});
+
+	return this->status == FILE_OK;
+}
+
+uint64_t AsyncFileWriter::tell() const {
+	return this->pending;
+}
+
+bool AsyncFileWriter::beginFrame() {
+	if ( this->bInFrame ) return false;
+	this->bInFrame = true;
+	this->bDropping = false;
+	return true;
+}
+
+/* Returns false if the frame was dropped. */
+bool AsyncFileWriter::endFrame() {
+	if ( this->bInFrame == false ) return false;
+	this->bInFrame = false;
+
+	if ( this->bDropping ) {
+		this->bDropping = false;
+		return false;
+	}
+
+	return this->commit();
+}
+
+bool AsyncFileWriter::writeFrame(const void* data, std::size_t length) {
+	if ( this->beginFrame() == false ) return false;
+	this->writeBytes(data, length);
+	return this->endFrame();
+}
+
+bool AsyncFileWriter::writeBytes(const void* data, std::size_t length) {
+	if ( this->bOpen == false ) return false;
+	if ( this->status != FILE_OK ) return false;
+	if ( this->bDropping ) return false;
+
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+	if ( this->overflow == OVERFLOW_BLOCK ) return this->writeBlocking(bytes, length);
+
+	uint64_t buffered = this->pending - this->consumed.load(std::memory_order_acquire);
+	if ( length > this->capacity - buffered ) return this->drop(length);
+
+	this->copy(bytes, length);
+	if ( this->bInFrame == false ) return this->commit();
+	return true;
+}
+
+/* Appends to the ring, the caller checked that the data fits. */
+bool AsyncFileWriter::copy(const uint8_t* data, std::size_t length) {
+	uint64_t buffered = this->pending - this->consumed.load(std::memory_order_acquire);
+	std::size_t offset = static_cast<std::size_t>(this->pending % this->capacity);
+	std::size_t first = std::min(length, this->capacity - offset);
+	std::memcpy(this->ring + offset, data, first);
+	if ( first < length ) std::memcpy(this->ring, data + first, length - first);
+
+	this->pending += length;
+	this->peak_buffered = std::max(this->peak_buffered, static_cast<std::size_t>(buffered + length));
+	return true;
+}
+
+/* Nothing is dropped in blocking mode, so the part of a write that fits is
+ * published right away (even inside a frame) and the rest waits for the
+ * flush thread to make room; writes may be larger than the ring.
+ */
+bool AsyncFileWriter::writeBlocking(const uint8_t* data, std::size_t length) {
+	while ( length != 0 ) {
+		uint64_t buffered = this->pending - this->consumed.load(std::memory_order_acquire);
+		std::size_t space = static_cast<std::size_t>(this->capacity - buffered);
+
+		if ( space == 0 ) {
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->committed.store(this->pending, std::memory_order_release);
+			this->bFlushRequested = true;
+			this->wake.notify_one();
+			this->flushed.wait(lock, [this]() {
+				return this->pending - this->consumed.load() < this->capacity || this->status != FILE_OK;
+			});
+
+			if ( this->status != FILE_OK ) return false;
+			continue;
+		}
+
+		std::size_t chunk = std::min(length, space);
+		this->copy(data, chunk);
+		data += chunk;
+		length -= chunk;
+	}
+
+	if ( this->bInFrame == false ) return this->commit();
+	return true;
+}
+
+bool AsyncFileWriter::writeUInt32(uint32_t value) {
+	return this->write(value);
+}
+
+bool AsyncFileWriter::writeUInt64(uint64_t value) {
+	return this->write(value);
+}
+
+bool AsyncFileWriter::writeFloat(float value) {
+	return this->write(value);
+}
+
+/* Publishes the pending bytes to the flush thread. */
+bool AsyncFileWriter::commit() {
+	this->committed.store(this->pending, std::memory_order_release);
+	if ( this->pending - this->consumed.load(std::memory_order_relaxed) >= WAKE_THRESHOLD ) this->wake.notify_one();
+	return true;
+}
+
+/* Discards the current frame (everything written since beginFrame). */
+bool AsyncFileWriter::drop(std::size_t length) {
+	uint64_t committed = this->committed.load(std::memory_order_relaxed);
+	this->dropped_bytes += (this->pending - committed) + length;
+	this->dropped_frames++;
+	this->pending = committed;
+	if ( this->bInFrame ) this->bDropping = true;
+	return false;
+}
+
+void AsyncFileWriter::flushLoop() {
+	auto last_sync = std::chrono::steady_clock::now();
+
+	while ( true ) {
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->wake.wait_for(lock, FLUSH_POLL_PERIOD, [this]() {
+				return this->bStop || this->bFlushRequested || this->committed.load() - this->consumed.load() >= WAKE_THRESHOLD;
+			});
+			this->bFlushRequested = false;
+		}
+
+		bool bStopping = this->bStop;
+		bool bWritten = this->drain();
+
+		// SYNC_DIRECT without unbuffered writes (see open) syncs like SYNC_DATA.
+		bool bSync = this->policy == SYNC_DATA || (this->policy == SYNC_DIRECT && this->bDirect == false);
+		if ( bSync && bWritten && std::chrono::steady_clock::now() - last_sync >= this->sync_interval ) {
+			this->syncFile();
+			last_sync = std::chrono::steady_clock::now();
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->flushed.notify_all();
+		}
+
+		if ( bStopping ) break;
+	}
+}
+
+/* Writes the committed bytes. Direct writes move whole blocks only (the
+ * rest is written on close). After a write error the data is discarded so
+ * the producer keeps running; the error is kept in the status.
+ */
+bool AsyncFileWriter::drain() {
+	uint64_t start = this->consumed.load(std::memory_order_relaxed);
+	uint64_t end = this->committed.load(std::memory_order_acquire);
+	if ( this->bDirect ) end = start + ((end - start) / DIRECT_ALIGNMENT) * DIRECT_ALIGNMENT;
+	if ( end == start ) return false;
+
+	while ( start < end ) {
+		std::size_t offset = static_cast<std::size_t>(start % this->capacity);
+		std::size_t length = static_cast<std::size_t>(std::min<uint64_t>(end - start, this->capacity - offset));
+
+		if ( this->status == FILE_OK && this->writeFile(this->ring + offset, length) == false ) this->fail(FILE_WRITE_ERROR);
+		start += length;
+		this->consumed.store(start, std::memory_order_release);
+	}
+
+	return true;
+}
+
+bool AsyncFileWriter::setSyncInterval(std::chrono::milliseconds interval) {
+	this->sync_interval = interval;
+	return true;
+}
+
+FileSyncPolicy AsyncFileWriter::getSyncPolicy() const {
+	return this->policy;
+}
+
+bool AsyncFileWriter::setOverflowPolicy(FileOverflowPolicy overflow) {
+	if ( this->bInFrame ) return false;
+	this->overflow = overflow;
+	return true;
+}
+
+FileOverflowPolicy AsyncFileWriter::getOverflowPolicy() const {
+	return this->overflow;
+}
+
+FileStatus AsyncFileWriter::getStatus() const {
+	return static_cast<FileStatus>(this->status.load());
+}
+
+std::size_t AsyncFileWriter::getMemoryLimit() const {
+	return this->capacity;
+}
+
+std::size_t AsyncFileWriter::getBufferedBytes() const {
+	return static_cast<std::size_t>(this->pending - this->consumed.load());
+}
+
+std::size_t AsyncFileWriter::getPeakBufferedBytes() const {
+	return this->peak_buffered;
+}
+
+uint64_t AsyncFileWriter::getWrittenBytes() const {
+	return this->consumed.load();
+}
+
+std::size_t AsyncFileWriter::getDroppedFrames() const {
+	return this->dropped_frames;
+}
+
+uint64_t AsyncFileWriter::getDroppedBytes() const {
+	return this->dropped_bytes;
+}
+
+double AsyncFileWriter::getMaxStallMs() const {
+	return this->max_stall_ms.load();
+}
+
+/* Only the flush thread (or close, after it has stopped) writes the stall. */
+bool AsyncFileWriter::updateStall(std::chrono::steady_clock::time_point start) {
+	double stall = Milliseconds(std::chrono::steady_clock::now() - start).count();
+	if ( stall > this->max_stall_ms.load() ) this->max_stall_ms = stall;
+	return true;
+}
+
+bool AsyncFileWriter::fail(FileStatus status) {
+	int expected = FILE_OK;
+	this->status.compare_exchange_strong(expected, static_cast<int>(status));
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->flushed.notify_all();
+	return false;
+}
+
+#ifdef _WIN32
+bool AsyncFileWriter::openFile(const std::string& filename, bool append, bool bDirect) {
+	DWORD flags = FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN;
+	if ( bDirect ) flags |= FILE_FLAG_NO_BUFFERING | FILE_FLAG_WRITE_THROUGH;
+
+	HANDLE file = CreateFileA(filename.c_str(), GENERIC_WRITE, FILE_SHARE_READ, nullptr, append ? OPEN_ALWAYS : CREATE_ALWAYS, flags, nullptr);
+	if ( file == INVALID_HANDLE_VALUE ) {
+		std::cerr << "[AsyncFileWriter:open] Error: Could not open (" << GetLastError() << "): " << filename << std::endl;
+		return false;
+	}
+
+	if ( append ) SetFilePointer(file, 0, nullptr, FILE_END);
+	this->file_handle = file;
+	return true;
+}
+
+bool AsyncFileWriter::closeFile() {
+	if ( this->file_handle == INVALID_HANDLE_VALUE ) return false;
+	CloseHandle(this->file_handle);
+	this->file_handle = INVALID_HANDLE_VALUE;
+	return true;
+}
+
+bool AsyncFileWriter::writeFile(const uint8_t* data, std::size_t length) {
+	auto start = std::chrono::steady_clock::now();
+
+	while ( length != 0 ) {
+		DWORD chunk = static_cast<DWORD>(std::min<std::size_t>(length, 1u << 30));
+		DWORD written = 0;
+		if ( WriteFile(this->file_handle, data, chunk, &written, nullptr) == FALSE || written == 0 ) return false;
+		data += written;
+		length -= written;
+	}
+
+	return this->updateStall(start);
+}
+
+bool AsyncFileWriter::syncFile() {
+	if ( this->file_handle == INVALID_HANDLE_VALUE ) return false;
+	auto start = std::chrono::steady_clock::now();
+	bool bSynced = FlushFileBuffers(this->file_handle) != FALSE;
+	this->updateStall(start);
+	return bSynced;
+}
+
+/* The unbuffered handle can only write whole blocks; the tail goes through
+ * a regular handle.
+ */
+bool AsyncFileWriter::finishDirect() {
+	uint64_t start = this->consumed.load();
+	uint64_t end = this->committed.load();
+	if ( end == start ) return true;
+
+	this->closeFile();
+	if ( this->openFile(this->filename, true, false) == false ) return this->fail(FILE_WRITE_ERROR);
+	this->bDirect = false;
+	this->drain();
+	return this->status == FILE_OK;
+}
+#else
+bool AsyncFileWriter::openFile(const std::string& filename, bool append, bool bDirect) {
+	int flags = O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC);
+#ifdef O_DIRECT
+	if ( bDirect ) flags |= O_DIRECT;
+#else
+	if ( bDirect ) return false;
+#endif
+
+	int descriptor = ::open(filename.c_str(), flags, 0644);
+	if ( descriptor < 0 ) {
+		if ( bDirect == false ) std::cerr << "[AsyncFileWriter:open] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	this->file_descriptor = descriptor;
+	return true;
+}
+
+bool AsyncFileWriter::closeFile() {
+	if ( this->file_descriptor < 0 ) return false;
+	::close(this->file_descriptor);
+	this->file_descriptor = -1;
+	return true;
+}
+
+bool AsyncFileWriter::writeFile(const uint8_t* data, std::size_t length) {
+	auto start = std::chrono::steady_clock::now();
+
+	while ( length != 0 ) {
+		ssize_t written = ::write(this->file_descriptor, data, length);
+		if ( written < 0 && errno == EINTR ) continue;
+		if ( written <= 0 ) return false;
+		data += written;
+		length -= static_cast<std::size_t>(written);
+	}
+
+	return this->updateStall(start);
+}
+
+bool AsyncFileWriter::syncFile() {
+	if ( this->file_descriptor < 0 ) return false;
+	auto start = std::chrono::steady_clock::now();
+#if defined(__APPLE__)
+	bool bSynced = ::fsync(this->file_descriptor) == 0;
+#else
+	bool bSynced = ::fdatasync(this->file_descriptor) == 0;
+#endif
+	this->updateStall(start);
+	return bSynced;
+}
+
+/* O_DIRECT can only write whole blocks; it is cleared for the tail. */
+bool AsyncFileWriter::finishDirect() {
+#ifdef O_DIRECT
+	int flags = ::fcntl(this->file_descriptor, F_GETFL);
+	if ( flags < 0 || ::fcntl(this->file_descriptor, F_SETFL, flags & ~O_DIRECT) < 0 ) return this->fail(FILE_WRITE_ERROR);
+#endif
+	this->bDirect = false;
+	this->drain();
+	return this->status == FILE_OK;
+}
+#endif
+
+}
@@ -0,0 +1,187 @@
+#ifndef PX_ASYNC_FILE_WRITER_H
+#define PX_ASYNC_FILE_WRITER_H
+
+#include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <condition_variable>
+#include "Span.h"
+#include "FileStatus.h"
+
+namespace px {
+
+/* How the flush thread hands data to the disk.
+ * SYNC_NONE: plain writes, the OS writes the page cache back when it likes.
+ * SYNC_DATA: plain writes plus fdatasync / FlushFileBuffers every sync interval.
+ * SYNC_DIRECT: bypass the page cache (O_DIRECT / FILE_FLAG_NO_BUFFERING),
+ *              synced on close. Falls back to SYNC_DATA where unsupported.
+ */
+enum FileSyncPolicy {
+	SYNC_NONE,
+	SYNC_DATA,
+	SYNC_DIRECT
+};
+
+/* What a write does when the buffer is full.
+ * OVERFLOW_DROP: the frame is dropped and counted, the writing thread never blocks.
+ * OVERFLOW_BLOCK: the write waits for the flush thread (lossless back-pressure,
+ *                 for offline writers such as transcoding).
+ */
+enum FileOverflowPolicy {
+	OVERFLOW_DROP,
+	OVERFLOW_BLOCK
+};
+
+/* File writer for continuous capture that never blocks the writing thread.
+ *
+ * Writes are copied into a ring buffer of fixed size (the memory limit) and
+ * a dedicated flush thread moves them to the file, so disk stalls only
+ * fill the ring. When a write does not fit, its frame is dropped as a whole
+ * and counted (OVERFLOW_DROP) or the write waits for room (OVERFLOW_BLOCK);
+ * memory use never grows past the limit.
+ *
+ * A frame is the data between beginFrame() and endFrame() (or a single
+ * write outside of a frame); it is written completely or not at all, and
+ * tell() only advances for frames that were kept, so offsets recorded by
+ * the caller stay valid. One producer thread only.
+ */
+class AsyncFileWriter {
+public:
+	AsyncFileWriter(std::size_t memory_limit = 64 << 20, FileSyncPolicy policy = SYNC_NONE, FileOverflowPolicy overflow = OVERFLOW_DROP);
+	~AsyncFileWriter();
+
+	bool open(const std::string& filename, bool append = false);
+
+	/* Writes everything that is buffered, then closes the file. */
+	bool close();
+	bool isOpen() const;
+
+	/* Blocks until the buffered data is written (not for the capture thread). */
+	bool flush();
+	uint64_t tell() const;
+
+	bool beginFrame();
+	bool endFrame();
+	bool writeFrame(const void* data, std::size_t length);
+
+	template <typename T>
+	bool write(const T& value);
+	template <typename T>
+	bool write(Span<const T> values);
+	template <typename T>
+	bool write(Span<T> values);
+	template <typename T>
+	bool writeBuffer(const T* buffer, std::size_t length);
+	bool writeBytes(const void* data, std::size_t length);
+
+	bool writeUInt32(uint32_t value);
+	bool writeUInt64(uint64_t value);
+	bool writeFloat(float value);
+
+	bool setSyncInterval(std::chrono::milliseconds interval);
+	FileSyncPolicy getSyncPolicy() const;
+
+	/* Producer side, can be changed between frames. */
+	bool setOverflowPolicy(FileOverflowPolicy overflow);
+	FileOverflowPolicy getOverflowPolicy() const;
+	FileStatus getStatus() const;
+
+	std::size_t getMemoryLimit() const;
+	std::size_t getBufferedBytes() const;
+	std::size_t getPeakBufferedBytes() const;
+	uint64_t getWrittenBytes() const;
+	std::size_t getDroppedFrames() const;
+	uint64_t getDroppedBytes() const;
+
+	/* Longest single write or sync (fdatasync / FlushFileBuffers) call. */
+	double getMaxStallMs() const;
+
+protected:
+	AsyncFileWriter(const AsyncFileWriter&) = delete;
+	AsyncFileWriter& operator = (const AsyncFileWriter&) = delete;
+
+	bool openFile(const std::string& filename, bool append, bool bDirect);
+	bool closeFile();
+	bool writeFile(const uint8_t* data, std::size_t length);
+	bool syncFile();
+	bool finishDirect();
+
+	void flushLoop();
+	bool drain();
+	bool copy(const uint8_t* data, std::size_t length);
+	bool writeBlocking(const uint8_t* data, std::size_t length);
+	bool commit();
+	bool drop(std::size_t length);
+	bool fail(FileStatus status);
+	bool updateStall(std::chrono::steady_clock::time_point start);
+
+	uint8_t* ring;
+	std::size_t capacity;
+	FileSyncPolicy policy;
+	std::chrono::milliseconds sync_interval;
+	std::string filename;
+	bool bDirect;
+
+	// Producer side.
+	FileOverflowPolicy overflow;
+	uint64_t pending;
+	bool bInFrame;
+	bool bDropping;
+	std::size_t peak_buffered;
+	std::size_t dropped_frames;
+	uint64_t dropped_bytes;
+
+	// Shared with the flush thread.
+	std::atomic<uint64_t> committed;
+	std::atomic<uint64_t> consumed;
+	std::atomic<int> status;
+	std::atomic<bool> bOpen;
+	std::atomic<bool> bStop;
+	std::atomic<bool> bFlushRequested;
+	std::atomic<double> max_stall_ms;
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable flushed;
+	std::thread flusher;
+
+#ifdef _WIN32
+	void* file_handle;
+#else
+	int file_descriptor;
+#endif
+};
+
+//------------------------------------------------------------------------------
+// Implementation
+//------------------------------------------------------------------------------
+template <typename T>
+bool AsyncFileWriter::write(const T& value) {
+	static_assert(std::is_trivially_copyable<T>::value, "AsyncFileWriter writes trivially copyable types only.");
+	static_assert(IsSpan<T>::value == false, "AsyncFileWriter writes the elements of spans, not the span.");
+	return this->writeBytes(&value, sizeof(T));
+}
+
+template <typename T>
+bool AsyncFileWriter::write(Span<const T> values) {
+	static_assert(std::is_trivially_copyable<T>::value, "AsyncFileWriter writes trivially copyable types only.");
+	return this->writeBytes(values.data(), values.bytes());
+}
+
+/* Spans of mutable elements would otherwise bind to write(const T&). */
+template <typename T>
+bool AsyncFileWriter::write(Span<T> values) {
+	return this->write(Span<const T>(values));
+}
+
+template <typename T>
+bool AsyncFileWriter::writeBuffer(const T* buffer, std::size_t length) {
+	return this->write(Span<const T>(buffer, length));
+}
+
+}
+
+#endif
@@ -0,0 +1,249 @@
+#ifndef PX_BOUNDED_QUEUE_H
+#define PX_BOUNDED_QUEUE_H
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+
+namespace px {
+
+/* Behaviour of BoundedQueue::push when the queue is full.
+ * QUEUE_DROP_OLDEST: discard the oldest queued item to make room (lowest latency).
+ * QUEUE_DROP_NEWEST: discard the item being pushed (keeps the queued sequence intact).
+ * QUEUE_BLOCK: wait until a consumer makes room (lossless back-pressure).
+ */
+enum QueueDropPolicy {
+	QUEUE_DROP_OLDEST,
+	QUEUE_DROP_NEWEST,
+	QUEUE_BLOCK
+};
+
+/* Fixed capacity multi-producer / multi-consumer FIFO queue. Storage is a
+ * ring allocated once at construction, so steady-state push/pop does not
+ * allocate. Every dropped item is counted.
+ */
+template <typename T>
+class BoundedQueue {
+public:
+	BoundedQueue(std::size_t capacity, QueueDropPolicy policy = QUEUE_DROP_OLDEST);
+	~BoundedQueue();
+
+	/* Returns true if the item was enqueued. With QUEUE_DROP_OLDEST the item
+	 * is always enqueued (an older one may be dropped). Returns false when
+	 * the item was dropped or the queue is closed.
+	 */
+	bool push(T&& item);
+	bool push(const T& item);
+
+	bool tryPop(T& item);
+
+	/* Blocks until an item is available or the queue is closed and empty. */
+	bool pop(T& item);
+	bool pop(T& item, std::chrono::milliseconds timeout);
+
+	/* Wakes all waiting producers and consumers. Pushes fail after close,
+	 * remaining items can still be popped.
+	 */
+	bool close();
+	bool reopen();
+	bool clear();
+
+	bool isClosed() const;
+	bool isEmpty() const;
+	std::size_t size() const;
+	std::size_t capacity() const;
+	QueueDropPolicy getPolicy() const;
+	std::size_t getDropped() const;
+	std::size_t getPeakSize() const;
+
+protected:
+	BoundedQueue(const BoundedQueue<T>&) = delete;
+	BoundedQueue<T>& operator = (const BoundedQueue<T>&) = delete;
+
+	bool enqueue(T&& item, std::unique_lock<std::mutex>& lock);
+	bool dequeue(T& item);
+
+	mutable std::mutex mutex;
+	std::condition_variable not_empty;
+	std::condition_variable not_full;
+	std::vector<T> ring;
+	std::size_t head;
+	std::size_t count;
+	std::size_t peak;
+	QueueDropPolicy policy;
+	bool bClosed;
+	std::atomic<std::size_t> dropped;
+};
+
+//------------------------------------------------------------------------------
+// Implementation
+//------------------------------------------------------------------------------
+template <typename T>
+BoundedQueue<T>::BoundedQueue(std::size_t capacity, QueueDropPolicy policy) {
+	if ( capacity == 0 ) capacity = 1;
+	this->ring.resize(capacity);
+	this->head = 0;
+	this->count = 0;
+	this->peak = 0;
+	this->policy = policy;
+	this->bClosed = false;
+	this->dropped = 0;
+}
+
+template <typename T>
+BoundedQueue<T>::~BoundedQueue() {
+	this->close();
+}
+
+template <typename T>
+bool BoundedQueue<T>::push(T&& item) {
+	std::unique_lock<std::mutex> lock(this->mutex);
+	return this->enqueue(std::move(item), lock);
+}
+
+template <typename T>
+bool BoundedQueue<T>::push(const T& item) {
+	T copy = item;
+	std::unique_lock<std::mutex> lock(this->mutex);
+	return this->enqueue(std::move(copy), lock);
+}
+
+template <typename T>
+bool BoundedQueue<T>::tryPop(T& item) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->dequeue(item);
+}
+
+template <typename T>
+bool BoundedQueue<T>::pop(T& item) {
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->not_empty.wait(lock, [this] { return this->count != 0 || this->bClosed; });
+	return this->dequeue(item);
+}
+
+template <typename T>
+bool BoundedQueue<T>::pop(T& item, std::chrono::milliseconds timeout) {
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->not_empty.wait_for(lock, timeout, [this] { return this->count != 0 || this->bClosed; });
+	return this->dequeue(item);
+}
+
+template <typename T>
+bool BoundedQueue<T>::close() {
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->bClosed = true;
+	}
+
+	this->not_empty.notify_all();
+	this->not_full.notify_all();
+	return true;
+}
+
+template <typename T>
+bool BoundedQueue<T>::reopen() {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->bClosed = false;
+	return true;
+}
+
+template <typename T>
+bool BoundedQueue<T>::clear() {
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		for ( std::size_t i = 0; i < this->ring.size(); i++ )
+			this->ring[i] = T();
+		this->head = 0;
+		this->count = 0;
+	}
+
+	this->not_full.notify_all();
+	return true;
+}
+
+template <typename T>
+bool BoundedQueue<T>::isClosed() const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->bClosed;
+}
+
+template <typename T>
+bool BoundedQueue<T>::isEmpty() const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->count == 0;
+}
+
+template <typename T>
+std::size_t BoundedQueue<T>::size() const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->count;
+}
+
+template <typename T>
+std::size_t BoundedQueue<T>::capacity() const {
+	return this->ring.size();
+}
+
+template <typename T>
+QueueDropPolicy BoundedQueue<T>::getPolicy() const {
+	return this->policy;
+}
+
+template <typename T>
+std::size_t BoundedQueue<T>::getDropped() const {
+	return this->dropped;
+}
+
+template <typename T>
+std::size_t BoundedQueue<T>::getPeakSize() const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->peak;
+}
+
+template <typename T>
+bool BoundedQueue<T>::enqueue(T&& item, std::unique_lock<std::mutex>& lock) {
+	if ( this->bClosed ) return false;
+	std::size_t capacity = this->ring.size();
+
+	if ( this->count == capacity ) {
+		if ( this->policy == QUEUE_DROP_NEWEST ) {
+			this->dropped++;
+			return false;
+		}
+		else if ( this->policy == QUEUE_DROP_OLDEST ) {
+			this->ring[this->head] = T();
+			this->head = (this->head + 1) % capacity;
+			this->count--;
+			this->dropped++;
+		}
+		else {
+			this->not_full.wait(lock, [this, capacity] { return this->count < capacity || this->bClosed; });
+			if ( this->bClosed ) return false;
+		}
+	}
+
+	this->ring[(this->head + this->count) % capacity] = std::move(item);
+	this->count++;
+	if ( this->count > this->peak ) this->peak = this->count;
+
+	lock.unlock();
+	this->not_empty.notify_one();
+	return true;
+}
+
+template <typename T>
+bool BoundedQueue<T>::dequeue(T& item) {
+	if ( this->count == 0 ) return false;
+	item = std::move(this->ring[this->head]);
+	this->ring[this->head] = T();
+	this->head = (this->head + 1) % this->ring.size();
+	this->count--;
+	this->not_full.notify_one();
+	return true;
+}
+
+}
+
+#endif
@@ -0,0 +1,550 @@
+#ifndef PX_BOX_FILTER_H
+#define PX_BOX_FILTER_H
+
+#include <cstdint>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+#include "Convolution.h"
+
+namespace px {
+
+/* Box filters over the (2 radius + 1)^2 window around every pixel, clipped
+ * to the image (border pixels average over fewer pixels instead of reading
+ * zeros). All of them cost O(1) per pixel whatever the radius.
+ *
+ * With bSkipZero, zero pixels (invalid depth) are left out of the window;
+ * a pixel whose window holds no nonzero pixel is 0.
+ */
+
+/* Accumulator of the summed-area tables and running sums: exact 64 bit
+ * integers for up to 16 bit images, double otherwise.
+ */
+template <typename ImageDataType>
+struct BoxSum {
+	typedef typename std::conditional<(std::is_integral<ImageDataType>::value && sizeof(ImageDataType) <= 2), uint64_t, double>::type type;
+};
+
+/* Sums stay far below 2^63, converting them as signed avoids the slow
+ * unsigned 64 bit to double conversion of x64.
+ */
+template <typename SumType>
+inline double BoxSumToDouble(SumType value) {
+	if constexpr ( std::is_unsigned<SumType>::value ) return static_cast<double>(static_cast<int64_t>(value));
+	else return static_cast<double>(value);
+}
+
+/* Summed-area tables (sums, sums of squares and, with bSkipZero, nonzero
+ * counts) of one frame. Built once per frame, after which the sum, mean and
+ * variance of any rectangle or window are four table lookups, so several
+ * radii or queries on the same frame share a single pass over it. The
+ * tables are reused by the next build().
+ */
+template <typename ImageDataType>
+class IntegralImage {
+public:
+	typedef typename BoxSum<ImageDataType>::type SumType;
+
+	IntegralImage();
+	~IntegralImage();
+
+	bool build(const ImageDataType* data, std::size_t width, std::size_t height, bool bSkipZero = false);
+	bool clear();
+	bool isValid() const;
+
+	std::size_t width() const;
+	std::size_t height() const;
+	bool skipsZero() const;
+
+	/* Rows [i0, i1) and columns [j0, j1), clipped to the image. */
+	SumType sum(std::size_t i0, std::size_t j0, std::size_t i1, std::size_t j1) const;
+	SumType squares(std::size_t i0, std::size_t j0, std::size_t i1, std::size_t j1) const;
+	std::size_t count(std::size_t i0, std::size_t j0, std::size_t i1, std::size_t j1) const;
+
+	/* Mean and (population) variance of the window around pixel (i, j). */
+	double mean(std::size_t i, std::size_t j, std::size_t radius) const;
+	double variance(std::size_t i, std::size_t j, std::size_t radius) const;
+
+	/* Box mean and local variance of every pixel. The output is an
+	 * IntensityImage of any type, resized to the frame; integer outputs are
+	 * rounded and saturated.
+	 */
+	template <typename OutputImage>
+	bool mean(std::size_t radius, OutputImage& image) const;
+	template <typename OutputImage>
+	bool variance(std::size_t radius, OutputImage& image) const;
+
+protected:
+	template <typename OutputImage, bool bVariance>
+	bool evaluate(std::size_t radius, OutputImage& image) const;
+
+	inline std::size_t index(std::size_t i, std::size_t j) const;
+
+	std::vector<SumType> sums;
+	std::vector<SumType> square_sums;
+	std::vector<uint32_t> counts;
+	std::size_t w, h;
+	bool bSkipZero;
+};
+
+template <typename ImageDataType>
+IntegralImage<ImageDataType>::IntegralImage() {
+	this->w = 0;
+	this->h = 0;
+	this->bSkipZero = false;
+}
+
+template <typename ImageDataType>
+IntegralImage<ImageDataType>::~IntegralImage() {}
+
+/* The tables are (height + 1) x (width + 1) with a zero first row and
+ * column, entry (i, j) holds the sum of rows [0, i) and columns [0, j).
+ */
+template <typename ImageDataType>
+bool IntegralImage<ImageDataType>::build(const ImageDataType* data, std::size_t width, std::size_t height, bool bSkipZero) {
+	if ( data == nullptr || width == 0 || height == 0 ) return false;
+	if ( (width + 1) * (height + 1) > std::numeric_limits<uint32_t>::max() ) {
+		std::cerr << "[IntegralImage:build] Error: Image too large: " << width << "x" << height << std::endl;
+		return false;
+	}
+
+	const std::size_t stride = width + 1;
+	this->w = width;
+	this->h = height;
+	this->bSkipZero = bSkipZero;
+	this->sums.resize(stride * (height + 1));
+	this->square_sums.resize(stride * (height + 1));
+	if ( bSkipZero ) this->counts.resize(stride * (height + 1));
+	else this->counts.clear();
+
+	std::fill(this->sums.begin(), this->sums.begin() + stride, SumType(0));
+	std::fill(this->square_sums.begin(), this->square_sums.begin() + stride, SumType(0));
+	if ( bSkipZero ) std::fill(this->counts.begin(), this->counts.begin() + stride, uint32_t(0));
+
+	for ( std::size_t i = 0; i < height; i++ ) {
+		const ImageDataType* row = data + i * width;
+		const SumType* above = &this->sums[i * stride];
+		const SumType* above_squares = &this->square_sums[i * stride];
+		SumType* current = &this->sums[(i + 1) * stride];
+		SumType* current_squares = &this->square_sums[(i + 1) * stride];
+		SumType row_sum = SumType(0);
+		SumType row_squares = SumType(0);
+
+		current[0] = SumType(0);
+		current_squares[0] = SumType(0);
+		for ( std::size_t j = 0; j < width; j++ ) {
+			SumType value = static_cast<SumType>(row[j]);
+			row_sum += value;
+			row_squares += value * value;
+			current[j + 1] = above[j + 1] + row_sum;
+			current_squares[j + 1] = above_squares[j + 1] + row_squares;
+		}
+
+		if ( bSkipZero ) {
+			const uint32_t* above_counts = &this->counts[i * stride];
+			uint32_t* current_counts = &this->counts[(i + 1) * stride];
+			uint32_t row_count = 0;
+
+			current_counts[0] = 0;
+			for ( std::size_t j = 0; j < width; j++ ) {
+				row_count += (row[j] != ImageDataType(0)) ? 1 : 0;
+				current_counts[j + 1] = above_counts[j + 1] + row_count;
+			}
+		}
+	}
+
+	return true;
+}
+
+template <typename ImageDataType>
+bool IntegralImage<ImageDataType>::clear() {
+	this->sums.clear();
+	this->square_sums.clear();
+	this->counts.clear();
+	this->w = 0;
+	this->h = 0;
+	return true;
+}
+
+template <typename ImageDataType>
+bool IntegralImage<ImageDataType>::isValid() const {
+	return this->w > 0 && this->h > 0;
+}
+
+template <typename ImageDataType>
+std::size_t IntegralImage<ImageDataType>::width() const {
+	return this->w;
+}
+
+template <typename ImageDataType>
+std::size_t IntegralImage<ImageDataType>::height() const {
+	return this->h;
+}
+
+template <typename ImageDataType>
+bool IntegralImage<ImageDataType>::skipsZero() const {
+	return this->bSkipZero;
+}
+
+template <typename ImageDataType>
+inline std::size_t IntegralImage<ImageDataType>::index(std::size_t i, std::size_t j) const {
+	return i * (this->w + 1) + j;
+}
+
+template <typename ImageDataType>
+typename IntegralImage<ImageDataType>::SumType IntegralImage<ImageDataType>::sum(std::size_t i0, std::size_t j0, std::size_t i1, std::size_t j1) const {
+	if ( this->isValid() == false ) return SumType(0);
+	i1 = std::min(i1, this->h);
+	j1 = std::min(j1, this->w);
+	if ( i0 >= i1 || j0 >= j1 ) return SumType(0);
+
+	const SumType* s = this->sums.data();
+	return (s[this->index(i1, j1)] - s[this->index(i0, j1)]) - (s[this->index(i1, j0)] - s[this->index(i0, j0)]);
+}
+
+template <typename ImageDataType>
+typename IntegralImage<ImageDataType>::SumType IntegralImage<ImageDataType>::squares(std::size_t i0, std::size_t j0, std::size_t i1, std::size_t j1) const {
+	if ( this->isValid() == false ) return SumType(0);
+	i1 = std::min(i1, this->h);
+	j1 = std::min(j1, this->w);
+	if ( i0 >= i1 || j0 >= j1 ) return SumType(0);
+
+	const SumType* s = this->square_sums.data();
+	return (s[this->index(i1, j1)] - s[this->index(i0, j1)]) - (s[this->index(i1, j0)] - s[this->index(i0, j0)]);
+}
+
+template <typename ImageDataType>
+std::size_t IntegralImage<ImageDataType>::count(std::size_t i0, std::size_t j0, std::size_t i1, std::size_t j1) const {
+	if ( this->isValid() == false ) return 0;
+	i1 = std::min(i1, this->h);
+	j1 = std::min(j1, this->w);
+	if ( i0 >= i1 || j0 >= j1 ) return 0;
+	if ( this->bSkipZero == false ) return (i1 - i0) * (j1 - j0);
+
+	const uint32_t* c = this->counts.data();
+	return (c[this->index(i1, j1)] - c[this->index(i0, j1)]) - (c[this->index(i1, j0)] - c[this->index(i0, j0)]);
+}
+
+template <typename ImageDataType>
+double IntegralImage<ImageDataType>::mean(std::size_t i, std::size_t j, std::size_t radius) const {
+	std::size_t i0 = (i > radius) ? i - radius : 0;
+	std::size_t j0 = (j > radius) ? j - radius : 0;
+	std::size_t n = this->count(i0, j0, i + radius + 1, j + radius + 1);
+	if ( n == 0 ) return double(0);
+	return BoxSumToDouble(this->sum(i0, j0, i + radius + 1, j + radius + 1)) / static_cast<double>(n);
+}
+
+template <typename ImageDataType>
+double IntegralImage<ImageDataType>::variance(std::size_t i, std::size_t j, std::size_t radius) const {
+	std::size_t i0 = (i > radius) ? i - radius : 0;
+	std::size_t j0 = (j > radius) ? j - radius : 0;
+	std::size_t n = this->count(i0, j0, i + radius + 1, j + radius + 1);
+	if ( n == 0 ) return double(0);
+
+	double m = BoxSumToDouble(this->sum(i0, j0, i + radius + 1, j + radius + 1)) / static_cast<double>(n);
+	double v = BoxSumToDouble(this->squares(i0, j0, i + radius + 1, j + radius + 1)) / static_cast<double>(n) - m * m;
+	return (v > double(0)) ? v : double(0);
+}
+
+template <typename ImageDataType>
+template <typename OutputImage>
+bool IntegralImage<ImageDataType>::mean(std::size_t radius, OutputImage& image) const {
+	return this->evaluate<OutputImage, false>(radius, image);
+}
+
+template <typename ImageDataType>
+template <typename OutputImage>
+bool IntegralImage<ImageDataType>::variance(std::size_t radius, OutputImage& image) const {
+	return this->evaluate<OutputImage, true>(radius, image);
+}
+
+/* Rows of the table are walked directly; only the window columns are
+ * clipped per pixel. Without bSkipZero the window area is known up front
+ * and the division becomes a multiplication.
+ */
+template <typename ImageDataType>
+template <typename OutputImage, bool bVariance>
+bool IntegralImage<ImageDataType>::evaluate(std::size_t radius, OutputImage& image) const {
+	if ( this->isValid() == false ) return false;
+	if ( image.width() != this->w || image.height() != this->h ) image.resize(this->w, this->h);
+
+	typedef typename std::remove_pointer<decltype(image.getData())>::type OutputType;
+	OutputType* out = image.getData();
+	if ( out == nullptr ) return false;
+
+	const std::size_t stride = this->w + 1;
+	std::vector<uint32_t> first(this->w), last(this->w);
+	std::vector<double> inverse_widths(this->w);
+	for ( std::size_t j = 0; j < this->w; j++ ) {
+		first[j] = static_cast<uint32_t>((j > radius) ? j - radius : 0);
+		last[j] = static_cast<uint32_t>(std::min(j + radius + 1, this->w));
+		inverse_widths[j] = double(1) / static_cast<double>(last[j] - first[j]);
+	}
+
+	for ( std::size_t i = 0; i < this->h; i++ ) {
+		std::size_t i0 = (i > radius) ? i - radius : 0;
+		std::size_t i1 = std::min(i + radius + 1, this->h);
+		const double inverse_rows = double(1) / static_cast<double>(i1 - i0);
+		const SumType* top = &this->sums[i0 * stride];
+		const SumType* bottom = &this->sums[i1 * stride];
+		const SumType* top_squares = &this->square_sums[i0 * stride];
+		const SumType* bottom_squares = &this->square_sums[i1 * stride];
+		const uint32_t* top_counts = this->bSkipZero ? &this->counts[i0 * stride] : nullptr;
+		const uint32_t* bottom_counts = this->bSkipZero ? &this->counts[i1 * stride] : nullptr;
+		OutputType* row = out + i * this->w;
+
+		for ( std::size_t j = 0; j < this->w; j++ ) {
+			const std::size_t j0 = first[j];
+			const std::size_t j1 = last[j];
+
+			double inverse_n = inverse_rows * inverse_widths[j];
+			if ( this->bSkipZero ) {
+				uint32_t n = (bottom_counts[j1] - top_counts[j1]) - (bottom_counts[j0] - top_counts[j0]);
+				if ( n == 0 ) {
+					row[j] = OutputType(0);
+					continue;
+				}
+				inverse_n = double(1) / static_cast<double>(n);
+			}
+
+			double value = BoxSumToDouble((bottom[j1] - top[j1]) - (bottom[j0] - top[j0])) * inverse_n;
+			if ( bVariance ) {
+				double q = BoxSumToDouble((bottom_squares[j1] - top_squares[j1]) - (bottom_squares[j0] - top_squares[j0])) * inverse_n;
+				value = q - value * value;
+				value = (value > double(0)) ? value : double(0);
+			}
+
+			row[j] = SaturateSample<OutputType>(value);
+		}
+	}
+
+	return true;
+}
+
+/* Box mean with running sums: column sums are updated by one entering and
+ * one leaving row per output row, and the window sums are differences of a
+ * prefix sum over the column sums, without building a table. src and dst
+ * must not overlap.
+ */
+template <typename ImageDataType, typename OutputType>
+bool BoxMean(const ImageDataType* src, OutputType* dst, std::size_t width, std::size_t height, std::size_t radius, bool bSkipZero = false) {
+	typedef typename BoxSum<ImageDataType>::type SumType;
+
+	if ( src == nullptr || dst == nullptr ) return false;
+	if ( width == 0 || height == 0 ) return false;
+
+	std::vector<SumType> columns(width, SumType(0));
+	std::vector<SumType> prefix(width + 1, SumType(0));
+	std::vector<uint32_t> column_counts(bSkipZero ? width : 0, 0);
+	std::vector<uint32_t> prefix_counts(bSkipZero ? width + 1 : 0, 0);
+
+	// Clipped window columns [first, last) and reciprocal width of every column.
+	std::vector<uint32_t> first(width), last(width);
+	std::vector<double> inverse_widths(width);
+	for ( std::size_t j = 0; j < width; j++ ) {
+		first[j] = static_cast<uint32_t>((j > radius) ? j - radius : 0);
+		last[j] = static_cast<uint32_t>(std::min(j + radius + 1, width));
+		inverse_widths[j] = double(1) / static_cast<double>(last[j] - first[j]);
+	}
+
+	std::size_t next = 0;
+	for ( std::size_t i = 0; i < height; i++ ) {
+		// Rows i - radius .. i + radius enter and leave the column sums.
+		std::size_t end = std::min(i + radius + 1, height);
+		for ( ; next < end; next++ ) {
+			const ImageDataType* row = src + next * width;
+			for ( std::size_t j = 0; j < width; j++ )
+				columns[j] += static_cast<SumType>(row[j]);
+			if ( bSkipZero ) {
+				for ( std::size_t j = 0; j < width; j++ )
+					column_counts[j] += (row[j] != ImageDataType(0)) ? 1 : 0;
+			}
+		}
+
+		if ( i > radius ) {
+			const ImageDataType* row = src + (i - radius - 1) * width;
+			for ( std::size_t j = 0; j < width; j++ )
+				columns[j] -= static_cast<SumType>(row[j]);
+			if ( bSkipZero ) {
+				for ( std::size_t j = 0; j < width; j++ )
+					column_counts[j] -= (row[j] != ImageDataType(0)) ? 1 : 0;
+			}
+		}
+
+		for ( std::size_t j = 0; j < width; j++ )
+			prefix[j + 1] = prefix[j] + columns[j];
+
+		OutputType* out = dst + i * width;
+		if ( bSkipZero ) {
+			for ( std::size_t j = 0; j < width; j++ )
+				prefix_counts[j + 1] = prefix_counts[j] + column_counts[j];
+
+			for ( std::size_t j = 0; j < width; j++ ) {
+				uint32_t n = prefix_counts[last[j]] - prefix_counts[first[j]];
+				double window = BoxSumToDouble(prefix[last[j]] - prefix[first[j]]);
+				out[j] = (n > 0) ? SaturateSample<OutputType>(window / static_cast<double>(n)) : OutputType(0);
+			}
+		}
+		else {
+			const double inverse_rows = double(1) / static_cast<double>(end - ((i > radius) ? i - radius : 0));
+			for ( std::size_t j = 0; j < width; j++ ) {
+				double window = BoxSumToDouble(prefix[last[j]] - prefix[first[j]]);
+				out[j] = SaturateSample<OutputType>(window * (inverse_rows * inverse_widths[j]));
+			}
+		}
+	}
+
+	return true;
+}
+
+/* Working memory of BoxExtremum (about three frames), resized as needed.
+ * Keeping it across frames avoids reallocating it on every call.
+ */
+template <typename ImageDataType>
+struct BoxExtremumScratch {
+	std::vector<ImageDataType> lines;
+	std::vector<uint8_t> valid;
+	std::vector<uint8_t> valid_lines;
+};
+
+template <bool bMinimum, typename ImageDataType>
+inline ImageDataType BoxSelect(ImageDataType a, ImageDataType b) {
+	if ( bMinimum ) return (b < a) ? b : a;
+	return (b > a) ? b : a;
+}
+
+/* Windowed minimum (bMinimum) or maximum with the van Herk/Gil-Werman
+ * algorithm: the padded line is cut into blocks of the window size, every
+ * window spans the suffix of one block and the prefix of the next, so each
+ * pixel takes three comparisons whatever the radius. It runs along the rows,
+ * then down the columns on whole rows at a time. With bSkipZero zero pixels
+ * are replaced by the identity of the comparison, so they never win; the
+ * windows holding no nonzero pixel are cleared by BoxExtremum.
+ */
+template <bool bMinimum, typename ImageDataType>
+bool BoxExtremumLines(const ImageDataType* src, ImageDataType* dst, std::size_t width, std::size_t height, std::size_t radius, bool bSkipZero, std::vector<ImageDataType>& scratch) {
+	const ImageDataType identity = bMinimum ? std::numeric_limits<ImageDataType>::max() : std::numeric_limits<ImageDataType>::lowest();
+	const std::size_t k = 2 * radius + 1;
+	const std::size_t line_length = width + 2 * radius;
+	const std::size_t padded_rows = height + 2 * radius;
+
+	// Row pass result, padded line and its prefix/suffix, column prefix/suffix rows.
+	scratch.resize(width * height + 3 * line_length + 2 * width * padded_rows);
+	ImageDataType* rows = scratch.data();
+	ImageDataType* line = rows + width * height;
+	ImageDataType* prefix = line + line_length;
+	ImageDataType* suffix = prefix + line_length;
+	ImageDataType* column_prefix = suffix + line_length;
+	ImageDataType* column_suffix = column_prefix + width * padded_rows;
+
+	std::fill(line, line + radius, identity);
+	std::fill(line + radius + width, line + line_length, identity);
+	for ( std::size_t i = 0; i < height; i++ ) {
+		const ImageDataType* row = src + i * width;
+		for ( std::size_t j = 0; j < width; j++ )
+			line[radius + j] = (bSkipZero && row[j] == ImageDataType(0)) ? identity : row[j];
+
+		for ( std::size_t b = 0; b < line_length; b += k ) {
+			std::size_t e = std::min(b + k, line_length);
+			prefix[b] = line[b];
+			for ( std::size_t p = b + 1; p < e; p++ )
+				prefix[p] = BoxSelect<bMinimum>(prefix[p - 1], line[p]);
+			suffix[e - 1] = line[e - 1];
+			for ( std::size_t p = e - 1; p > b; p-- )
+				suffix[p - 1] = BoxSelect<bMinimum>(line[p - 1], suffix[p]);
+		}
+
+		ImageDataType* out = rows + i * width;
+		for ( std::size_t j = 0; j < width; j++ )
+			out[j] = BoxSelect<bMinimum>(suffix[j], prefix[j + k - 1]);
+	}
+
+	// Padding rows are identity rows; the column pass works on whole rows.
+	auto padded_row = [&](std::size_t p) -> const ImageDataType* {
+		return (p >= radius && p < radius + height) ? rows + (p - radius) * width : nullptr;
+	};
+
+	for ( std::size_t b = 0; b < padded_rows; b += k ) {
+		std::size_t e = std::min(b + k, padded_rows);
+		for ( std::size_t p = b; p < e; p++ ) {
+			const ImageDataType* row = padded_row(p);
+			ImageDataType* current = column_prefix + p * width;
+			if ( p == b ) {
+				if ( row != nullptr ) std::copy(row, row + width, current);
+				else std::fill(current, current + width, identity);
+			}
+			else if ( row != nullptr ) {
+				const ImageDataType* previous = current - width;
+				for ( std::size_t j = 0; j < width; j++ )
+					current[j] = BoxSelect<bMinimum>(previous[j], row[j]);
+			}
+			else std::copy(current - width, current, current);
+		}
+	}
+
+	// Suffixes are built backwards; output row i needs the suffix of padded
+	// row i and is written as soon as that is known.
+	for ( std::size_t b = ((padded_rows - 1) / k) * k; ; b -= k ) {
+		std::size_t e = std::min(b + k, padded_rows);
+		for ( std::size_t p = e; p-- > b; ) {
+			const ImageDataType* row = padded_row(p);
+			ImageDataType* current = column_suffix + p * width;
+			if ( p == e - 1 ) {
+				if ( row != nullptr ) std::copy(row, row + width, current);
+				else std::fill(current, current + width, identity);
+			}
+			else if ( row != nullptr ) {
+				const ImageDataType* next = current + width;
+				for ( std::size_t j = 0; j < width; j++ )
+					current[j] = BoxSelect<bMinimum>(row[j], next[j]);
+			}
+			else std::copy(current + width, current + 2 * width, current);
+
+			if ( p >= height ) continue;
+			const ImageDataType* bottom = column_prefix + (p + k - 1) * width;
+			ImageDataType* out = dst + p * width;
+			for ( std::size_t j = 0; j < width; j++ )
+				out[j] = BoxSelect<bMinimum>(current[j], bottom[j]);
+		}
+		if ( b == 0 ) break;
+	}
+
+	return true;
+}
+
+/* Windowed minimum (bMinimum) or maximum, see BoxExtremumLines. src and dst
+ * may be the same image.
+ *
+ * With bSkipZero the window value is 0 if it holds no nonzero pixel. That is
+ * decided by the box maximum of the nonzero mask, not by the value, so
+ * windows whose pixels are all the type's largest (minimum) or lowest
+ * (maximum) value, such as saturated infrared, keep that value.
+ */
+template <bool bMinimum, typename ImageDataType>
+bool BoxExtremum(const ImageDataType* src, ImageDataType* dst, std::size_t width, std::size_t height, std::size_t radius, bool bSkipZero, BoxExtremumScratch<ImageDataType>& scratch) {
+	if ( src == nullptr || dst == nullptr ) return false;
+	if ( width == 0 || height == 0 ) return false;
+
+	const std::size_t n = width * height;
+	if ( bSkipZero ) {
+		// Taken from src before dst (possibly the same image) is written.
+		scratch.valid.resize(n);
+		for ( std::size_t i = 0; i < n; i++ )
+			scratch.valid[i] = (src[i] != ImageDataType(0)) ? 1 : 0;
+		BoxExtremumLines<false>(scratch.valid.data(), scratch.valid.data(), width, height, radius, false, scratch.valid_lines);
+	}
+
+	BoxExtremumLines<bMinimum>(src, dst, width, height, radius, bSkipZero, scratch.lines);
+
+	if ( bSkipZero ) {
+		for ( std::size_t i = 0; i < n; i++ )
+			if ( scratch.valid[i] == 0 ) dst[i] = ImageDataType(0);
+	}
+
+	return true;
+}
+
+}
+
+#endif
@@ -0,0 +1,166 @@
+#include "BufferedFileReader.h"
+#include <cstring>
+#include <algorithm>
+
+namespace px {
+
+#ifdef _WIN32
+inline int SeekFile(std::FILE* file, uint64_t position) { return _fseeki64(file, static_cast<long long>(position), SEEK_SET); }
+inline long long TellFile(std::FILE* file) { return _ftelli64(file); }
+#else
+inline int SeekFile(std::FILE* file, uint64_t position) { return fseeko(file, static_cast<off_t>(position), SEEK_SET); }
+inline long long TellFile(std::FILE* file) { return static_cast<long long>(ftello(file)); }
+#endif
+
+BufferedFileReader::BufferedFileReader(std::size_t buffer_size) {
+	this->file = nullptr;
+	this->begin = 0;
+	this->end = 0;
+	this->buffer_offset = 0;
+	this->file_size = 0;
+	this->status = FILE_OK;
+	this->buffer.resize(buffer_size == 0 ? 1 : buffer_size);
+}
+
+BufferedFileReader::~BufferedFileReader() {
+	this->close();
+}
+
+bool BufferedFileReader::open(const std::string& filename) {
+	if ( this->file != nullptr ) this->close();
+	this->status = FILE_OK;
+	this->begin = 0;
+	this->end = 0;
+	this->buffer_offset = 0;
+	this->file_size = 0;
+
+	this->file = std::fopen(filename.c_str(), "rb");
+	if ( this->file == nullptr ) return this->fail(FILE_OPEN_FAILED);
+	std::setvbuf(this->file, nullptr, _IONBF, 0);
+
+	std::fseek(this->file, 0, SEEK_END);
+	long long length = TellFile(this->file);
+	if ( length > 0 ) this->file_size = static_cast<uint64_t>(length);
+	if ( SeekFile(this->file, 0) != 0 ) return this->fail(FILE_SEEK_ERROR);
+	return true;
+}
+
+bool BufferedFileReader::close() {
+	if ( this->file == nullptr ) return false;
+	std::fclose(this->file);
+	this->file = nullptr;
+	this->begin = 0;
+	this->end = 0;
+	return true;
+}
+
+bool BufferedFileReader::isOpen() const {
+	return this->file != nullptr;
+}
+
+bool BufferedFileReader::hasNext() {
+	if ( this->file == nullptr || this->status != FILE_OK ) return false;
+	return this->tell() < this->file_size;
+}
+
+/* The buffer holds file bytes [buffer_offset, buffer_offset + end), the
+ * read position is buffer_offset + begin.
+ */
+bool BufferedFileReader::seek(uint64_t position) {
+	if ( this->file == nullptr ) return this->fail(FILE_NOT_OPEN);
+
+	if ( position >= this->buffer_offset && position <= this->buffer_offset + this->end ) {
+		this->begin = static_cast<std::size_t>(position - this->buffer_offset);
+		return true;
+	}
+
+	if ( SeekFile(this->file, position) != 0 ) return this->fail(FILE_SEEK_ERROR);
+	this->buffer_offset = position;
+	this->begin = 0;
+	this->end = 0;
+	return true;
+}
+
+bool BufferedFileReader::skip(uint64_t length) {
+	return this->seek(this->tell() + length);
+}
+
+uint64_t BufferedFileReader::tell() const {
+	return this->buffer_offset + this->begin;
+}
+
+uint64_t BufferedFileReader::size() const {
+	return this->file_size;
+}
+
+/* Refills the buffer from the current position. */
+bool BufferedFileReader::fill() {
+	this->buffer_offset += this->end;
+	this->begin = 0;
+	this->end = std::fread(this->buffer.data(), 1, this->buffer.size(), this->file);
+	if ( this->end == 0 ) return this->fail(std::ferror(this->file) ? FILE_READ_ERROR : FILE_END_OF_FILE);
+	return true;
+}
+
+bool BufferedFileReader::readBytes(void* data, std::size_t length) {
+	if ( this->status != FILE_OK ) return false;
+	if ( this->file == nullptr ) return this->fail(FILE_NOT_OPEN);
+
+	uint8_t* bytes = static_cast<uint8_t*>(data);
+
+	while ( length != 0 ) {
+		std::size_t available = this->end - this->begin;
+
+		if ( available == 0 ) {
+			// Large blocks are read straight into the destination.
+			if ( length >= this->buffer.size() ) {
+				std::size_t count = std::fread(bytes, 1, length, this->file);
+				this->buffer_offset += this->end + count;
+				this->begin = 0;
+				this->end = 0;
+				if ( count != length ) return this->fail(std::ferror(this->file) ? FILE_READ_ERROR : FILE_END_OF_FILE);
+				return true;
+			}
+
+			if ( this->fill() == false ) return false;
+			continue;
+		}
+
+		std::size_t count = std::min(available, length);
+		std::memcpy(bytes, this->buffer.data() + this->begin, count);
+		this->begin += count;
+		bytes += count;
+		length -= count;
+	}
+
+	return true;
+}
+
+bool BufferedFileReader::readFrameHeader(uint32_t& width, uint32_t& height, uint64_t& timestamp) {
+	uint8_t header[2 * sizeof(uint32_t) + sizeof(uint64_t)];
+	if ( this->readBytes(header, sizeof(header)) == false ) return false;
+	std::memcpy(&width, header, sizeof(uint32_t));
+	std::memcpy(&height, header + sizeof(uint32_t), sizeof(uint32_t));
+	std::memcpy(&timestamp, header + 2 * sizeof(uint32_t), sizeof(uint64_t));
+	return true;
+}
+
+FileStatus BufferedFileReader::getStatus() const {
+	return this->status;
+}
+
+bool BufferedFileReader::clearStatus() {
+	this->status = FILE_OK;
+	return true;
+}
+
+std::size_t BufferedFileReader::getBufferSize() const {
+	return this->buffer.size();
+}
+
+bool BufferedFileReader::fail(FileStatus status) {
+	if ( this->status == FILE_OK ) this->status = status;
+	return false;
+}
+
+}
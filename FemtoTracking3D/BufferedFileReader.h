@@ -0,0 +1,101 @@
+#ifndef PX_BUFFERED_FILE_READER_H
+#define PX_BUFFERED_FILE_READER_H
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "Span.h"
+#include "FileStatus.h"
+#include "BufferedFileWriter.h"
+
+namespace px {
+
+/* High-throughput alternative to BinaryFileReader. The file is read in
+ * buffer sized blocks and scalars are served from the buffer; reads larger
+ * than the buffer go straight into the destination. Nothing is printed:
+ * failures (including running off the end of the file) set a sticky status
+ * (see FileStatus.h).
+ */
+class BufferedFileReader {
+public:
+	BufferedFileReader(std::size_t buffer_size = DEFAULT_FILE_BUFFER_SIZE);
+	~BufferedFileReader();
+
+	bool open(const std::string& filename);
+	bool close();
+	bool isOpen() const;
+	bool hasNext();
+
+	/* Absolute byte positions. Seeking inside the buffered block does not
+	 * touch the file.
+	 */
+	bool seek(uint64_t position);
+	bool skip(uint64_t length);
+	uint64_t tell() const;
+	uint64_t size() const;
+
+	template <typename T>
+	bool read(T& value);
+	template <typename T>
+	bool read(Span<T> values);
+	template <typename T>
+	bool readBuffer(T* buffer, std::size_t length);
+	bool readBytes(void* data, std::size_t length);
+
+	/* Frame header of DataFrame/DepthCloud serialization (w, h, stamp). */
+	bool readFrameHeader(uint32_t& width, uint32_t& height, uint64_t& timestamp);
+
+	FileStatus getStatus() const;
+	bool clearStatus();
+	std::size_t getBufferSize() const;
+
+protected:
+	BufferedFileReader(const BufferedFileReader&) = delete;
+	BufferedFileReader& operator = (const BufferedFileReader&) = delete;
+
+	bool fail(FileStatus status);
+	bool fill();
+
+	std::FILE* file;
+	std::vector<uint8_t> buffer;
+	std::size_t begin;
+	std::size_t end;
+	uint64_t buffer_offset;
+	uint64_t file_size;
+	FileStatus status;
+};
+
+//------------------------------------------------------------------------------
+// Implementation
+//------------------------------------------------------------------------------
+template <typename T>
+bool BufferedFileReader::read(T& value) {
+	static_assert(std::is_trivially_copyable<T>::value, "BufferedFileReader reads trivially copyable types only.");
+
+	// Inline fast path: the value is in the buffer.
+	if ( this->status == FILE_OK && this->end - this->begin >= sizeof(T) ) {
+		std::memcpy(&value, this->buffer.data() + this->begin, sizeof(T));
+		this->begin += sizeof(T);
+		return true;
+	}
+
+	return this->readBytes(&value, sizeof(T));
+}
+
+template <typename T>
+bool BufferedFileReader::read(Span<T> values) {
+	static_assert(std::is_trivially_copyable<T>::value, "BufferedFileReader reads trivially copyable types only.");
+	return this->readBytes(values.data(), values.bytes());
+}
+
+template <typename T>
+bool BufferedFileReader::readBuffer(T* buffer, std::size_t length) {
+	return this->read(Span<T>(buffer, length));
+}
+
+}
+
+#endif
@@ -0,0 +1,152 @@
+#include "BufferedFileWriter.h"
+#include <cstring>
+
+namespace px {
+
+BufferedFileWriter::BufferedFileWriter(std::size_t buffer_size) {
+	this->file = nullptr;
+	this->used = 0;
+	this->position = 0;
+	this->status = FILE_OK;
+	this->bAppend = false;
+	this->buffer.resize(buffer_size == 0 ? 1 : buffer_size);
+}
+
+BufferedFileWriter::~BufferedFileWriter() {
+	this->close();
+}
+
+bool BufferedFileWriter::open(const std::string& filename, bool append) {
+	if ( this->file != nullptr ) this->close();
+	this->status = FILE_OK;
+	this->used = 0;
+	this->position = 0;
+	this->bAppend = append;
+
+	this->file = std::fopen(filename.c_str(), append ? "ab" : "wb");
+	if ( this->file == nullptr ) return this->fail(FILE_OPEN_FAILED);
+
+	// The stdio buffer would only add a second copy of every byte.
+	std::setvbuf(this->file, nullptr, _IONBF, 0);
+
+	if ( append ) {
+		std::fseek(this->file, 0, SEEK_END);
+#ifdef _WIN32
+		long long end = _ftelli64(this->file);
+#else
+		long long end = ftello(this->file);
+#endif
+		if ( end > 0 ) this->position = static_cast<uint64_t>(end);
+	}
+
+	return true;
+}
+
+bool BufferedFileWriter::close() {
+	if ( this->file == nullptr ) return false;
+	bool bFlushed = this->flushBuffer();
+	if ( std::fclose(this->file) != 0 ) bFlushed = this->fail(FILE_WRITE_ERROR);
+	this->file = nullptr;
+	return bFlushed;
+}
+
+bool BufferedFileWriter::isOpen() const {
+	return this->file != nullptr;
+}
+
+bool BufferedFileWriter::flush() {
+	if ( this->flushBuffer() == false ) return false;
+	if ( std::fflush(this->file) != 0 ) return this->fail(FILE_WRITE_ERROR);
+	return true;
+}
+
+uint64_t BufferedFileWriter::tell() const {
+	return this->position;
+}
+
+bool BufferedFileWriter::writeBytes(const void* data, std::size_t length) {
+	if ( this->status != FILE_OK ) return false;
+	if ( this->file == nullptr ) return this->fail(FILE_NOT_OPEN);
+	if ( length == 0 ) return true;
+
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+	if ( this->used + length > this->buffer.size() ) {
+		if ( this->flushBuffer() == false ) return false;
+
+		// Large blocks skip the buffer, copying them would not save a call.
+		if ( length >= this->buffer.size() ) {
+			if ( std::fwrite(bytes, 1, length, this->file) != length ) return this->fail(FILE_WRITE_ERROR);
+			this->position += length;
+			return true;
+		}
+	}
+
+	std::memcpy(this->buffer.data() + this->used, bytes, length);
+	this->used += length;
+	this->position += length;
+	return true;
+}
+
+bool BufferedFileWriter::writeFrameHeader(uint32_t width, uint32_t height, uint64_t timestamp) {
+	uint8_t header[2 * sizeof(uint32_t) + sizeof(uint64_t)];
+	std::memcpy(header, &width, sizeof(uint32_t));
+	std::memcpy(header + sizeof(uint32_t), &height, sizeof(uint32_t));
+	std::memcpy(header + 2 * sizeof(uint32_t), &timestamp, sizeof(uint64_t));
+	return this->writeBytes(header, sizeof(header));
+}
+
+bool BufferedFileWriter::seek(uint64_t position) {
+	if ( this->file == nullptr ) return this->fail(FILE_NOT_OPEN);
+	if ( this->bAppend ) return this->fail(FILE_SEEK_ERROR);
+	if ( this->flushBuffer() == false ) return false;
+
+#ifdef _WIN32
+	int result = _fseeki64(this->file, static_cast<long long>(position), SEEK_SET);
+#else
+	int result = fseeko(this->file, static_cast<off_t>(position), SEEK_SET);
+#endif
+	if ( result != 0 ) return this->fail(FILE_SEEK_ERROR);
+	this->position = position;
+	return true;
+}
+
+bool BufferedFileWriter::flushBuffer() {
+	if ( this->status != FILE_OK ) return false;
+	if ( this->file == nullptr ) return this->fail(FILE_NOT_OPEN);
+	if ( this->used == 0 ) return true;
+
+	std::size_t length = this->used;
+	this->used = 0;
+	if ( std::fwrite(this->buffer.data(), 1, length, this->file) != length ) return this->fail(FILE_WRITE_ERROR);
+	return true;
+}
+
+FileStatus BufferedFileWriter::getStatus() const {
+	return this->status;
+}
+
+bool BufferedFileWriter::clearStatus() {
+	this->status = FILE_OK;
+	return true;
+}
+
+/* Buffered bytes are flushed before the buffer is resized. */
+bool BufferedFileWriter::setBufferSize(std::size_t buffer_size) {
+	if ( buffer_size == 0 ) return false;
+	if ( this->file != nullptr && this->flushBuffer() == false ) return false;
+	this->buffer.resize(buffer_size);
+	this->buffer.shrink_to_fit();
+	return true;
+}
+
+std::size_t BufferedFileWriter::getBufferSize() const {
+	return this->buffer.size();
+}
+
+bool BufferedFileWriter::fail(FileStatus status) {
+	if ( this->status == FILE_OK ) this->status = status;
+	return false;
+}
+
+}
@@ -0,0 +1,112 @@
+#ifndef PX_BUFFERED_FILE_WRITER_H
+#define PX_BUFFERED_FILE_WRITER_H
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "Span.h"
+#include "FileStatus.h"
+
+namespace px {
+
+const static std::size_t DEFAULT_FILE_BUFFER_SIZE = 1 << 20;
+
+/* High-throughput alternative to BinaryFileWriter. Writes are collected in
+ * a large user-space buffer and handed to the OS in buffer sized blocks
+ * (writes larger than the buffer go straight through). Scalars and spans of
+ * trivially copyable types are written as raw bytes. Nothing is printed:
+ * failures set a sticky status (see FileStatus.h).
+ */
+class BufferedFileWriter {
+public:
+	BufferedFileWriter(std::size_t buffer_size = DEFAULT_FILE_BUFFER_SIZE);
+	~BufferedFileWriter();
+
+	bool open(const std::string& filename, bool append = false);
+	bool close();
+	bool isOpen() const;
+
+	/* Hands the buffered bytes to the OS. */
+	bool flush();
+	uint64_t tell() const;
+
+	/* Moves the write position (e.g. to patch a header written earlier);
+	 * not available for files opened in append mode.
+	 */
+	bool seek(uint64_t position);
+
+	template <typename T>
+	bool write(const T& value);
+	template <typename T>
+	bool write(Span<const T> values);
+	template <typename T>
+	bool write(Span<T> values);
+	template <typename T>
+	bool writeBuffer(const T* buffer, std::size_t length);
+	bool writeBytes(const void* data, std::size_t length);
+
+	/* Frame header of DataFrame/DepthCloud serialization (w, h, stamp). */
+	bool writeFrameHeader(uint32_t width, uint32_t height, uint64_t timestamp);
+
+	FileStatus getStatus() const;
+	bool clearStatus();
+	bool setBufferSize(std::size_t buffer_size);
+	std::size_t getBufferSize() const;
+
+protected:
+	BufferedFileWriter(const BufferedFileWriter&) = delete;
+	BufferedFileWriter& operator = (const BufferedFileWriter&) = delete;
+
+	bool fail(FileStatus status);
+	bool flushBuffer();
+
+	std::FILE* file;
+	std::vector<uint8_t> buffer;
+	std::size_t used;
+	uint64_t position;
+	FileStatus status;
+	bool bAppend;
+};
+
+//------------------------------------------------------------------------------
+// Implementation
+//------------------------------------------------------------------------------
+template <typename T>
+bool BufferedFileWriter::write(const T& value) {
+	static_assert(std::is_trivially_copyable<T>::value, "BufferedFileWriter writes trivially copyable types only.");
+	static_assert(IsSpan<T>::value == false, "BufferedFileWriter writes the elements of spans, not the span.");
+
+	// Inline fast path: the value fits in the buffer.
+	if ( this->status == FILE_OK && this->file != nullptr && this->used + sizeof(T) <= this->buffer.size() ) {
+		std::memcpy(this->buffer.data() + this->used, &value, sizeof(T));
+		this->used += sizeof(T);
+		this->position += sizeof(T);
+		return true;
+	}
+
+	return this->writeBytes(&value, sizeof(T));
+}
+
+template <typename T>
+bool BufferedFileWriter::write(Span<const T> values) {
+	static_assert(std::is_trivially_copyable<T>::value, "BufferedFileWriter writes trivially copyable types only.");
+	return this->writeBytes(values.data(), values.bytes());
+}
+
+/* Spans of mutable elements would otherwise bind to write(const T&). */
+template <typename T>
+bool BufferedFileWriter::write(Span<T> values) {
+	return this->write(Span<const T>(values));
+}
+
+template <typename T>
+bool BufferedFileWriter::writeBuffer(const T* buffer, std::size_t length) {
+	return this->write(Span<const T>(buffer, length));
+}
+
+}
+
+#endif
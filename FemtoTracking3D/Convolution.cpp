@@ -0,0 +1,207 @@
+#include "Convolution.h"
+#include "CpuFeatures.h"
+#include <atomic>
+#include <cstring>
+
+#if defined(PX_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+namespace px {
+
+const static float CONVOLVE_U16_HIGH = 65535.0f;
+
+void ConvolveLineScalar(const float* src, float* dst, std::size_t count, const float* weights, std::size_t taps, bool bAccumulate) {
+	ConvolveLine<float>(src, dst, count, weights, taps, bAccumulate);
+}
+
+void ConvolveLinesScalar(const float* const* lines, float* dst, std::size_t count, const float* weights, std::size_t taps) {
+	ConvolveLines<float>(lines, dst, count, weights, taps);
+}
+
+void ConvolveLoadScalar(const uint16_t* src, float* dst, std::size_t count) {
+	ConvolveLoad<uint16_t, float>(src, dst, count);
+}
+
+void ConvolveStoreScalar(const float* src, float* dst, std::size_t count, float scale) {
+	ConvolveStore<float, float>(src, dst, count, scale);
+}
+
+void ConvolveStoreScalar(const float* src, uint16_t* dst, std::size_t count, float scale) {
+	ConvolveStore<float, uint16_t>(src, dst, count, scale);
+}
+
+#if defined(PX_SIMD_X86)
+PX_TARGET_AVX2 void ConvolveLineAVX2(const float* src, float* dst, std::size_t count, const float* weights, std::size_t taps, bool bAccumulate) {
+	std::size_t x = 0;
+	for ( ; x + 16 <= count; x += 16 ) {
+		__m256 sum0 = bAccumulate ? _mm256_loadu_ps(dst + x) : _mm256_setzero_ps();
+		__m256 sum1 = bAccumulate ? _mm256_loadu_ps(dst + x + 8) : _mm256_setzero_ps();
+		for ( std::size_t k = 0; k < taps; k++ ) {
+			__m256 weight = _mm256_broadcast_ss(weights + k);
+			sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(src + x + k), weight));
+			sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(src + x + k + 8), weight));
+		}
+		_mm256_storeu_ps(dst + x, sum0);
+		_mm256_storeu_ps(dst + x + 8, sum1);
+	}
+
+	for ( ; x + 8 <= count; x += 8 ) {
+		__m256 sum = bAccumulate ? _mm256_loadu_ps(dst + x) : _mm256_setzero_ps();
+		for ( std::size_t k = 0; k < taps; k++ )
+			sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(src + x + k), _mm256_broadcast_ss(weights + k)));
+		_mm256_storeu_ps(dst + x, sum);
+	}
+
+	ConvolveLineScalar(src + x, dst + x, count - x, weights, taps, bAccumulate);
+}
+
+PX_TARGET_AVX2 void ConvolveLinesAVX2(const float* const* lines, float* dst, std::size_t count, const float* weights, std::size_t taps) {
+	std::size_t x = 0;
+	for ( ; x + 16 <= count; x += 16 ) {
+		__m256 sum0 = _mm256_setzero_ps();
+		__m256 sum1 = _mm256_setzero_ps();
+		for ( std::size_t k = 0; k < taps; k++ ) {
+			__m256 weight = _mm256_broadcast_ss(weights + k);
+			sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(lines[k] + x), weight));
+			sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(lines[k] + x + 8), weight));
+		}
+		_mm256_storeu_ps(dst + x, sum0);
+		_mm256_storeu_ps(dst + x + 8, sum1);
+	}
+
+	for ( ; x + 8 <= count; x += 8 ) {
+		__m256 sum = _mm256_setzero_ps();
+		for ( std::size_t k = 0; k < taps; k++ )
+			sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(lines[k] + x), _mm256_broadcast_ss(weights + k)));
+		_mm256_storeu_ps(dst + x, sum);
+	}
+
+	// Scalar tail, ConvolveLinesScalar would need offset copies of the line pointers.
+	for ( ; x < count; x++ ) {
+		float sum = 0.0f;
+		for ( std::size_t k = 0; k < taps; k++ )
+			sum += lines[k][x] * weights[k];
+		dst[x] = sum;
+	}
+}
+
+PX_TARGET_AVX2 void ConvolveLoadAVX2(const uint16_t* src, float* dst, std::size_t count) {
+	std::size_t x = 0;
+	for ( ; x + 8 <= count; x += 8 ) {
+		__m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x)));
+		_mm256_storeu_ps(dst + x, _mm256_cvtepi32_ps(v));
+	}
+
+	ConvolveLoadScalar(src + x, dst + x, count - x);
+}
+
+PX_TARGET_AVX2 void ConvolveStoreAVX2(const float* src, float* dst, std::size_t count, float scale) {
+	const __m256 s = _mm256_set1_ps(scale);
+	std::size_t x = 0;
+	for ( ; x + 8 <= count; x += 8 )
+		_mm256_storeu_ps(dst + x, _mm256_mul_ps(_mm256_loadu_ps(src + x), s));
+
+	ConvolveStoreScalar(src + x, dst + x, count - x, scale);
+}
+
+/* Clamping before the conversion (max first, so NaN becomes 0) matches the
+ * scalar store; cvtps rounds to nearest even like nearbyint.
+ */
+PX_TARGET_AVX2 void ConvolveStoreAVX2(const float* src, uint16_t* dst, std::size_t count, float scale) {
+	const __m256 s = _mm256_set1_ps(scale);
+	const __m256 low = _mm256_setzero_ps();
+	const __m256 high = _mm256_set1_ps(CONVOLVE_U16_HIGH);
+	std::size_t x = 0;
+	for ( ; x + 16 <= count; x += 16 ) {
+		__m256 v0 = _mm256_mul_ps(_mm256_loadu_ps(src + x), s);
+		__m256 v1 = _mm256_mul_ps(_mm256_loadu_ps(src + x + 8), s);
+		v0 = _mm256_min_ps(_mm256_max_ps(v0, low), high);
+		v1 = _mm256_min_ps(_mm256_max_ps(v1, low), high);
+		__m256i packed = _mm256_packus_epi32(_mm256_cvtps_epi32(v0), _mm256_cvtps_epi32(v1));
+		packed = _mm256_permute4x64_epi64(packed, 0xD8);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x), packed);
+	}
+
+	ConvolveStoreScalar(src + x, dst + x, count - x, scale);
+}
+#endif
+
+inline ConvolveKernel BestConvolveKernel(ConvolveKernel requested) {
+#if defined(PX_SIMD_X86)
+	if ( requested == CONVOLVE_AVX2 && CpuFeatures::Get().avx2 ) return CONVOLVE_AVX2;
+#endif
+	return CONVOLVE_SCALAR;
+}
+
+static std::atomic<int> active_convolve_kernel(-1);
+
+inline ConvolveKernel ActiveConvolveKernel() {
+	int kernel = active_convolve_kernel.load(std::memory_order_relaxed);
+	if ( kernel >= 0 ) return static_cast<ConvolveKernel>(kernel);
+
+	ConvolveKernel best = BestConvolveKernel(CONVOLVE_AVX2);
+	active_convolve_kernel.store(static_cast<int>(best), std::memory_order_relaxed);
+	return best;
+}
+
+void ConvolveLine(const float* src, float* dst, std::size_t count, const float* weights, std::size_t taps, bool bAccumulate) {
+	switch ( ActiveConvolveKernel() ) {
+#if defined(PX_SIMD_X86)
+		case CONVOLVE_AVX2: ConvolveLineAVX2(src, dst, count, weights, taps, bAccumulate); return;
+#endif
+		default: ConvolveLineScalar(src, dst, count, weights, taps, bAccumulate); return;
+	}
+}
+
+void ConvolveLines(const float* const* lines, float* dst, std::size_t count, const float* weights, std::size_t taps) {
+	switch ( ActiveConvolveKernel() ) {
+#if defined(PX_SIMD_X86)
+		case CONVOLVE_AVX2: ConvolveLinesAVX2(lines, dst, count, weights, taps); return;
+#endif
+		default: ConvolveLinesScalar(lines, dst, count, weights, taps); return;
+	}
+}
+
+void ConvolveLoad(const float* src, float* dst, std::size_t count) {
+	if ( src != dst ) std::memmove(dst, src, count * sizeof(float));
+}
+
+void ConvolveLoad(const uint16_t* src, float* dst, std::size_t count) {
+	switch ( ActiveConvolveKernel() ) {
+#if defined(PX_SIMD_X86)
+		case CONVOLVE_AVX2: ConvolveLoadAVX2(src, dst, count); return;
+#endif
+		default: ConvolveLoadScalar(src, dst, count); return;
+	}
+}
+
+void ConvolveStore(const float* src, float* dst, std::size_t count, float scale) {
+	switch ( ActiveConvolveKernel() ) {
+#if defined(PX_SIMD_X86)
+		case CONVOLVE_AVX2: ConvolveStoreAVX2(src, dst, count, scale); return;
+#endif
+		default: ConvolveStoreScalar(src, dst, count, scale); return;
+	}
+}
+
+void ConvolveStore(const float* src, uint16_t* dst, std::size_t count, float scale) {
+	switch ( ActiveConvolveKernel() ) {
+#if defined(PX_SIMD_X86)
+		case CONVOLVE_AVX2: ConvolveStoreAVX2(src, dst, count, scale); return;
+#endif
+		default: ConvolveStoreScalar(src, dst, count, scale); return;
+	}
+}
+
+bool SetConvolveKernel(ConvolveKernel kernel) {
+	ConvolveKernel selected = BestConvolveKernel(kernel);
+	active_convolve_kernel.store(static_cast<int>(selected), std::memory_order_relaxed);
+	return selected == kernel;
+}
+
+ConvolveKernel GetConvolveKernel() {
+	return ActiveConvolveKernel();
+}
+
+}
@@ -0,0 +1,194 @@
+#ifndef PX_CONVOLUTION_H
+#define PX_CONVOLUTION_H
+
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+#include "Kernel.h"
+
+namespace px {
+
+enum ConvolveKernel {
+	CONVOLVE_SCALAR,
+	CONVOLVE_AVX2
+};
+
+/* Line primitives of Convolve. Lines are count samples long.
+ *
+ * ConvolveLine: dst[x] (+)= sum_k src[x + k] * weights[k], src holds
+ *   count + taps - 1 samples (the padded line). With bAccumulate the sums
+ *   are added to dst, otherwise dst is overwritten.
+ * ConvolveLines: dst[x] = sum_k lines[k][x] * weights[k].
+ * ConvolveLoad: widens an image row to samples.
+ * ConvolveStore: dst[x] = src[x] * scale, rounded to nearest and saturated
+ *   for integer images.
+ *
+ * The float and uint16_t primitives have AVX2 kernels, all kernels produce
+ * bit-identical results (taps are summed in the same order, without FMA).
+ */
+void ConvolveLine(const float* src, float* dst, std::size_t count, const float* weights, std::size_t taps, bool bAccumulate);
+void ConvolveLines(const float* const* lines, float* dst, std::size_t count, const float* weights, std::size_t taps);
+void ConvolveLoad(const float* src, float* dst, std::size_t count);
+void ConvolveLoad(const uint16_t* src, float* dst, std::size_t count);
+void ConvolveStore(const float* src, float* dst, std::size_t count, float scale);
+void ConvolveStore(const float* src, uint16_t* dst, std::size_t count, float scale);
+
+/* The best supported kernel is selected on first use. Setting a kernel the
+ * CPU does not support falls back to the best supported one.
+ */
+bool SetConvolveKernel(ConvolveKernel kernel);
+ConvolveKernel GetConvolveKernel();
+
+/* Sample type the rows are filtered in: float for up to 16 bit images and
+ * float images, double for double and 32 bit images.
+ */
+template <typename ImageDataType>
+struct ConvolveSample {
+	typedef typename std::conditional<(sizeof(ImageDataType) > 2), double, float>::type type;
+};
+
+template <>
+struct ConvolveSample<float> {
+	typedef float type;
+};
+
+template <typename SampleType>
+inline void ConvolveLine(const SampleType* src, SampleType* dst, std::size_t count, const SampleType* weights, std::size_t taps, bool bAccumulate) {
+	for ( std::size_t x = 0; x < count; x++ ) {
+		SampleType sum = bAccumulate ? dst[x] : SampleType(0);
+		for ( std::size_t k = 0; k < taps; k++ )
+			sum += src[x + k] * weights[k];
+		dst[x] = sum;
+	}
+}
+
+template <typename SampleType>
+inline void ConvolveLines(const SampleType* const* lines, SampleType* dst, std::size_t count, const SampleType* weights, std::size_t taps) {
+	for ( std::size_t x = 0; x < count; x++ ) {
+		SampleType sum = SampleType(0);
+		for ( std::size_t k = 0; k < taps; k++ )
+			sum += lines[k][x] * weights[k];
+		dst[x] = sum;
+	}
+}
+
+template <typename ImageDataType, typename SampleType>
+inline void ConvolveLoad(const ImageDataType* src, SampleType* dst, std::size_t count) {
+	for ( std::size_t x = 0; x < count; x++ )
+		dst[x] = static_cast<SampleType>(src[x]);
+}
+
+/* Converts a filtered sample to the image type: rounded to nearest even and
+ * saturated (NaN to the low bound) for integer images. Up to 16 bit the
+ * clamped value is rounded by adding and subtracting 1.5 * 2^mantissa bits,
+ * which is exact in that range and avoids a libm call per pixel.
+ */
+template <typename ImageDataType, typename SampleType>
+inline ImageDataType SaturateSample(SampleType value) {
+	if constexpr ( std::is_integral<ImageDataType>::value ) {
+		const SampleType low = static_cast<SampleType>(std::numeric_limits<ImageDataType>::lowest());
+		const SampleType high = static_cast<SampleType>(std::numeric_limits<ImageDataType>::max());
+		value = (value > low) ? value : low;
+		value = (value < high) ? value : high;
+		if constexpr ( sizeof(ImageDataType) <= 2 ) {
+			const SampleType ROUND = SampleType(1.5) * static_cast<SampleType>(uint64_t(1) << (std::numeric_limits<SampleType>::digits - 1));
+			return static_cast<ImageDataType>((value + ROUND) - ROUND);
+		}
+		else return static_cast<ImageDataType>(std::nearbyint(value));
+	}
+	else return static_cast<ImageDataType>(value);
+}
+
+template <typename SampleType, typename ImageDataType>
+inline void ConvolveStore(const SampleType* src, ImageDataType* dst, std::size_t count, SampleType scale) {
+	for ( std::size_t x = 0; x < count; x++ )
+		dst[x] = SaturateSample<ImageDataType>(src[x] * scale);
+}
+
+/* Correlates a width x height image with the kernel centered on
+ * (centerY(), centerX()); pixels outside the image are zero. With divide
+ * the result is divided by the number of kernel taps. src and dst may be
+ * the same image.
+ *
+ * The image is streamed row by row through a ring of kernel height rows,
+ * each row is widened and zero padded once when it enters the ring, so the
+ * inner loops run without bounds checks. Separable kernels are applied as
+ * a row pass when a row enters the ring and a column pass over the ring per
+ * output row (kw + kh instead of kw * kh taps per pixel).
+ */
+template <typename ImageDataType>
+bool Convolve(const ImageDataType* src, ImageDataType* dst, std::size_t width, std::size_t height, const Kernel<ImageDataType>& kernel, bool divide = false) {
+	typedef typename ConvolveSample<ImageDataType>::type SampleType;
+
+	if ( src == nullptr || dst == nullptr ) return false;
+	if ( width == 0 || height == 0 ) return false;
+	if ( kernel.width() == 0 || kernel.height() == 0 || kernel.constData() == nullptr ) return false;
+
+	const std::size_t kw = kernel.width();
+	const std::size_t kh = kernel.height();
+	const std::size_t cx = kernel.centerX();
+	const std::size_t cy = kernel.centerY();
+	const std::size_t padded_width = width + kw - 1;
+	const double* weights = kernel.constData();
+
+	SampleType scale = SampleType(1);
+	if ( divide ) scale = static_cast<SampleType>(double(1) / static_cast<double>(kernel.size()));
+
+	std::vector<double> column, row;
+	const bool bSeparable = kernel.separate(column, row);
+
+	std::vector<SampleType> row_weights, column_weights, taps;
+	if ( bSeparable ) {
+		row_weights.assign(row.begin(), row.end());
+		column_weights.assign(column.begin(), column.end());
+	}
+	else taps.assign(weights, weights + kw * kh);
+
+	// Separable: the ring holds row filtered lines, non-separable: padded lines.
+	// The padding is zeroed here once, loads only write the interior.
+	const std::size_t line_width = bSeparable ? width : padded_width;
+	std::vector<SampleType> ring(kh * line_width, SampleType(0));
+	std::vector<SampleType> padded(bSeparable ? padded_width : 0, SampleType(0));
+	std::vector<SampleType> output(width);
+	std::vector<const SampleType*> lines(kh);
+	std::vector<SampleType> line_weights(kh);
+
+	std::size_t next = 0;
+	for ( std::size_t y = 0; y < height; y++ ) {
+		// Rows y - cy .. y - cy + kh - 1 contribute; load those not in the ring yet.
+		std::size_t last = std::min(y + kh - cy, height);
+		for ( ; next < last; next++ ) {
+			SampleType* line = &ring[(next % kh) * line_width];
+			if ( bSeparable ) {
+				ConvolveLoad(src + next * width, &padded[cx], width);
+				ConvolveLine(padded.data(), line, width, row_weights.data(), kw, false);
+			}
+			else ConvolveLoad(src + next * width, line + cx, width);
+		}
+
+		std::size_t count = 0;
+		for ( std::size_t k = 0; k < kh; k++ ) {
+			if ( y + k < cy || y + k - cy >= height ) continue;
+			const SampleType* line = &ring[((y + k - cy) % kh) * line_width];
+
+			if ( bSeparable ) {
+				lines[count] = line;
+				line_weights[count] = column_weights[k];
+			}
+			else ConvolveLine(line, output.data(), width, &taps[k * kw], kw, count > 0);
+			count++;
+		}
+
+		if ( bSeparable ) ConvolveLines(lines.data(), output.data(), width, line_weights.data(), count);
+		ConvolveStore(output.data(), dst + y * width, width, scale);
+	}
+
+	return true;
+}
+
+}
+
+#endif
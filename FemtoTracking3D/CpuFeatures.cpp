@@ -0,0 +1,82 @@
+#include "CpuFeatures.h"
+#include <sstream>
+
+#if defined(PX_SIMD_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace px {
+
+#if defined(PX_SIMD_X86)
+inline void CpuId(int leaf, int subleaf, unsigned int registers[4]) {
+#if defined(_MSC_VER)
+	int values[4];
+	__cpuidex(values, leaf, subleaf);
+	for ( int i = 0; i < 4; i++ ) registers[i] = static_cast<unsigned int>(values[i]);
+#else
+	__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+inline unsigned long long XGetBV(unsigned int index) {
+#if defined(_MSC_VER)
+	return _xgetbv(index);
+#else
+	unsigned int eax, edx;
+	__asm__ volatile ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+	return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+}
+
+inline CpuFeatures DetectCpuFeatures() {
+	CpuFeatures features = { false, false, false, false };
+	unsigned int registers[4] = { 0, 0, 0, 0 };
+
+	CpuId(0, 0, registers);
+	unsigned int max_leaf = registers[0];
+	if ( max_leaf < 1 ) return features;
+
+	CpuId(1, 0, registers);
+	features.sse41 = (registers[2] & (1u << 19)) != 0;
+	features.sse42 = (registers[2] & (1u << 20)) != 0;
+	bool osxsave = (registers[2] & (1u << 27)) != 0;
+	bool avx = (registers[2] & (1u << 28)) != 0;
+	bool fma = (registers[2] & (1u << 12)) != 0;
+
+	// The OS must save XMM and YMM state for AVX to be usable.
+	bool ymm = osxsave && (XGetBV(0) & 0x6) == 0x6;
+
+	if ( max_leaf >= 7 ) {
+		CpuId(7, 0, registers);
+		features.avx2 = avx && ymm && (registers[1] & (1u << 5)) != 0;
+	}
+
+	features.fma = fma && ymm;
+	return features;
+}
+#else
+inline CpuFeatures DetectCpuFeatures() {
+	CpuFeatures features = { false, false, false, false };
+	return features;
+}
+#endif
+
+const CpuFeatures& CpuFeatures::Get() {
+	static const CpuFeatures features = DetectCpuFeatures();
+	return features;
+}
+
+std::string CpuFeatures::toString() const {
+	std::stringstream stream;
+	stream << "SSE4.1: " << (this->sse41 ? "yes" : "no") << std::endl;
+	stream << "SSE4.2: " << (this->sse42 ? "yes" : "no") << std::endl;
+	stream << "AVX2: " << (this->avx2 ? "yes" : "no") << std::endl;
+	stream << "FMA: " << (this->fma ? "yes" : "no") << std::endl;
+	return stream.str();
+}
+
+}
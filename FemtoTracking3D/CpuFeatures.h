@@ -0,0 +1,42 @@
+#ifndef PX_CPU_FEATURES_H
+#define PX_CPU_FEATURES_H
+
+#include <string>
+
+/* x86 SIMD kernels are compiled into every build and selected at runtime
+ * from the detected CPU features. MSVC accepts any intrinsic without
+ * /arch flags; GCC and Clang need the target attribute on each kernel.
+ */
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PX_SIMD_X86 1
+#endif
+
+#if defined(PX_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define PX_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define PX_TARGET_SSE42 __attribute__((target("sse4.2")))
+#define PX_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define PX_TARGET_SSE41
+#define PX_TARGET_SSE42
+#define PX_TARGET_AVX2
+#endif
+
+namespace px {
+
+struct CpuFeatures {
+	bool sse41;
+	bool sse42;
+	bool avx2;
+	bool fma;
+
+	std::string toString() const;
+
+	/* Detected once, on first use. AVX2 is only reported when the OS also
+	 * saves the YMM registers (XGETBV).
+	 */
+	static const CpuFeatures& Get();
+};
+
+}
+
+#endif
@@ -0,0 +1,106 @@
+#include "Crc32c.h"
+#include "CpuFeatures.h"
+#include <cstring>
+
+#if defined(PX_SIMD_X86)
+#include <nmmintrin.h>
+#endif
+
+namespace px {
+
+const static uint32_t CRC32C_POLYNOMIAL = 0x82F63B78;  // reflected 0x1EDC6F41
+
+/* Slicing-by-8: table[k][b] is the CRC of byte b followed by k zero bytes. */
+struct Crc32cTable {
+	uint32_t table[8][256];
+
+	Crc32cTable() {
+		for ( uint32_t b = 0; b < 256; b++ ) {
+			uint32_t crc = b;
+			for ( int bit = 0; bit < 8; bit++ )
+				crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLYNOMIAL : (crc >> 1);
+			this->table[0][b] = crc;
+		}
+
+		for ( uint32_t b = 0; b < 256; b++ )
+			for ( int k = 1; k < 8; k++ )
+				this->table[k][b] = (this->table[k - 1][b] >> 8) ^ this->table[0][this->table[k - 1][b] & 0xFF];
+	}
+};
+
+static const Crc32cTable& GetCrc32cTable() {
+	static const Crc32cTable table;
+	return table;
+}
+
+uint32_t Crc32cPortable(const void* data, std::size_t length, uint32_t crc) {
+	const uint32_t (*table)[256] = GetCrc32cTable().table;
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+	crc = ~crc;
+
+	while ( length >= 8 ) {
+		uint32_t low, high;
+		std::memcpy(&low, bytes, sizeof(uint32_t));
+		std::memcpy(&high, bytes + 4, sizeof(uint32_t));
+		low ^= crc;
+		crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^ table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24] ^
+			table[3][high & 0xFF] ^ table[2][(high >> 8) & 0xFF] ^ table[1][(high >> 16) & 0xFF] ^ table[0][high >> 24];
+		bytes += 8;
+		length -= 8;
+	}
+
+	while ( length-- != 0 )
+		crc = (crc >> 8) ^ table[0][(crc ^ *bytes++) & 0xFF];
+
+	return ~crc;
+}
+
+#if defined(PX_SIMD_X86)
+PX_TARGET_SSE42 uint32_t Crc32cSSE42(const void* data, std::size_t length, uint32_t crc) {
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+	uint32_t value = ~crc;
+
+#if defined(_M_X64) || defined(__x86_64__)
+	uint64_t value64 = value;
+	while ( length >= 8 ) {
+		uint64_t block;
+		std::memcpy(&block, bytes, sizeof(uint64_t));
+		value64 = _mm_crc32_u64(value64, block);
+		bytes += 8;
+		length -= 8;
+	}
+	value = static_cast<uint32_t>(value64);
+#endif
+
+	while ( length >= 4 ) {
+		uint32_t block;
+		std::memcpy(&block, bytes, sizeof(uint32_t));
+		value = _mm_crc32_u32(value, block);
+		bytes += 4;
+		length -= 4;
+	}
+
+	while ( length-- != 0 )
+		value = _mm_crc32_u8(value, *bytes++);
+
+	return ~value;
+}
+#endif
+
+bool IsCrc32cAccelerated() {
+#if defined(PX_SIMD_X86)
+	return CpuFeatures::Get().sse42;
+#else
+	return false;
+#endif
+}
+
+uint32_t Crc32c(const void* data, std::size_t length, uint32_t crc) {
+#if defined(PX_SIMD_X86)
+	static const bool bAccelerated = IsCrc32cAccelerated();
+	if ( bAccelerated ) return Crc32cSSE42(data, length, crc);
+#endif
+	return Crc32cPortable(data, length, crc);
+}
+
+}
@@ -0,0 +1,25 @@
+#ifndef PX_CRC32C_H
+#define PX_CRC32C_H
+
+#include <cstdint>
+#include <cstddef>
+
+namespace px {
+
+/* CRC-32C (Castagnoli), as used by iSCSI, ext4 and SSE4.2's crc32
+ * instruction. The SSE4.2 kernel is used when the CPU supports it, a
+ * slicing-by-8 table kernel otherwise; both return identical values.
+ *
+ * Checksums can be computed incrementally: pass the previous result as crc
+ * (0 to start).
+ */
+uint32_t Crc32c(const void* data, std::size_t length, uint32_t crc = 0);
+
+/* Table kernel, regardless of the CPU (for testing and comparison). */
+uint32_t Crc32cPortable(const void* data, std::size_t length, uint32_t crc = 0);
+
+bool IsCrc32cAccelerated();
+
+}
+
+#endif
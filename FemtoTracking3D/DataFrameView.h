@@ -0,0 +1,172 @@
+#ifndef PX_DATA_FRAME_VIEW_H
+#define PX_DATA_FRAME_VIEW_H
+
+#include <memory>
+#include "DataFrame.h"
+
+namespace px {
+
+/* Non-owning, read-only view of a row-major frame. A view never copies the
+ * frame data; it only references memory owned by someone else, such as a
+ * DataFrame or a buffer handed out by the camera SDK (e.g. an ob::Frame).
+ *
+ * The optional owner handle keeps the referenced memory alive for as long
+ * as the view (or any copy of it) exists. Views constructed from raw
+ * pointers or DataFrame references without an owner are only valid while
+ * the source is alive and unmodified.
+ */
+template <typename DataType>
+class DataFrameView {
+public:
+	DataFrameView();
+	DataFrameView(const DataType* data, std::size_t width, std::size_t height, std::size_t timestamp = 0, const std::shared_ptr<const void>& owner = nullptr);
+	DataFrameView(const DataFrame<DataType>& data_frame);
+	template <class FrameType>
+	DataFrameView(const std::shared_ptr<FrameType>& data_frame);
+
+	bool isValid() const;
+	bool reset();
+
+	/* Materializes the view into an owning frame (the only copying call). */
+	bool copyTo(DataFrame<DataType>& data_frame) const;
+
+	std::size_t width() const;
+	std::size_t height() const;
+	std::size_t size() const;
+	std::size_t getTimestamp() const;
+
+	const DataType* constData() const;
+	const DataType* row(std::size_t i) const;
+	const std::shared_ptr<const void>& getOwner() const;
+
+	/* Unchecked element access, use validIndex when the index is untrusted. */
+	const DataType& operator () (std::size_t i, std::size_t j) const;
+	bool validIndex(int i, int j) const;
+
+protected:
+	const DataType* data;
+	std::size_t w, h;
+	std::size_t stamp;
+	std::shared_ptr<const void> owner;
+};
+
+/* Organized clouds are frames of points, a cloud view is a frame view. */
+template <typename PointType>
+using OrganizedCloudView = DataFrameView<PointType>;
+
+//------------------------------------------------------------------------------
+// Implementation
+//------------------------------------------------------------------------------
+template <typename DataType>
+DataFrameView<DataType>::DataFrameView() {
+	this->data = nullptr;
+	this->w = 0;
+	this->h = 0;
+	this->stamp = 0;
+	this->owner = nullptr;
+}
+
+template <typename DataType>
+DataFrameView<DataType>::DataFrameView(const DataType* data, std::size_t width, std::size_t height, std::size_t timestamp, const std::shared_ptr<const void>& owner) {
+	this->data = data;
+	this->w = width;
+	this->h = height;
+	this->stamp = timestamp;
+	this->owner = owner;
+}
+
+template <typename DataType>
+DataFrameView<DataType>::DataFrameView(const DataFrame<DataType>& data_frame) {
+	this->data = data_frame.constData();
+	this->w = data_frame.width();
+	this->h = data_frame.height();
+	this->stamp = data_frame.getTimestamp();
+	this->owner = nullptr;
+}
+
+template <typename DataType>
+template <class FrameType>
+DataFrameView<DataType>::DataFrameView(const std::shared_ptr<FrameType>& data_frame) : DataFrameView() {
+	if ( data_frame == nullptr ) return;
+	this->data = data_frame->constData();
+	this->w = data_frame->width();
+	this->h = data_frame->height();
+	this->stamp = data_frame->getTimestamp();
+	this->owner = data_frame;
+}
+
+template <typename DataType>
+bool DataFrameView<DataType>::isValid() const {
+	if ( this->data == nullptr ) return false;
+	if ( this->w == 0 || this->h == 0 ) return false;
+	return true;
+}
+
+template <typename DataType>
+bool DataFrameView<DataType>::reset() {
+	this->data = nullptr;
+	this->w = 0;
+	this->h = 0;
+	this->stamp = 0;
+	this->owner = nullptr;
+	return true;
+}
+
+template <typename DataType>
+bool DataFrameView<DataType>::copyTo(DataFrame<DataType>& data_frame) const {
+	if ( this->isValid() == false ) return false;
+	if ( data_frame.copy(this->data, this->w, this->h) == false ) return false;
+	data_frame.setTimestamp(this->stamp);
+	return true;
+}
+
+template <typename DataType>
+std::size_t DataFrameView<DataType>::width() const {
+	return this->w;
+}
+
+template <typename DataType>
+std::size_t DataFrameView<DataType>::height() const {
+	return this->h;
+}
+
+template <typename DataType>
+std::size_t DataFrameView<DataType>::size() const {
+	return this->w * this->h;
+}
+
+template <typename DataType>
+std::size_t DataFrameView<DataType>::getTimestamp() const {
+	return this->stamp;
+}
+
+template <typename DataType>
+const DataType* DataFrameView<DataType>::constData() const {
+	return this->data;
+}
+
+template <typename DataType>
+const DataType* DataFrameView<DataType>::row(std::size_t i) const {
+	if ( this->data == nullptr || i >= this->h ) return nullptr;
+	return this->data + i * this->w;
+}
+
+template <typename DataType>
+const std::shared_ptr<const void>& DataFrameView<DataType>::getOwner() const {
+	return this->owner;
+}
+
+template <typename DataType>
+const DataType& DataFrameView<DataType>::operator () (std::size_t i, std::size_t j) const {
+	return this->data[i * this->w + j];
+}
+
+template <typename DataType>
+bool DataFrameView<DataType>::validIndex(int i, int j) const {
+	if ( i >= 0 && j >= 0 && i < this->h && j < this->w ) return true;
+	return false;
+}
+
+}
+
+#endif
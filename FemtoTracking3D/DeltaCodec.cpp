@@ -0,0 +1,301 @@
+#include "DeltaCodec.h"
+#include <cstring>
+#include <limits>
+
+namespace px {
+
+const static std::size_t NO_FRAME = std::numeric_limits<std::size_t>::max();
+
+inline uint32_t ZigZag(uint16_t residual) {
+	int16_t value = static_cast<int16_t>(residual);
+	return static_cast<uint16_t>((static_cast<uint16_t>(value) << 1) ^ static_cast<uint16_t>(value >> 15));
+}
+
+inline uint16_t UnZigZag(uint32_t value) {
+	uint16_t v = static_cast<uint16_t>(value);
+	return static_cast<uint16_t>((v >> 1) ^ static_cast<uint16_t>(0 - (v & 1)));
+}
+
+DeltaCodec::DeltaCodec(std::size_t stride) {
+	this->stride = (stride == 0) ? 1 : stride;
+}
+
+bool DeltaCodec::encode(const uint16_t* samples, std::size_t count, bool bKeyframe, std::vector<uint8_t>& out) {
+	if ( samples == nullptr ) return false;
+	if ( bKeyframe == false && this->hasReference(count) == false ) return false;
+
+	out.clear();
+	out.reserve(count);
+	const uint16_t* ref = this->reference.data();
+	std::size_t run = 0;
+
+	for ( std::size_t i = 0; i < count; i++ ) {
+		uint16_t prediction;
+		if ( bKeyframe ) prediction = (i >= this->stride) ? samples[i - this->stride] : 0;
+		else prediction = ref[i];
+
+		uint16_t residual = static_cast<uint16_t>(samples[i] - prediction);
+		if ( residual == 0 ) {
+			run++;
+			continue;
+		}
+
+		if ( run != 0 ) {
+			PutVarint(out, static_cast<uint32_t>((run << 1) | 1));
+			run = 0;
+		}
+
+		PutVarint(out, ZigZag(residual) << 1);
+	}
+
+	if ( run != 0 ) PutVarint(out, static_cast<uint32_t>((run << 1) | 1));
+
+	this->reference.assign(samples, samples + count);
+	return true;
+}
+
+bool DeltaCodec::decode(const uint8_t* data, std::size_t length, bool bKeyframe, uint16_t* samples, std::size_t count) {
+	if ( data == nullptr || samples == nullptr ) return false;
+	if ( bKeyframe == false && this->hasReference(count) == false ) return false;
+
+	const uint16_t* ref = this->reference.data();
+	std::size_t position = 0;
+	std::size_t i = 0;
+
+	while ( i < count ) {
+		uint32_t token;
+		if ( GetVarint(data, length, position, token) == false ) return false;
+
+		if ( token & 1 ) {
+			std::size_t run = token >> 1;
+			if ( run > count - i ) return false;
+
+			for ( std::size_t end = i + run; i < end; i++ ) {
+				if ( bKeyframe ) samples[i] = (i >= this->stride) ? samples[i - this->stride] : 0;
+				else samples[i] = ref[i];
+			}
+		}
+		else {
+			uint16_t prediction;
+			if ( bKeyframe ) prediction = (i >= this->stride) ? samples[i - this->stride] : 0;
+			else prediction = ref[i];
+
+			samples[i] = static_cast<uint16_t>(prediction + UnZigZag(token >> 1));
+			i++;
+		}
+	}
+
+	this->reference.assign(samples, samples + count);
+	return true;
+}
+
+bool DeltaCodec::reset() {
+	this->reference.clear();
+	return true;
+}
+
+bool DeltaCodec::hasReference(std::size_t count) const {
+	return this->reference.size() == count && count != 0;
+}
+
+bool DeltaCodec::setStride(std::size_t stride) {
+	if ( stride == 0 ) return false;
+	this->stride = stride;
+	return true;
+}
+
+std::size_t DeltaCodec::getStride() const {
+	return this->stride;
+}
+
+bool DeltaFrameHeader::parse(const uint8_t* data, std::size_t length) {
+	if ( data == nullptr || length < DELTA_FRAME_PREFIX_SIZE ) return false;
+
+	std::size_t offset = 0;
+	std::memcpy(&this->width, data + offset, sizeof(uint32_t)); offset += sizeof(uint32_t);
+	std::memcpy(&this->height, data + offset, sizeof(uint32_t)); offset += sizeof(uint32_t);
+	std::memcpy(&this->timestamp, data + offset, sizeof(uint64_t)); offset += sizeof(uint64_t);
+	std::memcpy(&this->kind, data + offset, sizeof(uint32_t)); offset += sizeof(uint32_t);
+	std::memcpy(this->bounds, data + offset, sizeof(this->bounds)); offset += sizeof(this->bounds);
+	std::memcpy(&this->payload_length, data + offset, sizeof(uint32_t));
+
+	if ( DELTA_FRAME_PREFIX_SIZE + std::size_t(this->payload_length) > length ) return false;
+	return true;
+}
+
+bool DeltaFrameHeader::store(uint8_t* data) const {
+	std::size_t offset = 0;
+	std::memcpy(data + offset, &this->width, sizeof(uint32_t)); offset += sizeof(uint32_t);
+	std::memcpy(data + offset, &this->height, sizeof(uint32_t)); offset += sizeof(uint32_t);
+	std::memcpy(data + offset, &this->timestamp, sizeof(uint64_t)); offset += sizeof(uint64_t);
+	std::memcpy(data + offset, &this->kind, sizeof(uint32_t)); offset += sizeof(uint32_t);
+	std::memcpy(data + offset, this->bounds, sizeof(this->bounds)); offset += sizeof(this->bounds);
+	std::memcpy(data + offset, &this->payload_length, sizeof(uint32_t));
+	return true;
+}
+
+inline std::size_t CodecStride(SerializeType type) {
+	return (type == SERIALIZE_COMPRESSED) ? std::size_t(DIM3) : std::size_t(1);
+}
+
+DeltaFrameEncoder::DeltaFrameEncoder() {
+	this->type = SERIALIZE_COMPRESSED;
+	this->keyframe_interval = 0;
+	this->frame_count = 0;
+}
+
+bool DeltaFrameEncoder::configure(SerializeType type, std::size_t keyframe_interval) {
+	if ( type != SERIALIZE_COMPRESSED && type != SERIALIZE_DEPTH ) {
+		std::cerr << "[DeltaFrameEncoder:configure] Error: Delta coding needs SERIALIZE_COMPRESSED or SERIALIZE_DEPTH samples." << std::endl;
+		return false;
+	}
+
+	if ( keyframe_interval == 0 ) return false;
+
+	this->type = type;
+	this->keyframe_interval = keyframe_interval;
+	this->codec.setStride(CodecStride(type));
+	return this->reset();
+}
+
+bool DeltaFrameEncoder::encode(const DepthCloud& cloud, std::vector<uint8_t>& frame_data) {
+	if ( this->keyframe_interval == 0 ) return false;
+
+	std::size_t count = DepthCloud::SampleCount(cloud.width(), cloud.height(), this->type);
+	if ( this->samples.size() != count ) this->samples.resize(count);
+	if ( cloud.quantize(this->samples.data(), this->type) == false ) return false;
+
+	bool bKeyframe = (this->frame_count % this->keyframe_interval) == 0 || this->codec.hasReference(count) == false;
+	if ( this->codec.encode(this->samples.data(), count, bKeyframe, this->payload) == false ) return false;
+
+	DeltaFrameHeader header;
+	header.width = static_cast<uint32_t>(cloud.width());
+	header.height = static_cast<uint32_t>(cloud.height());
+	header.timestamp = static_cast<uint64_t>(cloud.getTimestamp());
+	header.kind = bKeyframe ? DELTA_KEYFRAME : DELTA_INTERFRAME;
+	header.bounds[0] = cloud.getMinDistance();
+	header.bounds[1] = cloud.getMaxDistance();
+	header.bounds[2] = cloud.getMinRange();
+	header.bounds[3] = cloud.getMaxRange();
+	header.payload_length = static_cast<uint32_t>(this->payload.size());
+
+	frame_data.resize(DELTA_FRAME_PREFIX_SIZE + this->payload.size());
+	header.store(frame_data.data());
+	if ( this->payload.size() != 0 ) std::memcpy(frame_data.data() + DELTA_FRAME_PREFIX_SIZE, this->payload.data(), this->payload.size());
+
+	this->frame_count++;
+	return true;
+}
+
+bool DeltaFrameEncoder::write(const DepthCloud& cloud, BinaryFileWriter& out) {
+	if ( out.isOpen() == false ) return false;
+	if ( this->encode(cloud, this->frame) == false ) return false;
+	return out.writeBuffer(this->frame.data(), this->frame.size());
+}
+
+bool DeltaFrameEncoder::reset() {
+	this->frame_count = 0;
+	return this->codec.reset();
+}
+
+std::size_t DeltaFrameEncoder::getFrameCount() const {
+	return this->frame_count;
+}
+
+std::size_t DeltaFrameEncoder::getKeyframeInterval() const {
+	return this->keyframe_interval;
+}
+
+DeltaFrameDecoder::DeltaFrameDecoder() {
+	this->type = SERIALIZE_COMPRESSED;
+	this->keyframe_interval = 0;
+	this->decoded_frame = NO_FRAME;
+	this->decoded_header = DeltaFrameHeader();
+}
+
+bool DeltaFrameDecoder::configure(SerializeType type, std::size_t keyframe_interval) {
+	if ( type != SERIALIZE_COMPRESSED && type != SERIALIZE_DEPTH ) return false;
+	if ( keyframe_interval == 0 ) return false;
+
+	this->type = type;
+	this->keyframe_interval = keyframe_interval;
+	this->codec.setStride(CodecStride(type));
+	return this->reset();
+}
+
+bool DeltaFrameDecoder::reset() {
+	this->decoded_frame = NO_FRAME;
+	return this->codec.reset();
+}
+
+std::size_t DeltaFrameDecoder::getKeyframe(std::size_t frame) const {
+	if ( this->keyframe_interval == 0 ) return frame;
+	return frame - (frame % this->keyframe_interval);
+}
+
+/* Steps back from the keyframe the interval predicts until a frame is
+ * really a keyframe (frame numbers shift when damaged frames are removed).
+ */
+std::size_t DeltaFrameDecoder::findKeyframe(std::size_t frame, const FrameSource& source) {
+	std::size_t keyframe = this->getKeyframe(frame);
+
+	while ( keyframe > 0 ) {
+		std::size_t length = 0;
+		const uint8_t* data = source(keyframe, length);
+		DeltaFrameHeader header;
+		if ( header.parse(data, length) && header.kind == DELTA_KEYFRAME ) break;
+		keyframe--;
+	}
+
+	return keyframe;
+}
+
+bool DeltaFrameDecoder::decodeSamples(std::size_t frame, const FrameSource& source) {
+	std::size_t length = 0;
+	const uint8_t* data = source(frame, length);
+
+	DeltaFrameHeader header;
+	if ( header.parse(data, length) == false ) {
+		std::cerr << "[DeltaFrameDecoder:decode] Error: Frame " << frame << " is truncated." << std::endl;
+		this->reset();
+		return false;
+	}
+
+	std::size_t count = DepthCloud::SampleCount(header.width, header.height, this->type);
+	if ( this->samples.size() != count ) this->samples.resize(count);
+
+	bool bKeyframe = header.kind == DELTA_KEYFRAME;
+	if ( this->codec.decode(data + DELTA_FRAME_PREFIX_SIZE, header.payload_length, bKeyframe, this->samples.data(), count) == false ) {
+		std::cerr << "[DeltaFrameDecoder:decode] Error: Frame " << frame << " could not be decoded." << std::endl;
+		this->reset();
+		return false;
+	}
+
+	this->decoded_frame = frame;
+	this->decoded_header = header;
+	return true;
+}
+
+bool DeltaFrameDecoder::decode(std::size_t frame, const FrameSource& source, DepthCloud& cloud) {
+	if ( this->keyframe_interval == 0 ) return false;
+
+	if ( this->decoded_frame != frame ) {
+		// Continuing from a recently decoded frame is valid (every frame predicts from its predecessor) and avoids the keyframe search.
+		std::size_t start = 0;
+		if ( this->decoded_frame != NO_FRAME && this->decoded_frame < frame && frame - this->decoded_frame <= this->keyframe_interval )
+			start = this->decoded_frame + 1;
+		else start = this->findKeyframe(frame, source);
+
+		for ( std::size_t i = start; i <= frame; i++ )
+			if ( this->decodeSamples(i, source) == false ) return false;
+	}
+
+	const DeltaFrameHeader& header = this->decoded_header;
+	cloud.setDistanceBounds(header.bounds[0], header.bounds[1]);
+	cloud.setRangeBounds(header.bounds[2], header.bounds[3]);
+	if ( cloud.dequantize(this->samples.data(), header.width, header.height, this->type) == false ) return false;
+	cloud.setTimestamp(static_cast<std::size_t>(header.timestamp));
+	return true;
+}
+
+}
@@ -0,0 +1,142 @@
+#ifndef PX_DELTA_CODEC_H
+#define PX_DELTA_CODEC_H
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include "DepthCloud.h"
+
+namespace px {
+
+/* LEB128 varints: 7 bits per byte, low bits first, high bit = more bytes
+ * follow. GetVarint advances position and fails on truncated input.
+ */
+inline void PutVarint(std::vector<uint8_t>& out, uint32_t value) {
+	while ( value >= 0x80 ) {
+		out.push_back(static_cast<uint8_t>(value | 0x80));
+		value >>= 7;
+	}
+
+	out.push_back(static_cast<uint8_t>(value));
+}
+
+inline bool GetVarint(const uint8_t* data, std::size_t length, std::size_t& position, uint32_t& value) {
+	value = 0;
+	for ( uint32_t shift = 0; shift < 32; shift += 7 ) {
+		if ( position >= length ) return false;
+		uint8_t byte = data[position++];
+		value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+		if ( (byte & 0x80) == 0 ) return true;
+	}
+
+	return false;
+}
+
+/* Lossless inter-frame codec for 16-bit sample streams (quantized or native
+ * depth samples, see DepthCloud::quantize).
+ *
+ * Every sample is predicted, from the same sample of the previous frame
+ * (inter frames) or from the sample one stride earlier in the same frame
+ * (keyframes). Residuals are zigzag mapped and written as varint tokens:
+ * a token with the low bit clear is a residual, a token with the low bit
+ * set is a run of zero residuals. Static scene content (the bulk of a room)
+ * collapses into a few bytes per run.
+ */
+class DeltaCodec {
+public:
+	DeltaCodec(std::size_t stride = 1);
+
+	bool encode(const uint16_t* samples, std::size_t count, bool bKeyframe, std::vector<uint8_t>& out);
+	bool decode(const uint8_t* data, std::size_t length, bool bKeyframe, uint16_t* samples, std::size_t count);
+
+	/* Drops the reference frame, the next frame must be a keyframe. */
+	bool reset();
+	bool hasReference(std::size_t count) const;
+	bool setStride(std::size_t stride);
+	std::size_t getStride() const;
+
+protected:
+	std::vector<uint16_t> reference;
+	std::size_t stride;
+};
+
+/* Frame layout of delta coded recordings:
+ *   w, h (uint32), stamp (uint64), kind (uint32), compression bounds (4 x float),
+ *   payload length (uint32), payload (DeltaCodec tokens)
+ */
+enum DeltaFrameKind {
+	DELTA_KEYFRAME = 0,
+	DELTA_INTERFRAME = 1
+};
+
+const static std::size_t DELTA_FRAME_PREFIX_SIZE = 2 * sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint32_t) + 4 * sizeof(float) + sizeof(uint32_t);
+
+struct DeltaFrameHeader {
+	uint32_t width;
+	uint32_t height;
+	uint64_t timestamp;
+	uint32_t kind;
+	float bounds[4];
+	uint32_t payload_length;
+
+	bool parse(const uint8_t* data, std::size_t length);
+	bool store(uint8_t* data) const;
+};
+
+/* Writes clouds as delta frames, a keyframe every keyframe_interval frames. */
+class DeltaFrameEncoder {
+public:
+	DeltaFrameEncoder();
+
+	bool configure(SerializeType type, std::size_t keyframe_interval);
+
+	/* Encodes the next frame into memory (the bytes write() stores). */
+	bool encode(const DepthCloud& cloud, std::vector<uint8_t>& frame_data);
+	bool write(const DepthCloud& cloud, BinaryFileWriter& out);
+	bool reset();
+
+	std::size_t getFrameCount() const;
+	std::size_t getKeyframeInterval() const;
+
+protected:
+	DeltaCodec codec;
+	SerializeType type;
+	std::size_t keyframe_interval;
+	std::size_t frame_count;
+	std::vector<uint16_t> samples;
+	std::vector<uint8_t> payload;
+	std::vector<uint8_t> frame;
+};
+
+/* Random access decoding of delta frames. A frame is rebuilt from the
+ * closest preceding keyframe; sequential reads only decode each frame once.
+ * The keyframe interval is a hint: salvaged recordings may have lost frames,
+ * so the frame kinds are checked. The source returns the bytes of a frame (and their length) by number.
+ */
+class DeltaFrameDecoder {
+public:
+	typedef std::function<const uint8_t* (std::size_t frame, std::size_t& length)> FrameSource;
+
+	DeltaFrameDecoder();
+
+	bool configure(SerializeType type, std::size_t keyframe_interval);
+	bool decode(std::size_t frame, const FrameSource& source, DepthCloud& cloud);
+	bool reset();
+
+	std::size_t getKeyframe(std::size_t frame) const;
+
+protected:
+	bool decodeSamples(std::size_t frame, const FrameSource& source);
+	std::size_t findKeyframe(std::size_t frame, const FrameSource& source);
+
+	DeltaCodec codec;
+	SerializeType type;
+	std::size_t keyframe_interval;
+	std::size_t decoded_frame;
+	DeltaFrameHeader decoded_header;
+	std::vector<uint16_t> samples;
+};
+
+}
+
+#endif
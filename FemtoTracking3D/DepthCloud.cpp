@@ -1,234 +1,647 @@
-#include "DepthCloud.h"
-
-namespace px {
-
-const static Real DEFAULT_MIN_DIST = Real(0);
-const static Real DEFAULT_MAX_DIST = Real(8);
-const static Real DEFAULT_MIN_RANGE = Real(0);
-const static Real DEFAULT_MAX_RANGE = Real(8);
-const static int16_t COMP_SHORT = 32767;
-
-DepthCloud::DepthCloud() : OrganizedCloud<PointXYZ<Real> >() {
-	this->min_distance = DEFAULT_MIN_DIST;
-	this->max_distance = DEFAULT_MAX_DIST;
-	this->min_range = DEFAULT_MIN_RANGE;
-	this->max_range = DEFAULT_MAX_RANGE;
-}
-
-DepthCloud::DepthCloud(std::size_t width, std::size_t height) : OrganizedCloud<PointXYZ<Real> >(width, height) {
-	this->min_distance = DEFAULT_MIN_DIST;
-	this->max_distance = DEFAULT_MAX_DIST;
-	this->min_range = DEFAULT_MIN_RANGE;
-	this->max_range = DEFAULT_MAX_RANGE;
-}
-
-DepthCloud::~DepthCloud() {}
-
-bool DepthCloud::setDistanceBounds(Real min, Real max) {
-	this->min_distance = min;
-	this->max_distance = max;
-	if ( this->min_distance < 0 ) return false;
-	if ( this->max_distance < 0 || this->max_distance < this->min_distance ) return false;
-	return true;
-}
-
-bool DepthCloud::setRangeBounds(Real min, Real max) {
-	this->min_range = min;
-	this->max_range = max;
-	if ( this->min_range < 0 ) return false;
-	if ( this->max_range < 0 || this->max_range < this->min_range ) return false;
-	return true;
-}
-
-bool DepthCloud::serialize(BinaryFileWriter& out, SerializeType type) {
-	if ( out.isOpen() == false ) return false;
-	if ( this->data == nullptr ) return false;
-
-	out.writeUInt32(static_cast<uint32_t>(this->w));
-	out.writeUInt32(static_cast<uint32_t>(this->h));
-	out.writeUInt64(static_cast<uint64_t>(this->stamp));
-
-	PointXYZ<Real>* point_data = this->data;
-	std::ofstream& stream = out.getStream();
-	std::size_t n = this->w * this->h;
-
-	if ( type == SERIALIZE_DEFAULT || type == SERIALIZE_RAW ) {
-		stream.write(reinterpret_cast<char*>(point_data), n * sizeof(PointXYZ<Real>));
-		return true;
-	}
-
-	out.writeFloat(this->min_distance);
-	out.writeFloat(this->max_distance);
-	out.writeFloat(this->min_range);
-	out.writeFloat(this->max_range);
-
-	Real x, y, z;
-    int16_t ux, uy, uz;
-
-	if ( this->compressed.size() != n ) this->compressed.resize(n * DIM3);
-	int16_t* compressed_data = &this->compressed[0];
-
-	std::size_t index = 0;
-	constexpr Real comp = Real(COMP_SHORT);
-	const Real m_xy = Real(1) / Real(this->max_range - this->min_range);
-	const Real m_z = Real(1) / Real(this->max_distance - this->min_distance);
-
-    for ( std::size_t i = 0; i < n; ++i ) {
-        x = this->data[i].x;
-		y = this->data[i].y;
-		z = this->data[i].z;
-
-		x = ((x - this->min_range) * m_xy);
-		y = ((y - this->min_range) * m_xy);
-		z = ((z - this->min_distance) * m_z);
-
-        ux = int16_t(x * comp);
-        uy = int16_t(y * comp);
-        uz = int16_t(z * comp);
-
-		compressed_data[index] = ux;
-		compressed_data[index+1] = uy;
-		compressed_data[index+2] = uz;
-
-		index += DIM3;
-    }
-
-	stream.write(reinterpret_cast<char*>(compressed_data), n * DIM3 * sizeof(int16_t));
-
-	return true;
-}
-
-bool DepthCloud::deserialize(BinaryFileReader& in, SerializeType type) {
-	if ( in.isOpen() == false ) return false;
-
-	uint32_t width = in.readUInt32();
-	uint32_t height = in.readUInt32();
-	uint64_t timestamp = in.readUInt64();
-
-	this->w = width;
-	this->h = height;
-	this->stamp = timestamp;
-
-	std::size_t n = this->w * this->h;
-	std::ifstream& stream = in.getStream();
-
-	if ( type == SERIALIZE_DEFAULT || type == SERIALIZE_RAW ) {
-		this->w = width;
-		this->h = height;
-		this->stamp = timestamp;
-		if ( this->data != nullptr ) delete [] this->data;
-		this->data = new PointXYZ<Real>[this->w * this->h];
-
-		stream.read(reinterpret_cast<char*>(this->data), n * sizeof(PointXYZ<Real>));
-		return true;
-	}
-
-	this->min_distance = in.readFloat();
-	this->max_distance = in.readFloat();
-	this->min_range = in.readFloat();
-	this->max_range = in.readFloat();
-	
-	if ( this->data != nullptr ) delete [] this->data;
-	this->data = new PointXYZ<Real>[this->w * this->h];
-
-	Real x, y, z;
-	int16_t ux, uy, uz;
-	constexpr Real inv_comp = Real(1) / Real(COMP_SHORT);
-
-	if ( this->compressed.size() == 0 ) this->compressed.resize(this->w * this->h * DIM3);
-	int16_t* compressed_data = &this->compressed[0];
-	stream.read(reinterpret_cast<char*>(compressed_data), n * DIM3 * sizeof(int16_t));
-
-	const Real m_xy = (this->max_range - this->min_range);
-	const Real m_z = (this->max_distance - this->min_distance);
-	
-	std::size_t index = 0;
-	for ( std::size_t i = 0; i < n; ++i ) {
-		ux = compressed_data[index];
-		uy = compressed_data[index+1];
-		uz = compressed_data[index+2];
-
-		x = Real(ux * inv_comp);
-		y = Real(uy * inv_comp);
-		z = Real(uz * inv_comp);
-
-		x = this->min_range + (x * m_xy);
-		y = this->min_range + (y * m_xy);
-		z = this->min_distance + (z * m_z);
-
-		this->data[i].x = x;
-		this->data[i].y = y;
-		this->data[i].z = z;
-
-		index += DIM3;
-    }
-
-	return true;
-}
-
-bool DepthCloud::scale(Real uniform_scale) {
-	if ( this->data == nullptr ) return false;
-	std::size_t n = this->w * this->h;
-	for ( std::size_t i = 0; i < n; i++ ) {
-		auto& p = this->data[i];
-		p.x *= uniform_scale;
-		p.y *= uniform_scale;
-		p.z *= uniform_scale;
-	}
-	return true;
-}
-
-Real DepthCloud::getMinDepth() const {
-	if ( this->data == nullptr ) return Real(0);
-	Real min = std::numeric_limits<Real>::max();
-	for ( std::size_t i = 0; i < this->w * this->h; i++ )
-		if ( this->data[i].z < min ) min = this->data[i].z;
-	return min;
-}
-
-Real DepthCloud::getMaxDepth() const {
-	if ( this->data == nullptr ) return Real(0);
-	Real max = std::numeric_limits<Real>::min();
-	for ( std::size_t i = 0; i < this->w * this->h; i++ )
-		if ( this->data[i].z > max ) max = this->data[i].z;
-	return max;
-}
-
-Real DepthCloud::getMinDistance() const {
-	return this->min_distance;
-}
-
-Real DepthCloud::getMaxDistance() const {
-	return this->max_distance;
-}
-
-Real DepthCloud::getMinRange() const {
-	return this->min_range;
-}
-
-Real DepthCloud::getMaxRange() const {
-	return this->max_range;
-}
-
-bool DepthCloud::Load(const std::string& filename, std::vector<std::shared_ptr<DepthCloud> >& clouds) {
-	if ( filename.length() == 0 ) return false;
-
-	BinaryFileReader in;
-	in.open(filename);
-	
-	if ( in.isOpen() == false ) {
-		std::cerr << "[DepthCloud:Load] Error: Could not open: " << filename << std::endl;
-		return false;
-	}
-
-	while ( in.hasNext() ) {
-		std::shared_ptr<DepthCloud> cloud = std::make_shared<DepthCloud>();
-		cloud->deserialize(in);
-		clouds.push_back(cloud);
-	}
-
-	in.close();
-	return true;
-}
-
-}
+#include "DepthCloud.h"
+#include "RecordingReader.h"
+#include "Quantize.h"
+
+namespace px {
+
+const static Real DEFAULT_MIN_DIST = Real(0);
+const static Real DEFAULT_MAX_DIST = Real(8);
+const static Real DEFAULT_MIN_RANGE = Real(0);
+const static Real DEFAULT_MAX_RANGE = Real(8);
+const static int16_t COMP_SHORT = 32767;
+const static std::size_t FRAME_HEADER_SIZE = 2 * sizeof(uint32_t) + sizeof(uint64_t);
+
+static_assert(sizeof(PointXYZ<Real>) == DIM3 * sizeof(Real), "PointXYZ must be tightly packed.");
+
+typedef OrganizedCloud<PointXYZ<Real>, InterleavedStorage> InterleavedDepthPoints;
+typedef OrganizedCloud<PointXYZ<Real>, PlanarStorage> PlanarDepthPoints;
+
+/* Layout specific passes of BasicDepthCloud, one overload per storage policy.
+ * The serialized bytes are the same for both layouts: raw frames hold the
+ * interleaved points and compressed frames interleaved int16 triplets.
+ */
+inline bool DepthCloudHasPoints(const InterleavedDepthPoints& cloud) {
+	return cloud.constData() != nullptr;
+}
+
+inline bool DepthCloudHasPoints(const PlanarDepthPoints& cloud) {
+	return cloud.constZData() != nullptr;
+}
+
+inline void DepthCloudStorePoints(const InterleavedDepthPoints& cloud, uint8_t* dst) {
+	std::memcpy(dst, cloud.constData(), cloud.size() * sizeof(PointXYZ<Real>));
+}
+
+inline void DepthCloudStorePoints(const PlanarDepthPoints& cloud, uint8_t* dst) {
+	const Real* x = cloud.constXData();
+	const Real* y = cloud.constYData();
+	const Real* z = cloud.constZData();
+	std::size_t n = cloud.size();
+
+	for ( std::size_t i = 0; i < n; i++ ) {
+		const Real point[DIM3] = { x[i], y[i], z[i] };
+		std::memcpy(dst + i * sizeof(point), point, sizeof(point));
+	}
+}
+
+inline void DepthCloudLoadPoints(InterleavedDepthPoints& cloud, const uint8_t* src) {
+	std::memcpy(cloud.getData(), src, cloud.size() * sizeof(PointXYZ<Real>));
+}
+
+inline void DepthCloudLoadPoints(PlanarDepthPoints& cloud, const uint8_t* src) {
+	Real* x = cloud.xData();
+	Real* y = cloud.yData();
+	Real* z = cloud.zData();
+	std::size_t n = cloud.size();
+
+	for ( std::size_t i = 0; i < n; i++ ) {
+		Real point[DIM3];
+		std::memcpy(point, src + i * sizeof(point), sizeof(point));
+		x[i] = point[X];
+		y[i] = point[Y];
+		z[i] = point[Z];
+	}
+}
+
+inline bool DepthCloudProject(const RayTable& rays, const InterleavedDepthPoints& cloud, uint16_t* depth) {
+	return rays.project(cloud.constData(), depth, cloud.size());
+}
+
+inline bool DepthCloudProject(const RayTable& rays, const PlanarDepthPoints& cloud, uint16_t* depth) {
+	return rays.project(cloud.constZData(), depth, cloud.size());
+}
+
+inline bool DepthCloudReconstruct(const RayTable& rays, const uint16_t* depth, InterleavedDepthPoints& cloud) {
+	return rays.reconstruct(depth, cloud.getData(), cloud.size());
+}
+
+inline bool DepthCloudReconstruct(const RayTable& rays, const uint16_t* depth, PlanarDepthPoints& cloud) {
+	return rays.reconstruct(depth, cloud.xData(), cloud.yData(), cloud.zData(), cloud.size());
+}
+
+inline void DepthCloudQuantize(const InterleavedDepthPoints& cloud, int16_t* dst, const Real offset[DIM3], const Real scale[DIM3]) {
+	QuantizeXYZ(reinterpret_cast<const Real*>(cloud.constData()), dst, cloud.size(), offset, scale);
+}
+
+inline void DepthCloudQuantize(const PlanarDepthPoints& cloud, int16_t* dst, const Real offset[DIM3], const Real scale[DIM3]) {
+	const Real* const planes[DIM3] = { cloud.constXData(), cloud.constYData(), cloud.constZData() };
+	QuantizePlanarXYZ(planes, dst, cloud.size(), offset, scale);
+}
+
+inline void DepthCloudDequantize(const int16_t* src, InterleavedDepthPoints& cloud, const Real offset[DIM3], const Real scale[DIM3]) {
+	DequantizeXYZ(src, reinterpret_cast<Real*>(cloud.getData()), cloud.size(), offset, scale);
+}
+
+inline void DepthCloudDequantize(const int16_t* src, PlanarDepthPoints& cloud, const Real offset[DIM3], const Real scale[DIM3]) {
+	Real* const planes[DIM3] = { cloud.xData(), cloud.yData(), cloud.zData() };
+	DequantizePlanarXYZ(src, planes, cloud.size(), offset, scale);
+}
+
+inline bool DepthCloudScale(InterleavedDepthPoints& cloud, Real uniform_scale) {
+	if ( cloud.getData() == nullptr ) return false;
+	// Uniform scaling is component agnostic, treat the points as a flat array.
+	Real* values = reinterpret_cast<Real*>(cloud.getData());
+	std::size_t n = cloud.size() * DIM3;
+	for ( std::size_t i = 0; i < n; i++ )
+		values[i] *= uniform_scale;
+	return true;
+}
+
+inline bool DepthCloudScale(PlanarDepthPoints& cloud, Real uniform_scale) {
+	return cloud.scale(uniform_scale);
+}
+
+inline bool DepthCloudDepthBounds(const InterleavedDepthPoints& cloud, Real& min, Real& max) {
+	const PointXYZ<Real>* points = cloud.constData();
+	if ( points == nullptr ) return false;
+
+	Real curMin = std::numeric_limits<Real>::max();
+	Real curMax = std::numeric_limits<Real>::lowest();
+	for ( std::size_t i = 0; i < cloud.size(); i++ ) {
+		curMin = points[i].z < curMin ? points[i].z : curMin;
+		curMax = points[i].z > curMax ? points[i].z : curMax;
+	}
+
+	min = curMin;
+	max = curMax;
+	return true;
+}
+
+inline bool DepthCloudDepthBounds(const PlanarDepthPoints& cloud, Real& min, Real& max) {
+	return cloud.getDepthBounds(min, max);
+}
+
+template <class StoragePolicy>
+BasicDepthCloud<StoragePolicy>::BasicDepthCloud() : OrganizedCloud<PointXYZ<Real>, StoragePolicy>() {
+	this->min_distance = DEFAULT_MIN_DIST;
+	this->max_distance = DEFAULT_MAX_DIST;
+	this->min_range = DEFAULT_MIN_RANGE;
+	this->max_range = DEFAULT_MAX_RANGE;
+	this->rays = nullptr;
+}
+
+template <class StoragePolicy>
+BasicDepthCloud<StoragePolicy>::BasicDepthCloud(const BasicDepthCloud<StoragePolicy>& cloud) : OrganizedCloud<PointXYZ<Real>, StoragePolicy>(cloud) {
+	this->min_distance = cloud.min_distance;
+	this->max_distance = cloud.max_distance;
+	this->min_range = cloud.min_range;
+	this->max_range = cloud.max_range;
+	this->rays = cloud.rays;
+	this->native_depth = cloud.native_depth;
+}
+
+template <class StoragePolicy>
+BasicDepthCloud<StoragePolicy>::BasicDepthCloud(BasicDepthCloud<StoragePolicy>&& cloud) noexcept : OrganizedCloud<PointXYZ<Real>, StoragePolicy>(std::move(cloud)) {
+	this->min_distance = cloud.min_distance;
+	this->max_distance = cloud.max_distance;
+	this->min_range = cloud.min_range;
+	this->max_range = cloud.max_range;
+	this->rays = std::move(cloud.rays);
+	this->native_depth = std::move(cloud.native_depth);
+	this->compressed = std::move(cloud.compressed);
+}
+
+template <class StoragePolicy>
+BasicDepthCloud<StoragePolicy>::BasicDepthCloud(std::size_t width, std::size_t height) : OrganizedCloud<PointXYZ<Real>, StoragePolicy>(width, height) {
+	this->min_distance = DEFAULT_MIN_DIST;
+	this->max_distance = DEFAULT_MAX_DIST;
+	this->min_range = DEFAULT_MIN_RANGE;
+	this->max_range = DEFAULT_MAX_RANGE;
+	this->rays = nullptr;
+}
+
+template <class StoragePolicy>
+BasicDepthCloud<StoragePolicy>::~BasicDepthCloud() {}
+
+template <class StoragePolicy>
+BasicDepthCloud<StoragePolicy>& BasicDepthCloud<StoragePolicy>::operator = (const BasicDepthCloud<StoragePolicy>& cloud) {
+	if ( this == &cloud ) return *this;
+	OrganizedCloud<PointXYZ<Real>, StoragePolicy>::operator = (cloud);
+	this->min_distance = cloud.min_distance;
+	this->max_distance = cloud.max_distance;
+	this->min_range = cloud.min_range;
+	this->max_range = cloud.max_range;
+	this->rays = cloud.rays;
+	this->native_depth = cloud.native_depth;
+	return *this;
+}
+
+template <class StoragePolicy>
+BasicDepthCloud<StoragePolicy>& BasicDepthCloud<StoragePolicy>::operator = (BasicDepthCloud<StoragePolicy>&& cloud) noexcept {
+	if ( this == &cloud ) return *this;
+	OrganizedCloud<PointXYZ<Real>, StoragePolicy>::operator = (std::move(cloud));
+	this->min_distance = cloud.min_distance;
+	this->max_distance = cloud.max_distance;
+	this->min_range = cloud.min_range;
+	this->max_range = cloud.max_range;
+	this->rays = std::move(cloud.rays);
+	this->native_depth = std::move(cloud.native_depth);
+	this->compressed = std::move(cloud.compressed);
+	return *this;
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::setDistanceBounds(Real min, Real max) {
+	this->min_distance = min;
+	this->max_distance = max;
+	if ( this->min_distance < 0 ) return false;
+	if ( this->max_distance < 0 || this->max_distance < this->min_distance ) return false;
+	return true;
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::setRangeBounds(Real min, Real max) {
+	this->min_range = min;
+	this->max_range = max;
+	if ( this->min_range < 0 ) return false;
+	if ( this->max_range < 0 || this->max_range < this->min_range ) return false;
+	return true;
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::serialize(BinaryFileWriter& out, SerializeType type) {
+	if ( out.isOpen() == false ) return false;
+	if ( DepthCloudHasPoints(*this) == false ) return false;
+
+	out.writeUInt32(static_cast<uint32_t>(this->w));
+	out.writeUInt32(static_cast<uint32_t>(this->h));
+	out.writeUInt64(static_cast<uint64_t>(this->stamp));
+
+	std::ofstream& stream = out.getStream();
+	std::size_t n = this->w * this->h;
+
+	if ( type == SERIALIZE_DEFAULT || type == SERIALIZE_RAW ) {
+		if constexpr ( std::is_same<StoragePolicy, InterleavedStorage>::value ) {
+			stream.write(reinterpret_cast<const char*>(this->constData()), n * sizeof(PointXYZ<Real>));
+		}
+		else {
+			uint8_t* point_data = reinterpret_cast<uint8_t*>(this->scratch(n * sizeof(PointXYZ<Real>) / sizeof(int16_t)));
+			DepthCloudStorePoints(*this, point_data);
+			stream.write(reinterpret_cast<char*>(point_data), n * sizeof(PointXYZ<Real>));
+		}
+		return true;
+	}
+
+	// Depth frames keep the depth only, x and y are rebuilt from the rays on load.
+	if ( type == SERIALIZE_DEPTH ) {
+		if ( this->hasNativeDepth() ) {
+			stream.write(reinterpret_cast<const char*>(this->native_depth.data()), n * sizeof(uint16_t));
+			return true;
+		}
+
+		if ( this->hasRayTable("serialize") == false ) return false;
+		uint16_t* depth_data = reinterpret_cast<uint16_t*>(this->scratch(n));
+		DepthCloudProject(*this->rays, *this, depth_data);
+		stream.write(reinterpret_cast<char*>(depth_data), n * sizeof(uint16_t));
+		return true;
+	}
+
+	out.writeFloat(this->min_distance);
+	out.writeFloat(this->max_distance);
+	out.writeFloat(this->min_range);
+	out.writeFloat(this->max_range);
+
+	int16_t* compressed_data = this->scratch(n * DIM3);
+	this->quantize(reinterpret_cast<uint16_t*>(compressed_data), SERIALIZE_COMPRESSED);
+	stream.write(reinterpret_cast<char*>(compressed_data), n * DIM3 * sizeof(int16_t));
+
+	return true;
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::deserialize(BinaryFileReader& in, SerializeType type) {
+	if ( in.isOpen() == false ) return false;
+
+	uint32_t width = in.readUInt32();
+	uint32_t height = in.readUInt32();
+	uint64_t timestamp = in.readUInt64();
+
+	// Dimensions come from the file: a damaged header must not size the allocation.
+	if ( in.getStream().good() == false || uint64_t(width) * uint64_t(height) > RECORDING_MAX_FRAME_POINTS ) {
+		std::cerr << "[DepthCloud:deserialize] Error: Invalid frame header." << std::endl;
+		return false;
+	}
+
+	if ( this->allocate(width, height) == false ) return false;
+	this->stamp = timestamp;
+	this->native_depth.clear();
+
+	std::size_t n = this->w * this->h;
+	std::ifstream& stream = in.getStream();
+
+	if ( type == SERIALIZE_DEFAULT || type == SERIALIZE_RAW ) {
+		if constexpr ( std::is_same<StoragePolicy, InterleavedStorage>::value ) {
+			stream.read(reinterpret_cast<char*>(this->getData()), n * sizeof(PointXYZ<Real>));
+		}
+		else {
+			uint8_t* point_data = reinterpret_cast<uint8_t*>(this->scratch(n * sizeof(PointXYZ<Real>) / sizeof(int16_t)));
+			stream.read(reinterpret_cast<char*>(point_data), n * sizeof(PointXYZ<Real>));
+			DepthCloudLoadPoints(*this, point_data);
+		}
+		return true;
+	}
+
+	if ( type == SERIALIZE_DEPTH ) {
+		if ( this->hasRayTable("deserialize") == false ) return false;
+		this->native_depth.resize(n);
+		stream.read(reinterpret_cast<char*>(this->native_depth.data()), n * sizeof(uint16_t));
+		return DepthCloudReconstruct(*this->rays, this->native_depth.data(), *this);
+	}
+
+	this->min_distance = in.readFloat();
+	this->max_distance = in.readFloat();
+	this->min_range = in.readFloat();
+	this->max_range = in.readFloat();
+
+	int16_t* compressed_data = this->scratch(n * DIM3);
+	stream.read(reinterpret_cast<char*>(compressed_data), n * DIM3 * sizeof(int16_t));
+
+	return this->decompress(compressed_data, n);
+}
+
+/* Same bytes as serialize, written to memory (e.g. by encoder threads). */
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::encode(std::vector<uint8_t>& frame_data, SerializeType type) const {
+	if ( DepthCloudHasPoints(*this) == false ) return false;
+	if ( type == SERIALIZE_DEPTH && this->hasNativeDepth() == false && this->hasRayTable("encode") == false ) return false;
+
+	frame_data.resize(SerializedSize(this->w, this->h, type));
+
+	uint32_t dims[2] = { static_cast<uint32_t>(this->w), static_cast<uint32_t>(this->h) };
+	uint64_t timestamp = static_cast<uint64_t>(this->stamp);
+	std::memcpy(frame_data.data(), dims, sizeof(dims));
+	std::memcpy(frame_data.data() + sizeof(dims), &timestamp, sizeof(uint64_t));
+	uint8_t* payload = frame_data.data() + FRAME_HEADER_SIZE;
+
+	if ( type == SERIALIZE_DEFAULT || type == SERIALIZE_RAW ) {
+		DepthCloudStorePoints(*this, payload);
+		return true;
+	}
+
+	if ( type == SERIALIZE_DEPTH ) return this->depthSamples(reinterpret_cast<uint16_t*>(payload), "encode");
+
+	float bounds[4] = { this->min_distance, this->max_distance, this->min_range, this->max_range };
+	std::memcpy(payload, bounds, sizeof(bounds));
+	return this->quantize(reinterpret_cast<uint16_t*>(payload + sizeof(bounds)), SERIALIZE_COMPRESSED);
+}
+
+/* Same frame layout as deserialize, read from memory (e.g. a mapped file).
+ * Compressed frames are decoded straight from the source bytes.
+ */
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::decode(const uint8_t* frame_data, std::size_t length, SerializeType type) {
+	if ( frame_data == nullptr ) return false;
+	if ( length < FRAME_HEADER_SIZE ) return false;
+
+	uint32_t width, height;
+	uint64_t timestamp;
+	std::memcpy(&width, frame_data, sizeof(uint32_t));
+	std::memcpy(&height, frame_data + sizeof(uint32_t), sizeof(uint32_t));
+	std::memcpy(&timestamp, frame_data + 2 * sizeof(uint32_t), sizeof(uint64_t));
+
+	if ( uint64_t(width) * uint64_t(height) > RECORDING_MAX_FRAME_POINTS ) {
+		std::cerr << "[DepthCloud:decode] Error: Invalid frame header." << std::endl;
+		return false;
+	}
+
+	if ( length < SerializedSize(width, height, type) ) {
+		std::cerr << "[DepthCloud:decode] Error: Frame data is truncated." << std::endl;
+		return false;
+	}
+
+	if ( this->allocate(width, height) == false ) return false;
+	this->stamp = timestamp;
+	this->native_depth.clear();
+
+	std::size_t n = this->w * this->h;
+	const uint8_t* payload = frame_data + FRAME_HEADER_SIZE;
+
+	if ( type == SERIALIZE_DEFAULT || type == SERIALIZE_RAW ) {
+		DepthCloudLoadPoints(*this, payload);
+		return true;
+	}
+
+	if ( type == SERIALIZE_DEPTH ) {
+		if ( this->hasRayTable("decode") == false ) return false;
+		this->native_depth.resize(n);
+		std::memcpy(this->native_depth.data(), payload, n * sizeof(uint16_t));
+		return DepthCloudReconstruct(*this->rays, this->native_depth.data(), *this);
+	}
+
+	float bounds[4];
+	std::memcpy(bounds, payload, sizeof(bounds));
+	this->min_distance = bounds[0];
+	this->max_distance = bounds[1];
+	this->min_range = bounds[2];
+	this->max_range = bounds[3];
+
+	return this->decompress(reinterpret_cast<const int16_t*>(payload + sizeof(bounds)), n);
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::decompress(const int16_t* compressed_data, std::size_t n) {
+	constexpr Real inv_comp = Real(1) / Real(COMP_SHORT);
+	const Real offset[DIM3] = { this->min_range, this->min_range, this->min_distance };
+	const Real m_xy = (this->max_range - this->min_range) * inv_comp;
+	const Real m_z = (this->max_distance - this->min_distance) * inv_comp;
+	const Real scale[DIM3] = { m_xy, m_xy, m_z };
+
+	if ( n != this->w * this->h ) return false;
+	DepthCloudDequantize(compressed_data, *this, offset, scale);
+	return true;
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::hasRayTable(const char* caller) const {
+	if ( this->rays == nullptr || this->rays->size() != this->w * this->h ) {
+		std::cerr << "[DepthCloud:" << caller << "] Error: SERIALIZE_DEPTH needs a ray table matching the cloud size." << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+/* Native depth of every point: the stored samples when the cloud has them,
+ * else z projected with the ray table.
+ */
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::depthSamples(uint16_t* samples, const char* caller) const {
+	if ( this->hasNativeDepth() ) {
+		std::memcpy(samples, this->native_depth.data(), this->native_depth.size() * sizeof(uint16_t));
+		return true;
+	}
+
+	if ( this->hasRayTable(caller) == false ) return false;
+	return DepthCloudProject(*this->rays, *this, samples);
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::quantize(uint16_t* samples, SerializeType type) const {
+	if ( samples == nullptr || DepthCloudHasPoints(*this) == false ) return false;
+
+	if ( type == SERIALIZE_DEPTH ) return this->depthSamples(samples, "quantize");
+
+	if ( type != SERIALIZE_COMPRESSED ) return false;
+
+	constexpr Real comp = Real(COMP_SHORT);
+	const Real offset[DIM3] = { this->min_range, this->min_range, this->min_distance };
+	const Real m_xy = comp / Real(this->max_range - this->min_range);
+	const Real m_z = comp / Real(this->max_distance - this->min_distance);
+	const Real scale[DIM3] = { m_xy, m_xy, m_z };
+
+	DepthCloudQuantize(*this, reinterpret_cast<int16_t*>(samples), offset, scale);
+	return true;
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::dequantize(const uint16_t* samples, std::size_t width, std::size_t height, SerializeType type) {
+	if ( samples == nullptr ) return false;
+	if ( type != SERIALIZE_DEPTH && type != SERIALIZE_COMPRESSED ) return false;
+
+	if ( this->allocate(width, height) == false ) return false;
+	std::size_t n = this->w * this->h;
+	this->native_depth.clear();
+
+	if ( type == SERIALIZE_DEPTH ) {
+		if ( this->hasRayTable("dequantize") == false ) return false;
+		this->native_depth.assign(samples, samples + n);
+		return DepthCloudReconstruct(*this->rays, samples, *this);
+	}
+
+	return this->decompress(reinterpret_cast<const int16_t*>(samples), n);
+}
+
+template <class StoragePolicy>
+std::size_t BasicDepthCloud<StoragePolicy>::SampleCount(std::size_t width, std::size_t height, SerializeType type) {
+	if ( type == SERIALIZE_DEPTH ) return width * height;
+	if ( type == SERIALIZE_COMPRESSED ) return width * height * DIM3;
+	return 0;
+}
+
+/* Returns the compression scratch buffer with room for at least count values. */
+template <class StoragePolicy>
+int16_t* BasicDepthCloud<StoragePolicy>::scratch(std::size_t count) {
+	if ( this->compressed.size() < count ) this->compressed.resize(count);
+	return this->compressed.data();
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::scale(Real uniform_scale) {
+	// The native depth no longer matches the scaled z.
+	this->native_depth.clear();
+	return DepthCloudScale(*this, uniform_scale);
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::setRayTable(const std::shared_ptr<const RayTable>& rays) {
+	this->rays = rays;
+	return true;
+}
+
+template <class StoragePolicy>
+const std::shared_ptr<const RayTable>& BasicDepthCloud<StoragePolicy>::getRayTable() const {
+	return this->rays;
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::setNativeDepth(const uint16_t* depth, std::size_t count) {
+	if ( depth == nullptr ) return false;
+	if ( count != this->w * this->h ) {
+		std::cerr << "[DepthCloud:setNativeDepth] Error: " << count << " depth samples for a " << this->w << "x" << this->h << " cloud." << std::endl;
+		return false;
+	}
+
+	this->native_depth.assign(depth, depth + count);
+	return true;
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::projectNativeDepth() {
+	if ( DepthCloudHasPoints(*this) == false ) return false;
+	if ( this->hasRayTable("projectNativeDepth") == false ) return false;
+
+	this->native_depth.resize(this->w * this->h);
+	return DepthCloudProject(*this->rays, *this, this->native_depth.data());
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::clearNativeDepth() {
+	this->native_depth.clear();
+	return true;
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::hasNativeDepth() const {
+	return this->native_depth.size() != 0 && this->native_depth.size() == this->w * this->h;
+}
+
+template <class StoragePolicy>
+const uint16_t* BasicDepthCloud<StoragePolicy>::constNativeDepth() const {
+	if ( this->hasNativeDepth() == false ) return nullptr;
+	return this->native_depth.data();
+}
+
+template <class StoragePolicy>
+Real BasicDepthCloud<StoragePolicy>::getMinDepth() const {
+	Real min, max;
+	if ( DepthCloudDepthBounds(*this, min, max) == false ) return Real(0);
+	return min;
+}
+
+template <class StoragePolicy>
+Real BasicDepthCloud<StoragePolicy>::getMaxDepth() const {
+	Real min, max;
+	if ( DepthCloudDepthBounds(*this, min, max) == false ) return Real(0);
+	return max;
+}
+
+template <class StoragePolicy>
+Real BasicDepthCloud<StoragePolicy>::getMinDistance() const {
+	return this->min_distance;
+}
+
+template <class StoragePolicy>
+Real BasicDepthCloud<StoragePolicy>::getMaxDistance() const {
+	return this->max_distance;
+}
+
+template <class StoragePolicy>
+Real BasicDepthCloud<StoragePolicy>::getMinRange() const {
+	return this->min_range;
+}
+
+template <class StoragePolicy>
+Real BasicDepthCloud<StoragePolicy>::getMaxRange() const {
+	return this->max_range;
+}
+
+template <class StoragePolicy>
+std::size_t BasicDepthCloud<StoragePolicy>::SerializedSize(std::size_t width, std::size_t height, SerializeType type) {
+	std::size_t n = width * height;
+	if ( type == SERIALIZE_DEFAULT || type == SERIALIZE_RAW ) return FRAME_HEADER_SIZE + n * sizeof(PointXYZ<Real>);
+	if ( type == SERIALIZE_DEPTH ) return FRAME_HEADER_SIZE + n * sizeof(uint16_t);
+	return FRAME_HEADER_SIZE + 4 * sizeof(float) + n * DIM3 * sizeof(int16_t);
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::Load(const std::string& filename, std::vector<std::shared_ptr<BasicDepthCloud<StoragePolicy> > >& clouds) {
+	if ( filename.length() == 0 ) return false;
+
+	RecordingReader reader;
+	
+	if ( reader.open(filename) == false ) {
+		std::cerr << "[DepthCloud:Load] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	// Recordings are read through the interleaved layout.
+	DepthCloud frame;
+	clouds.reserve(clouds.size() + reader.getFrameCount());
+	while ( reader.hasNext() ) {
+		std::shared_ptr<BasicDepthCloud<StoragePolicy> > cloud = std::make_shared<BasicDepthCloud<StoragePolicy> >();
+		if constexpr ( std::is_same<StoragePolicy, InterleavedStorage>::value ) {
+			if ( reader.read(*cloud) == false ) break;
+		}
+		else {
+			if ( reader.read(frame) == false ) break;
+			if ( cloud->convert(frame) == false ) break;
+		}
+		clouds.push_back(cloud);
+	}
+
+	reader.close();
+	return true;
+}
+
+template <class StoragePolicy>
+bool BasicDepthCloud<StoragePolicy>::Load(const std::string& filename, const std::function<bool(const BasicDepthCloud<StoragePolicy>&)>& visitor) {
+	if ( filename.length() == 0 ) return false;
+
+	RecordingReader reader;
+
+	if ( reader.open(filename) == false ) {
+		std::cerr << "[DepthCloud:Load] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	DepthCloud frame;
+	BasicDepthCloud<StoragePolicy> cloud;
+	while ( reader.hasNext() ) {
+		if ( reader.read(frame) == false ) break;
+		if constexpr ( std::is_same<StoragePolicy, InterleavedStorage>::value ) {
+			if ( visitor(frame) == false ) break;
+		}
+		else {
+			if ( cloud.convert(frame) == false ) break;
+			if ( visitor(cloud) == false ) break;
+		}
+	}
+
+	reader.close();
+	return true;
+}
+
+template class BasicDepthCloud<InterleavedStorage>;
+template class BasicDepthCloud<PlanarStorage>;
+
+}
@@ -1,73 +1,185 @@
-
-#ifndef PX_DEPTH_CLOUD_H
-#define PX_DEPTH_CLOUD_H
-
-#include "OrganizedCloud.h"
-
-namespace px {
-
-class DepthCloud : public OrganizedCloud<PointXYZ<Real> > {
-public:
-	DepthCloud();
-	DepthCloud(std::size_t width, std::size_t height);
-	virtual ~DepthCloud();
-
-	/* Serialize interface. This implementation compresses the
-	 * data prior to being written. This reduces the accuracy
-	 * of the data at each write, therefore should be used sparingly.
-	 */
-	bool serialize(BinaryFileWriter& out, SerializeType type = SERIALIZE_COMPRESSED);
-	bool deserialize(BinaryFileReader& in, SerializeType type = SERIALIZE_COMPRESSED);
-
-	bool scale(Real uniform_scale);
-
-	/* Min and max distance in the data (z), (used for compression).
-	 * The distance bounds should be set to  the min and max distance values (typically the z component)
-	 * of the point data in the cloud. The closer these values are to the expected distances
-	 * (hardware dependent), the compression accuracy will improve.
-	 */
-	bool setDistanceBounds(Real min, Real max);
-
-	/* Min and max (x,y) real distances (left, right extents), used for compression.
-	 * The minimum and maximum values are used for both (x) and (y) components
-	 * of the internal point data.
-	 */
-	bool setRangeBounds(Real min, Real max);
-
-	Real getMinDepth() const;
-	Real getMaxDepth() const;
-
-	/* Min/Max Distance is the manually set distance used for compression. 
-	 * These values are not related to the depth point distances.
-	 */
-	Real getMinDistance() const;
-	Real getMaxDistance() const;
-	Real getMinRange() const;
-	Real getMaxRange() const;
-
-	static bool Load(const std::string& filename, std::vector<std::shared_ptr<DepthCloud> >& clouds);
-
-protected:
-	/* Distance and range values correspond to the global coordinates of
-	 * the points in the depth point values. Distance corresponds to
-	 * the (z) value and the range min/max corresponds to the (x) and (y)
-	 * values. These values depend on the device/hardware generating the
-	 * depth image. For short range devices this may be from 0.1m to 1.5m.
-	 * For mid-range devices this may be from 0.5m to 8.0m. For long-range
-	 * devices it may be from 1.0m to 20m or more.
-	 */
-	Real min_distance, max_distance;
-	Real min_range, max_range;
-
-private:
-	/* Stores compressedd data for rapid-write to storage. The compression
-	 * accuracy depends on the min/max distance and min/max range values.
-	 * The closer these values are to the depth data values stored inside
-	 * the cloud, the compression accuracy will improve.
-	 */
-	std::vector<int16_t> compressed;
-};
-
-}
-
-#endif
+
+#ifndef PX_DEPTH_CLOUD_H
+#define PX_DEPTH_CLOUD_H
+
+#include <functional>
+#include <type_traits>
+#include "OrganizedCloud.h"
+#include "DataFrameView.h"
+#include "RayTable.h"
+
+namespace px {
+
+typedef OrganizedCloudView<PointXYZ<Real> > DepthCloudView;
+
+/* Depth sensor cloud, with the point storage given by the storage policy:
+ * DepthCloud keeps the interleaved points delivered by the sensor SDK,
+ * PlanarDepthCloud keeps x, y and z planes so the depth bounds, scaling and
+ * quantization passes run with unit stride. Both serialize to the same bytes,
+ * convert between them with convert().
+ */
+template <class StoragePolicy = InterleavedStorage>
+class BasicDepthCloud : public OrganizedCloud<PointXYZ<Real>, StoragePolicy> {
+public:
+	BasicDepthCloud();
+	BasicDepthCloud(const BasicDepthCloud<StoragePolicy>& cloud);
+	BasicDepthCloud(BasicDepthCloud<StoragePolicy>&& cloud) noexcept;
+	BasicDepthCloud(std::size_t width, std::size_t height);
+	virtual ~BasicDepthCloud();
+
+	BasicDepthCloud<StoragePolicy>& operator = (const BasicDepthCloud<StoragePolicy>& cloud);
+	BasicDepthCloud<StoragePolicy>& operator = (BasicDepthCloud<StoragePolicy>&& cloud) noexcept;
+
+	/* Copies the points, bounds, ray table and native depth of a cloud in the
+	 * other layout.
+	 */
+	template <class OtherPolicy>
+	bool convert(const BasicDepthCloud<OtherPolicy>& cloud);
+
+	/* Serialize interface. This implementation compresses the
+	 * data prior to being written. This reduces the accuracy
+	 * of the data at each write, therefore should be used sparingly.
+	 * SERIALIZE_DEPTH stores the native depth (see setNativeDepth), or z
+	 * projected with the ray table for clouds without it, and rebuilds x and
+	 * y with the pinhole rays of the ray table (see setRayTable) on load.
+	 */
+	bool serialize(BinaryFileWriter& out, SerializeType type = SERIALIZE_COMPRESSED);
+	bool deserialize(BinaryFileReader& in, SerializeType type = SERIALIZE_COMPRESSED);
+
+	/* Encodes / decodes one serialized frame (the bytes written by serialize)
+	 * in memory. encode does not modify the cloud, so frames can be encoded
+	 * from several threads.
+	 */
+	bool encode(std::vector<uint8_t>& frame_data, SerializeType type = SERIALIZE_COMPRESSED) const;
+	bool decode(const uint8_t* frame_data, std::size_t length, SerializeType type = SERIALIZE_COMPRESSED);
+
+	/* Quantized samples, as stored by SERIALIZE_COMPRESSED (three int16 per
+	 * point, passed as their uint16 bit patterns) or SERIALIZE_DEPTH (one
+	 * native depth value per point). Used by inter-frame codecs.
+	 */
+	bool quantize(uint16_t* samples, SerializeType type) const;
+	bool dequantize(const uint16_t* samples, std::size_t width, std::size_t height, SerializeType type);
+	static std::size_t SampleCount(std::size_t width, std::size_t height, SerializeType type);
+
+	bool scale(Real uniform_scale);
+
+	/* Min and max distance in the data (z), (used for compression).
+	 * The distance bounds should be set to  the min and max distance values (typically the z component)
+	 * of the point data in the cloud. The closer these values are to the expected distances
+	 * (hardware dependent), the compression accuracy will improve.
+	 */
+	bool setDistanceBounds(Real min, Real max);
+
+	/* Min and max (x,y) real distances (left, right extents), used for compression.
+	 * The minimum and maximum values are used for both (x) and (y) components
+	 * of the internal point data.
+	 */
+	bool setRangeBounds(Real min, Real max);
+
+	/* Ray table used by SERIALIZE_DEPTH to convert between points and native
+	 * depth. It must match the cloud dimensions.
+	 */
+	bool setRayTable(const std::shared_ptr<const RayTable>& rays);
+	const std::shared_ptr<const RayTable>& getRayTable() const;
+
+	/* Native depth samples of the frame, one per point in the depth units of
+	 * the ray table (e.g. the sensor's Y16 depth image). SERIALIZE_DEPTH
+	 * stores them as they are, so the sensor depth is kept exactly whatever
+	 * camera model produced x and y. Loading a SERIALIZE_DEPTH frame sets
+	 * them, loading other types and scale() clear them; code that modifies
+	 * the points must clear them too. projectNativeDepth sets them from z
+	 * with the ray table, converting clouds of another camera model.
+	 */
+	bool setNativeDepth(const uint16_t* depth, std::size_t count);
+	bool projectNativeDepth();
+	bool clearNativeDepth();
+	bool hasNativeDepth() const;
+	const uint16_t* constNativeDepth() const;
+
+	Real getMinDepth() const;
+	Real getMaxDepth() const;
+
+	/* Min/Max Distance is the manually set distance used for compression. 
+	 * These values are not related to the depth point distances.
+	 */
+	Real getMinDistance() const;
+	Real getMaxDistance() const;
+	Real getMinRange() const;
+	Real getMaxRange() const;
+
+	/* Size in bytes of one serialized frame, including the frame header. */
+	static std::size_t SerializedSize(std::size_t width, std::size_t height, SerializeType type = SERIALIZE_COMPRESSED);
+
+	/* Loads every frame of an indexed recording or a legacy headerless file. */
+	static bool Load(const std::string& filename, std::vector<std::shared_ptr<BasicDepthCloud<StoragePolicy> > >& clouds);
+
+	/* Streams the frames through the visitor one at a time (a single frame is
+	 * resident), stopping early when the visitor returns false. Use
+	 * RecordingStream for prefetching or holding several frames.
+	 */
+	static bool Load(const std::string& filename, const std::function<bool(const BasicDepthCloud<StoragePolicy>&)>& visitor);
+
+protected:
+	/* Distance and range values correspond to the global coordinates of
+	 * the points in the depth point values. Distance corresponds to
+	 * the (z) value and the range min/max corresponds to the (x) and (y)
+	 * values. These values depend on the device/hardware generating the
+	 * depth image. For short range devices this may be from 0.1m to 1.5m.
+	 * For mid-range devices this may be from 0.5m to 8.0m. For long-range
+	 * devices it may be from 1.0m to 20m or more.
+	 */
+	Real min_distance, max_distance;
+	Real min_range, max_range;
+	std::shared_ptr<const RayTable> rays;
+	std::vector<uint16_t> native_depth;
+
+	bool decompress(const int16_t* compressed_data, std::size_t n);
+	bool hasRayTable(const char* caller) const;
+	bool depthSamples(uint16_t* samples, const char* caller) const;
+
+private:
+	/* Stores compressedd data for rapid-write to storage. The compression
+	 * accuracy depends on the min/max distance and min/max range values.
+	 * The closer these values are to the depth data values stored inside
+	 * the cloud, the compression accuracy will improve.
+	 */
+	std::vector<int16_t> compressed;
+
+	int16_t* scratch(std::size_t count);
+
+	template <class OtherPolicy>
+	friend class BasicDepthCloud;
+};
+
+typedef BasicDepthCloud<InterleavedStorage> DepthCloud;
+typedef BasicDepthCloud<PlanarStorage> PlanarDepthCloud;
+
+// Both layouts are instantiated in DepthCloud.cpp.
+extern template class BasicDepthCloud<InterleavedStorage>;
+extern template class BasicDepthCloud<PlanarStorage>;
+
+template <class StoragePolicy>
+template <class OtherPolicy>
+bool BasicDepthCloud<StoragePolicy>::convert(const BasicDepthCloud<OtherPolicy>& cloud) {
+	if constexpr ( std::is_same<StoragePolicy, OtherPolicy>::value ) {
+		*this = cloud;
+	}
+	else if constexpr ( std::is_same<StoragePolicy, PlanarStorage>::value ) {
+		if ( this->copy(cloud) == false ) return false;
+	}
+	else {
+		if ( cloud.copyTo(*this) == false ) return false;
+	}
+
+	this->min_distance = cloud.min_distance;
+	this->max_distance = cloud.max_distance;
+	this->min_range = cloud.min_range;
+	this->max_range = cloud.max_range;
+	this->rays = cloud.rays;
+	this->native_depth = cloud.native_depth;
+	return true;
+}
+
+}
+
+#endif
@@ -0,0 +1,374 @@
+#include "DepthFilter.h"
+#include "CpuFeatures.h"
+#include "TileExecutor.h"
+#include <atomic>
+#include <cmath>
+
+#if defined(PX_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+namespace px {
+
+const static std::size_t DEPTH_FILTER_MAX_RADIUS = 8;
+const static std::size_t DEPTH_FILTER_TABLE_SIZE = 1024;
+const static float DEPTH_FILTER_TABLE_SIGMAS = 3.0f;
+
+DepthFilterOptions::DepthFilterOptions() {
+	this->radius = 2;
+	this->sigma_spatial = Real(1.5);
+	this->sigma_depth = Real(30);
+	this->sigma_intensity = Real(200);
+	this->min_support = Real(0.25);
+	this->tile_rows = 16;
+}
+
+bool DepthFilterOptions::isValid() const {
+	if ( this->radius == 0 || this->radius > DEPTH_FILTER_MAX_RADIUS ) return false;
+	if ( (this->sigma_spatial > Real(0)) == false ) return false;
+	if ( (this->sigma_depth > Real(0)) == false ) return false;
+	if ( (this->sigma_intensity >= Real(0)) == false ) return false;
+	if ( (this->min_support >= Real(0) && this->min_support <= Real(1)) == false ) return false;
+	if ( this->tile_rows == 0 ) return false;
+	return true;
+}
+
+/* Samples exp(-d^2 / (2 sigma^2)) at d = i / scale up to DEPTH_FILTER_TABLE_SIGMAS
+ * sigma, the last entry is zero.
+ */
+inline bool BuildDepthRangeTable(std::vector<float>& table, float& scale, Real sigma) {
+	table.assign(DEPTH_FILTER_TABLE_SIZE, 0.0f);
+	scale = static_cast<float>(DEPTH_FILTER_TABLE_SIZE - 1) / (DEPTH_FILTER_TABLE_SIGMAS * static_cast<float>(sigma));
+	for ( std::size_t i = 0; i + 1 < DEPTH_FILTER_TABLE_SIZE; i++ ) {
+		double d = static_cast<double>(i) / static_cast<double>(scale);
+		table[i] = static_cast<float>(std::exp(-(d * d) / (2.0 * static_cast<double>(sigma) * static_cast<double>(sigma))));
+	}
+	return true;
+}
+
+/* Filters one row. depth (and guide) point to the padded plane row holding
+ * the top of the windows, the window of pixel x starts at column x. filtered
+ * gets the weighted mean depth (0 without valid neighbours) and support the
+ * sum of the spatial * depth range weights, including the center.
+ */
+void DepthFilterRowScalar(const float* depth, const float* guide, std::size_t stride, std::size_t width, const DepthFilterTables& tables, float* filtered, float* support) {
+	const std::size_t r = tables.radius;
+	const std::size_t size = 2 * r + 1;
+	const float range_limit = static_cast<float>(tables.range.size() - 1);
+	const float intensity_limit = static_cast<float>(tables.intensity.size() - 1);
+
+	for ( std::size_t x = 0; x < width; x++ ) {
+		const float center = depth[r * stride + r + x];
+		const float guide_center = guide != nullptr ? guide[r * stride + r + x] : 0.0f;
+		float sum_weight = 0.0f, sum_depth = 0.0f, sum_support = 0.0f;
+
+		for ( std::size_t dy = 0; dy < size; dy++ ) {
+			const float* line = depth + dy * stride + x;
+			const float* spatial = &tables.spatial[dy * size];
+			for ( std::size_t dx = 0; dx < size; dx++ ) {
+				const float z = line[dx];
+				if ( (z > 0.0f) == false ) continue;
+
+				float d = std::fabs(z - center) * tables.range_scale;
+				d = d < range_limit ? d : range_limit;
+				float weight = spatial[dx] * tables.range[static_cast<int32_t>(d)];
+				sum_support += weight;
+
+				if ( guide != nullptr ) {
+					float g = std::fabs(guide[dy * stride + x + dx] - guide_center) * tables.intensity_scale;
+					g = g < intensity_limit ? g : intensity_limit;
+					weight = weight * tables.intensity[static_cast<int32_t>(g)];
+				}
+
+				sum_weight += weight;
+				sum_depth += weight * z;
+			}
+		}
+
+		filtered[x] = sum_weight > 0.0f ? sum_depth / sum_weight : 0.0f;
+		support[x] = sum_support;
+	}
+}
+
+#if defined(PX_SIMD_X86)
+/* Accumulates the window taps of eight pixels, the table lookups are gathers. */
+PX_TARGET_AVX2 inline void DepthFilterTapsAVX2(const float* depth, const float* guide, std::size_t stride, const DepthFilterTables& tables, __m256& sum_weight, __m256& sum_depth, __m256& sum_support) {
+	const std::size_t r = tables.radius;
+	const std::size_t size = 2 * r + 1;
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 sign = _mm256_set1_ps(-0.0f);
+	const __m256 range_scale = _mm256_set1_ps(tables.range_scale);
+	const __m256 range_limit = _mm256_set1_ps(static_cast<float>(tables.range.size() - 1));
+	const __m256 intensity_scale = _mm256_set1_ps(tables.intensity_scale);
+	const __m256 intensity_limit = _mm256_set1_ps(static_cast<float>(tables.intensity.size() - 1));
+	const float* range = tables.range.data();
+	const float* intensity = tables.intensity.data();
+
+	const __m256 center = _mm256_loadu_ps(depth + r * stride + r);
+	const __m256 guide_center = guide != nullptr ? _mm256_loadu_ps(guide + r * stride + r) : zero;
+	sum_weight = zero;
+	sum_depth = zero;
+	sum_support = zero;
+
+	for ( std::size_t dy = 0; dy < size; dy++ ) {
+		const float* line = depth + dy * stride;
+		const float* spatial = &tables.spatial[dy * size];
+		for ( std::size_t dx = 0; dx < size; dx++ ) {
+			const __m256 z = _mm256_loadu_ps(line + dx);
+			const __m256 valid = _mm256_cmp_ps(z, zero, _CMP_GT_OQ);
+
+			__m256 d = _mm256_mul_ps(_mm256_andnot_ps(sign, _mm256_sub_ps(z, center)), range_scale);
+			d = _mm256_min_ps(d, range_limit);
+			__m256 weight = _mm256_mul_ps(_mm256_broadcast_ss(spatial + dx), _mm256_i32gather_ps(range, _mm256_cvttps_epi32(d), 4));
+			weight = _mm256_and_ps(weight, valid);
+			sum_support = _mm256_add_ps(sum_support, weight);
+
+			if ( guide != nullptr ) {
+				__m256 g = _mm256_sub_ps(_mm256_loadu_ps(guide + dy * stride + dx), guide_center);
+				g = _mm256_min_ps(_mm256_mul_ps(_mm256_andnot_ps(sign, g), intensity_scale), intensity_limit);
+				weight = _mm256_mul_ps(weight, _mm256_i32gather_ps(intensity, _mm256_cvttps_epi32(g), 4));
+			}
+
+			sum_weight = _mm256_add_ps(sum_weight, weight);
+			sum_depth = _mm256_add_ps(sum_depth, _mm256_mul_ps(weight, z));
+		}
+	}
+}
+
+/* Same operations in the same order as the scalar kernel, so the results are
+ * bit-identical.
+ */
+PX_TARGET_AVX2 void DepthFilterRowAVX2(const float* depth, const float* guide, std::size_t stride, std::size_t width, const DepthFilterTables& tables, float* filtered, float* support) {
+	const __m256 zero = _mm256_setzero_ps();
+	__m256 sum_weight, sum_depth, sum_support;
+
+	std::size_t x = 0;
+	for ( ; x + 8 <= width; x += 8 ) {
+		DepthFilterTapsAVX2(depth + x, guide != nullptr ? guide + x : nullptr, stride, tables, sum_weight, sum_depth, sum_support);
+		const __m256 mean = _mm256_and_ps(_mm256_div_ps(sum_depth, sum_weight), _mm256_cmp_ps(sum_weight, zero, _CMP_GT_OQ));
+		_mm256_storeu_ps(filtered + x, mean);
+		_mm256_storeu_ps(support + x, sum_support);
+	}
+
+	DepthFilterRowScalar(depth + x, guide != nullptr ? guide + x : nullptr, stride, width - x, tables, filtered + x, support + x);
+}
+#endif
+
+inline DepthFilterKernel BestDepthFilterKernel(DepthFilterKernel requested) {
+#if defined(PX_SIMD_X86)
+	if ( requested == DEPTH_FILTER_AVX2 && CpuFeatures::Get().avx2 ) return DEPTH_FILTER_AVX2;
+#endif
+	return DEPTH_FILTER_SCALAR;
+}
+
+static std::atomic<int> active_depth_filter_kernel(-1);
+
+inline DepthFilterKernel ActiveDepthFilterKernel() {
+	int kernel = active_depth_filter_kernel.load(std::memory_order_relaxed);
+	if ( kernel >= 0 ) return static_cast<DepthFilterKernel>(kernel);
+
+	DepthFilterKernel best = BestDepthFilterKernel(DEPTH_FILTER_AVX2);
+	active_depth_filter_kernel.store(static_cast<int>(best), std::memory_order_relaxed);
+	return best;
+}
+
+inline void DepthFilterRow(const float* depth, const float* guide, std::size_t stride, std::size_t width, const DepthFilterTables& tables, float* filtered, float* support) {
+	switch ( ActiveDepthFilterKernel() ) {
+#if defined(PX_SIMD_X86)
+		case DEPTH_FILTER_AVX2: DepthFilterRowAVX2(depth, guide, stride, width, tables, filtered, support); return;
+#endif
+		default: DepthFilterRowScalar(depth, guide, stride, width, tables, filtered, support); return;
+	}
+}
+
+DepthFilter::DepthFilter() {
+	this->rejected = 0;
+	this->plane_width = 0;
+	this->plane_height = 0;
+	this->buildTables();
+}
+
+DepthFilter::DepthFilter(const DepthFilterOptions& options) {
+	this->rejected = 0;
+	this->plane_width = 0;
+	this->plane_height = 0;
+	if ( this->setOptions(options) == false ) this->buildTables();
+}
+
+DepthFilter::~DepthFilter() {}
+
+bool DepthFilter::setOptions(const DepthFilterOptions& options) {
+	if ( options.isValid() == false ) {
+		std::cerr << "[DepthFilter:setOptions] Error: Invalid filter options." << std::endl;
+		return false;
+	}
+
+	this->options = options;
+	return this->buildTables();
+}
+
+const DepthFilterOptions& DepthFilter::getOptions() const {
+	return this->options;
+}
+
+bool DepthFilter::apply(const OrganizedCloud<PointXYZ<Real> >& input, OrganizedCloud<PointXYZ<Real> >& output) {
+	return this->filter(input, nullptr, output);
+}
+
+bool DepthFilter::apply(const OrganizedCloud<PointXYZ<Real> >& input, const IntensityImage<uint16_t>& guide, OrganizedCloud<PointXYZ<Real> >& output) {
+	if ( guide.constData() == nullptr || guide.width() != input.width() || guide.height() != input.height() ) {
+		std::cerr << "[DepthFilter:apply] Error: Guide image does not match the cloud size." << std::endl;
+		return false;
+	}
+
+	if ( this->options.sigma_intensity <= Real(0) ) {
+		std::cerr << "[DepthFilter:apply] Error: Guided filtering needs sigma_intensity > 0." << std::endl;
+		return false;
+	}
+
+	return this->filter(input, guide.constData(), output);
+}
+
+std::size_t DepthFilter::getRejectedCount() const {
+	return this->rejected;
+}
+
+bool DepthFilter::SetKernel(DepthFilterKernel kernel) {
+	DepthFilterKernel selected = BestDepthFilterKernel(kernel);
+	active_depth_filter_kernel.store(static_cast<int>(selected), std::memory_order_relaxed);
+	return selected == kernel;
+}
+
+DepthFilterKernel DepthFilter::GetKernel() {
+	return ActiveDepthFilterKernel();
+}
+
+bool DepthFilter::filter(const OrganizedCloud<PointXYZ<Real> >& input, const uint16_t* guide, OrganizedCloud<PointXYZ<Real> >& output) {
+	const PointXYZ<Real>* points = input.constData();
+	if ( points == nullptr || input.width() == 0 || input.height() == 0 ) {
+		std::cerr << "[DepthFilter:filter] Error: Empty input cloud." << std::endl;
+		return false;
+	}
+
+	const std::size_t width = input.width();
+	const std::size_t height = input.height();
+	const std::size_t r = this->tables.radius;
+	const std::size_t stride = width + 2 * r;
+	const std::size_t tile_rows = this->options.tile_rows;
+
+	if ( &output != &input && (output.width() != width || output.height() != height || output.constData() == nullptr) ) {
+		if ( output.resize(width, height) == false ) return false;
+	}
+
+	// The padding is zeroed when the planes are (re)allocated, the frames
+	// only write the interior.
+	if ( this->plane_width != stride || this->plane_height != height + 2 * r ) {
+		this->plane_width = stride;
+		this->plane_height = height + 2 * r;
+		this->depth_plane.assign(this->plane_width * this->plane_height, 0.0f);
+		this->guide_plane.clear();
+		this->filtered.resize(width * height);
+		this->support.resize(width * height);
+	}
+	if ( guide != nullptr && this->guide_plane.size() != this->depth_plane.size() ) this->guide_plane.assign(this->depth_plane.size(), 0.0f);
+
+	float* depth = this->depth_plane.data();
+	float* guide_data = guide != nullptr ? this->guide_plane.data() : nullptr;
+	TileExecutor& executor = TileExecutor::Get();
+
+	executor.run(height, tile_rows, [&](std::size_t, std::size_t begin, std::size_t end) {
+		for ( std::size_t y = begin; y < end; y++ ) {
+			const PointXYZ<Real>* row = points + y * width;
+			float* line = depth + (y + r) * stride + r;
+			for ( std::size_t x = 0; x < width; x++ )
+				line[x] = row[x].z > Real(0) ? static_cast<float>(row[x].z) : 0.0f;
+
+			if ( guide_data != nullptr ) {
+				const uint16_t* guide_row = guide + y * width;
+				float* guide_line = guide_data + (y + r) * stride + r;
+				for ( std::size_t x = 0; x < width; x++ )
+					guide_line[x] = static_cast<float>(guide_row[x]);
+			}
+		}
+	});
+
+	// Support is compared to the neighbours' share of the spatial weight,
+	// the center always supports itself.
+	const float threshold = this->tables.spatial_center + static_cast<float>(this->options.min_support) * (this->tables.spatial_total - this->tables.spatial_center);
+	const bool bReject = this->options.min_support > Real(0);
+	PointXYZ<Real>* result = output.getData();
+
+	this->tile_rejected.assign(TileExecutor::GetTileCount(height, tile_rows), 0);
+	executor.run(height, tile_rows, [&](std::size_t tile, std::size_t begin, std::size_t end) {
+		std::size_t count = 0;
+		for ( std::size_t y = begin; y < end; y++ ) {
+			float* filtered_row = &this->filtered[y * width];
+			float* support_row = &this->support[y * width];
+			DepthFilterRow(depth + y * stride, guide_data != nullptr ? guide_data + y * stride : nullptr, stride, width, this->tables, filtered_row, support_row);
+
+			const PointXYZ<Real>* row = points + y * width;
+			PointXYZ<Real>* result_row = result + y * width;
+			for ( std::size_t x = 0; x < width; x++ ) {
+				PointXYZ<Real> p = row[x];
+				if ( (p.z > Real(0)) == false ) {
+					result_row[x] = p;
+					continue;
+				}
+
+				if ( bReject && support_row[x] < threshold ) {
+					result_row[x].x = result_row[x].y = result_row[x].z = Real(0);
+					count++;
+					continue;
+				}
+
+				// Moves the point along its viewing ray to the filtered depth.
+				Real s = static_cast<Real>(filtered_row[x]) / p.z;
+				result_row[x].x = p.x * s;
+				result_row[x].y = p.y * s;
+				result_row[x].z = static_cast<Real>(filtered_row[x]);
+			}
+		}
+		this->tile_rejected[tile] = count;
+	});
+
+	this->rejected = 0;
+	for ( std::size_t i = 0; i < this->tile_rejected.size(); i++ )
+		this->rejected += this->tile_rejected[i];
+
+	output.setTimestamp(input.getTimestamp());
+	return true;
+}
+
+bool DepthFilter::buildTables() {
+	const std::size_t r = this->options.radius;
+	const std::size_t size = 2 * r + 1;
+	const double sigma = static_cast<double>(this->options.sigma_spatial);
+
+	this->tables.radius = r;
+	this->tables.spatial.resize(size * size);
+	this->tables.spatial_total = 0.0f;
+	for ( std::size_t i = 0; i < size; i++ ) {
+		for ( std::size_t j = 0; j < size; j++ ) {
+			double dy = static_cast<double>(i) - static_cast<double>(r);
+			double dx = static_cast<double>(j) - static_cast<double>(r);
+			float weight = static_cast<float>(std::exp(-(dx * dx + dy * dy) / (2.0 * sigma * sigma)));
+			this->tables.spatial[i * size + j] = weight;
+			this->tables.spatial_total += weight;
+		}
+	}
+	this->tables.spatial_center = this->tables.spatial[r * size + r];
+
+	BuildDepthRangeTable(this->tables.range, this->tables.range_scale, this->options.sigma_depth);
+	if ( this->options.sigma_intensity > Real(0) ) BuildDepthRangeTable(this->tables.intensity, this->tables.intensity_scale, this->options.sigma_intensity);
+	else {
+		this->tables.intensity.assign(2, 1.0f);
+		this->tables.intensity_scale = 0.0f;
+	}
+
+	// The padding depends on the radius.
+	this->plane_width = 0;
+	this->plane_height = 0;
+	return true;
+}
+
+}
@@ -0,0 +1,120 @@
+#ifndef PX_DEPTH_FILTER_H
+#define PX_DEPTH_FILTER_H
+
+#include <vector>
+#include <cstdint>
+#include "OrganizedCloud.h"
+#include "IntensityImage.h"
+#include "Mathematics.h"
+
+namespace px {
+
+enum DepthFilterKernel {
+	DEPTH_FILTER_SCALAR,
+	DEPTH_FILTER_AVX2
+};
+
+/* Settings of a DepthFilter.
+ *
+ * radius: window radius in pixels (the window is 2 * radius + 1 square).
+ * sigma_spatial: Gaussian falloff with the pixel distance.
+ * sigma_depth: Gaussian falloff with the depth difference, in cloud units
+ *   (millimetres for Femto clouds).
+ * sigma_intensity: Gaussian falloff with the guide difference, in guide
+ *   units (joint filtering only).
+ * min_support: pixels whose depth-similar neighbours carry less than this
+ *   fraction of the spatial weight are removed (0 = keep every pixel).
+ * tile_rows: rows per executor tile.
+ */
+struct DepthFilterOptions {
+	std::size_t radius;
+	Real sigma_spatial;
+	Real sigma_depth;
+	Real sigma_intensity;
+	Real min_support;
+	std::size_t tile_rows;
+
+	DepthFilterOptions();
+	bool isValid() const;
+};
+
+/* Weight tables of a DepthFilter, shared by the row kernels.
+ *
+ * spatial: (2 * radius + 1)^2 weights, row major.
+ * range / intensity: Gaussian of |difference| sampled every 1 / scale; the
+ *   last entry is zero, differences past it get no weight.
+ */
+struct DepthFilterTables {
+	std::size_t radius;
+	std::vector<float> spatial;
+	std::vector<float> range;
+	std::vector<float> intensity;
+	float range_scale;
+	float intensity_scale;
+	float spatial_center;
+	float spatial_total;
+};
+
+/* Edge-preserving (bilateral) depth filter for organized clouds, optionally
+ * guided by the infrared image of the same frame (joint bilateral).
+ *
+ * Each valid pixel (z > 0) is replaced by the weighted mean depth of the
+ * valid pixels in its window, the weight being the spatial weight times the
+ * depth range weight (times the guide range weight). The point is moved
+ * along its viewing ray, so x and y follow the new depth. Neighbours across
+ * a depth edge get no weight, which keeps silhouettes sharp.
+ *
+ * Flying pixels (mixed foreground / background returns at silhouettes) lie
+ * between the surfaces and have few neighbours at a similar depth: a pixel
+ * whose neighbours' spatial * depth range weight is below min_support of the
+ * window's spatial weight is set to the zero point.
+ *
+ * Depth (and the guide) are first copied to zero padded float planes so the
+ * window is read by unit stride without bounds checks, the weights come from
+ * tables built by setOptions, and rows are filtered in bands on the shared
+ * TileExecutor. input and output may be the same cloud.
+ */
+class DepthFilter {
+public:
+	DepthFilter();
+	DepthFilter(const DepthFilterOptions& options);
+	virtual ~DepthFilter();
+
+	bool setOptions(const DepthFilterOptions& options);
+	const DepthFilterOptions& getOptions() const;
+
+	bool apply(const OrganizedCloud<PointXYZ<Real> >& input, OrganizedCloud<PointXYZ<Real> >& output);
+	bool apply(const OrganizedCloud<PointXYZ<Real> >& input, const IntensityImage<uint16_t>& guide, OrganizedCloud<PointXYZ<Real> >& output);
+
+	/* Pixels removed as flying pixels by the last apply. */
+	std::size_t getRejectedCount() const;
+
+	/* The best supported kernel is selected on first use. Setting a kernel the
+	 * CPU does not support falls back to the best supported one.
+	 */
+	static bool SetKernel(DepthFilterKernel kernel);
+	static DepthFilterKernel GetKernel();
+
+protected:
+	DepthFilter(const DepthFilter&) = delete;
+	DepthFilter& operator = (const DepthFilter&) = delete;
+
+	bool filter(const OrganizedCloud<PointXYZ<Real> >& input, const uint16_t* guide, OrganizedCloud<PointXYZ<Real> >& output);
+	bool buildTables();
+
+	DepthFilterOptions options;
+	DepthFilterTables tables;
+	std::size_t rejected;
+
+	// Zero padded planes and per pixel results, reused between frames.
+	std::size_t plane_width, plane_height;
+	std::vector<float> depth_plane;
+	std::vector<float> guide_plane;
+	std::vector<float> filtered;
+	std::vector<float> support;
+	std::vector<std::size_t> tile_rejected;
+};
+
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef PX_FILE_STATUS_H
+#define PX_FILE_STATUS_H
+
+namespace px {
+
+/* Sticky error state of the buffered file classes. The first failure is
+ * kept (and further calls fail) until the status is cleared, so a sequence
+ * of writes or reads can be checked once at the end instead of per call.
+ */
+enum FileStatus {
+	FILE_OK,
+	FILE_NOT_OPEN,
+	FILE_OPEN_FAILED,
+	FILE_END_OF_FILE,
+	FILE_READ_ERROR,
+	FILE_WRITE_ERROR,
+	FILE_SEEK_ERROR
+};
+
+inline const char* FileStatusToString(FileStatus status) {
+	switch ( status ) {
+		case FILE_OK: return "ok";
+		case FILE_NOT_OPEN: return "file not open";
+		case FILE_OPEN_FAILED: return "open failed";
+		case FILE_END_OF_FILE: return "end of file";
+		case FILE_READ_ERROR: return "read error";
+		case FILE_WRITE_ERROR: return "write error";
+		case FILE_SEEK_ERROR: return "seek error";
+	}
+
+	return "unknown";
+}
+
+}
+
+#endif
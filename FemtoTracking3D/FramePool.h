@@ -0,0 +1,212 @@
+#ifndef PX_FRAME_POOL_H
+#define PX_FRAME_POOL_H
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+
+namespace px {
+
+/* Recycles frame buffers so that steady-state capture and replay do not
+ * touch the heap once warmed up. A single pool exists per element type and
+ * buffers are kept in separate free lists keyed by element count (frame
+ * width * height). Released buffers are returned to the free list of their
+ * size rather than deleted, up to max_cached buffers per size.
+ *
+ * The pool is shared by every DataFrame of the same element type and is
+ * safe to use from multiple threads (e.g. capture and render). Buffers are
+ * aligned to FRAME_ALIGNMENT (cache line / AVX-512 width) so that row and
+ * plane loops can use aligned vector loads.
+ */
+const static std::size_t FRAME_ALIGNMENT = 64;
+
+template <typename DataType>
+class FramePool {
+	static_assert(std::is_trivially_copyable<DataType>::value, "FramePool requires trivially copyable frame elements.");
+
+public:
+	static FramePool<DataType>& Instance();
+
+	DataType* acquire(std::size_t count);
+	bool release(DataType* buffer, std::size_t count);
+
+	/* Deletes every cached (free) buffer. Buffers currently held by frames
+	 * are unaffected and will be cached again once released.
+	 */
+	bool clear();
+	bool setMaxCached(std::size_t max_cached);
+	std::size_t getMaxCached() const;
+
+	std::size_t getHits() const;
+	std::size_t getMisses() const;
+	std::size_t getBytesOutstanding() const;
+	std::size_t getBytesCached() const;
+	bool resetCounters();
+
+	std::string toString() const;
+
+protected:
+	FramePool();
+	FramePool(const FramePool<DataType>&) = delete;
+	FramePool<DataType>& operator = (const FramePool<DataType>&) = delete;
+
+	static DataType* Allocate(std::size_t count);
+	static void Free(DataType* buffer);
+
+	mutable std::mutex mutex;
+	std::unordered_map<std::size_t, std::vector<DataType*> > free_lists;
+	std::size_t max_cached;
+
+	std::atomic<std::size_t> hits;
+	std::atomic<std::size_t> misses;
+	std::atomic<std::size_t> bytes_outstanding;
+	std::atomic<std::size_t> bytes_cached;
+};
+
+const static std::size_t DEFAULT_FRAME_POOL_MAX_CACHED = 8;
+
+//------------------------------------------------------------------------------
+// Implementation
+//------------------------------------------------------------------------------
+template <typename DataType>
+FramePool<DataType>::FramePool() {
+	this->max_cached = DEFAULT_FRAME_POOL_MAX_CACHED;
+	this->hits = 0;
+	this->misses = 0;
+	this->bytes_outstanding = 0;
+	this->bytes_cached = 0;
+}
+
+template <typename DataType>
+FramePool<DataType>& FramePool<DataType>::Instance() {
+	// Intentionally never destroyed: frames with static storage duration may
+	// release their buffers after a function-local static would be gone.
+	static FramePool<DataType>* pool = new FramePool<DataType>();
+	return *pool;
+}
+
+template <typename DataType>
+DataType* FramePool<DataType>::acquire(std::size_t count) {
+	if ( count == 0 ) return nullptr;
+	std::size_t bytes = count * sizeof(DataType);
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		auto iter = this->free_lists.find(count);
+		if ( iter != this->free_lists.end() && iter->second.size() != 0 ) {
+			DataType* buffer = iter->second.back();
+			iter->second.pop_back();
+			this->bytes_cached -= bytes;
+			this->bytes_outstanding += bytes;
+			this->hits++;
+			return buffer;
+		}
+	}
+
+	DataType* buffer = Allocate(count);
+	this->bytes_outstanding += bytes;
+	this->misses++;
+	return buffer;
+}
+
+template <typename DataType>
+bool FramePool<DataType>::release(DataType* buffer, std::size_t count) {
+	if ( buffer == nullptr ) return false;
+	std::size_t bytes = count * sizeof(DataType);
+	this->bytes_outstanding -= bytes;
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		auto& free_list = this->free_lists[count];
+		if ( free_list.size() < this->max_cached ) {
+			free_list.push_back(buffer);
+			this->bytes_cached += bytes;
+			return true;
+		}
+	}
+
+	Free(buffer);
+	return true;
+}
+
+template <typename DataType>
+bool FramePool<DataType>::clear() {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	for ( auto& entry : this->free_lists ) {
+		for ( std::size_t i = 0; i < entry.second.size(); i++ )
+			Free(entry.second[i]);
+	}
+
+	this->free_lists.clear();
+	this->bytes_cached = 0;
+	return true;
+}
+
+template <typename DataType>
+bool FramePool<DataType>::setMaxCached(std::size_t max_cached) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->max_cached = max_cached;
+	return true;
+}
+
+template <typename DataType>
+std::size_t FramePool<DataType>::getMaxCached() const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->max_cached;
+}
+
+template <typename DataType>
+std::size_t FramePool<DataType>::getHits() const {
+	return this->hits;
+}
+
+template <typename DataType>
+std::size_t FramePool<DataType>::getMisses() const {
+	return this->misses;
+}
+
+template <typename DataType>
+std::size_t FramePool<DataType>::getBytesOutstanding() const {
+	return this->bytes_outstanding;
+}
+
+template <typename DataType>
+std::size_t FramePool<DataType>::getBytesCached() const {
+	return this->bytes_cached;
+}
+
+template <typename DataType>
+bool FramePool<DataType>::resetCounters() {
+	this->hits = 0;
+	this->misses = 0;
+	return true;
+}
+
+template <typename DataType>
+DataType* FramePool<DataType>::Allocate(std::size_t count) {
+	void* memory = ::operator new[](count * sizeof(DataType), std::align_val_t(FRAME_ALIGNMENT));
+	return static_cast<DataType*>(memory);
+}
+
+template <typename DataType>
+void FramePool<DataType>::Free(DataType* buffer) {
+	::operator delete[](buffer, std::align_val_t(FRAME_ALIGNMENT));
+}
+
+template <typename DataType>
+std::string FramePool<DataType>::toString() const {
+	std::stringstream stream;
+	stream << "[FramePool hits:" << this->hits << " misses:" << this->misses;
+	stream << " outstanding:" << this->bytes_outstanding << "B cached:" << this->bytes_cached << "B]";
+	return stream.str();
+}
+
+}
+
+#endif
@@ -1,14 +1,14 @@
-
-#ifndef PX_INTERFACE_H
-#define PX_INTERFACE_H
-
-namespace px {
-
-/* Pure virtual abstract class interface.
- * Separates Object based hierarchy from Interface classes.
- */
-class Interface {};
-
-}
-
-#endif
+
+#ifndef PX_INTERFACE_H
+#define PX_INTERFACE_H
+
+namespace px {
+
+/* Pure virtual abstract class interface.
+ * Separates Object based hierarchy from Interface classes.
+ */
+class Interface {};
+
+}
+
+#endif
@@ -0,0 +1,585 @@
+#include "JointTrack.h"
+#include "ReplayCamera.h"
+#include "DeltaCodec.h"
+#include "Crc32c.h"
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+namespace px {
+
+const static std::size_t JOINT_TRACK_MAX_BODIES = 256;
+const static std::size_t JOINT_TRACK_COMPONENTS = 5;
+const static uint8_t JOINT_TRACK_TYPE_FOLLOWS = 0x80;
+const static uint8_t JOINT_TRACK_STATUS_MASK = 0x03;
+const static uint32_t JOINT_TRACK_NO_ENTRY = std::numeric_limits<uint32_t>::max();
+
+/* Frame indices are looked up in a direct table unless they are sparse. */
+const static uint64_t JOINT_TRACK_DENSE_SLACK = 65536;
+
+inline int32_t QuantizeJoint(float value, float scale) {
+	if ( std::isfinite(value) == false ) return 0;
+	double q = std::round(double(value) * double(scale));
+	if ( q >= double(std::numeric_limits<int32_t>::max()) ) return std::numeric_limits<int32_t>::max();
+	if ( q <= double(std::numeric_limits<int32_t>::min()) ) return std::numeric_limits<int32_t>::min();
+	return static_cast<int32_t>(q);
+}
+
+/* Residuals wrap around (uint32 arithmetic), so every pair of values has one. */
+inline uint32_t ZigZagResidual(int32_t value, int32_t reference) {
+	int32_t residual = static_cast<int32_t>(static_cast<uint32_t>(value) - static_cast<uint32_t>(reference));
+	return (static_cast<uint32_t>(residual) << 1) ^ static_cast<uint32_t>(residual >> 31);
+}
+
+inline int32_t UnZigZagResidual(uint32_t token, int32_t reference) {
+	uint32_t residual = (token >> 1) ^ (0u - (token & 1u));
+	return static_cast<int32_t>(static_cast<uint32_t>(reference) + residual);
+}
+
+template <typename T>
+inline T LoadValue(const uint8_t* data) {
+	T value;
+	std::memcpy(&value, data, sizeof(T));
+	return value;
+}
+
+JointTrackHeader::JointTrackHeader() {
+	this->magic = JOINT_TRACK_MAGIC;
+	this->version = JOINT_TRACK_VERSION;
+	this->joint_count = JOINT_COUNT;
+	this->keyframe_interval = JOINT_TRACK_KEYFRAME_INTERVAL;
+	this->position_scale = JOINT_TRACK_POSITION_SCALE;
+	this->image_scale = JOINT_TRACK_IMAGE_SCALE;
+}
+
+//------------------------------------------------------------------------------
+// JointTrackWriter
+//------------------------------------------------------------------------------
+JointTrackWriter::JointTrackWriter() {
+	this->bHeaderWritten = false;
+}
+
+JointTrackWriter::~JointTrackWriter() {
+	if ( this->out.isOpen() ) this->close();
+}
+
+bool JointTrackWriter::open(const std::string& filename, uint32_t keyframe_interval) {
+	if ( this->out.isOpen() ) this->close();
+
+	if ( this->out.open(filename) == false ) {
+		std::cerr << "[JointTrackWriter:open] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	this->filename = filename;
+	this->header = JointTrackHeader();
+	this->header.keyframe_interval = (keyframe_interval == 0) ? 1 : keyframe_interval;
+	this->index.clear();
+	this->reference.assign(JOINT_TRACK_MAX_BODIES * this->header.joint_count * JOINT_TRACK_COMPONENTS, 0);
+	this->reference_count.assign(JOINT_TRACK_MAX_BODIES, 0);
+	this->current_count.assign(JOINT_TRACK_MAX_BODIES, 0);
+	this->bHeaderWritten = false;
+	return true;
+}
+
+bool JointTrackWriter::close() {
+	if ( this->out.isOpen() == false ) return false;
+
+	bool bResult = true;
+	if ( this->bHeaderWritten == false ) bResult = this->writeHeader();
+	if ( bResult ) bResult = this->writeIndex();
+	if ( this->out.close() == false ) bResult = false;
+
+	if ( bResult == false ) std::cerr << "[JointTrackWriter:close] Error: Could not finish: " << this->filename << std::endl;
+	return bResult;
+}
+
+bool JointTrackWriter::isOpen() const {
+	return this->out.isOpen();
+}
+
+std::size_t JointTrackWriter::getFrameCount() const {
+	return this->index.size();
+}
+
+bool JointTrackWriter::writeHeader() {
+	this->out.write(this->header.magic);
+	this->out.write(this->header.version);
+	this->out.write(this->header.joint_count);
+	this->out.write(this->header.keyframe_interval);
+	this->out.write(this->header.position_scale);
+	this->out.write(this->header.image_scale);
+	this->bHeaderWritten = true;
+	return this->out.getStatus() == FILE_OK;
+}
+
+bool JointTrackWriter::writeIndex() {
+	JointTrackFooter footer;
+	footer.index_offset = this->out.tell();
+	footer.frame_count = this->index.size();
+	footer.magic = JOINT_TRACK_INDEX_MAGIC;
+
+	for ( std::size_t i = 0; i < this->index.size(); i++ ) {
+		this->out.write(this->index[i].frame_index);
+		this->out.write(this->index[i].timestamp);
+		this->out.write(this->index[i].offset);
+	}
+
+	this->out.write(footer.index_offset);
+	this->out.write(footer.frame_count);
+	this->out.write(footer.magic);
+	return this->out.getStatus() == FILE_OK;
+}
+
+bool JointTrackWriter::write(uint64_t frame_index, uint64_t timestamp, const std::vector<Body>& bodies) {
+	if ( this->out.isOpen() == false ) return false;
+
+	if ( this->index.size() != 0 && frame_index <= this->index.back().frame_index ) {
+		std::cerr << "[JointTrackWriter:write] Error: Frame index " << frame_index << " does not follow " << this->index.back().frame_index << std::endl;
+		return false;
+	}
+
+	if ( this->bHeaderWritten == false && this->writeHeader() == false ) return false;
+
+	bool bKeyframe = (this->index.size() % this->header.keyframe_interval) == 0;
+	if ( this->encode(bodies, bKeyframe) == false ) return false;
+
+	JointTrackIndexEntry entry;
+	entry.frame_index = frame_index;
+	entry.timestamp = timestamp;
+	entry.offset = this->out.tell();
+
+	uint32_t length = static_cast<uint32_t>(this->payload.size());
+	this->out.write(frame_index);
+	this->out.write(timestamp);
+	this->out.write(length);
+	this->out.write(Crc32c(this->payload.data(), this->payload.size()));
+	this->out.writeBytes(this->payload.data(), this->payload.size());
+	if ( this->out.getStatus() != FILE_OK ) return false;
+
+	this->index.push_back(entry);
+	return true;
+}
+
+/* Bodies are coded against the reference joints of their id; the reference
+ * is updated in place, so an id that shows up twice in a frame is coded
+ * absolute the second time.
+ */
+bool JointTrackWriter::encode(const std::vector<Body>& bodies, bool bKeyframe) {
+	this->payload.clear();
+	this->payload.push_back(0);
+	std::fill(this->current_count.begin(), this->current_count.end(), uint8_t(0));
+
+	std::size_t body_count = 0;
+	for ( std::size_t i = 0; i < bodies.size(); i++ ) {
+		if ( bodies[i].getStatus() == BODY_NOT_TRACKING ) continue;
+
+		if ( body_count == JOINT_TRACK_MAX_BODIES - 1 ) {
+			std::cerr << "[JointTrackWriter:encode] Warning: More than " << body_count << " bodies, frame truncated." << std::endl;
+			break;
+		}
+
+		this->encodeBody(bodies[i], bKeyframe);
+		body_count++;
+	}
+
+	this->payload[0] = static_cast<uint8_t>(body_count);
+	this->reference_count.swap(this->current_count);
+	return true;
+}
+
+bool JointTrackWriter::encodeBody(const Body& body, bool bKeyframe) {
+	const std::vector<Joint>& joints = body.getJoints();
+	std::size_t id = body.id();
+	std::size_t count = std::min<std::size_t>(joints.size(), this->header.joint_count);
+	bool bDelta = bKeyframe == false && this->reference_count[id] == count && this->current_count[id] == 0;
+
+	this->payload.push_back(static_cast<uint8_t>(id));
+	this->payload.push_back(static_cast<uint8_t>(body.getStatus()));
+	this->payload.push_back(bDelta ? JOINT_TRACK_BODY_DELTA : uint8_t(0));
+	this->payload.push_back(static_cast<uint8_t>(count));
+
+	for ( std::size_t j = 0; j < count; j++ ) {
+		uint8_t status = static_cast<uint8_t>(joints[j].status) & JOINT_TRACK_STATUS_MASK;
+		if ( joints[j].type == j ) this->payload.push_back(status);
+		else {
+			this->payload.push_back(status | JOINT_TRACK_TYPE_FOLLOWS);
+			this->payload.push_back(joints[j].type);
+		}
+	}
+
+	int32_t* reference = this->reference.data() + id * this->header.joint_count * JOINT_TRACK_COMPONENTS;
+	for ( std::size_t j = 0; j < count; j++ ) {
+		int32_t values[JOINT_TRACK_COMPONENTS] = {
+			QuantizeJoint(joints[j].x, this->header.position_scale),
+			QuantizeJoint(joints[j].y, this->header.position_scale),
+			QuantizeJoint(joints[j].z, this->header.position_scale),
+			QuantizeJoint(joints[j].u, this->header.image_scale),
+			QuantizeJoint(joints[j].v, this->header.image_scale)
+		};
+
+		for ( std::size_t c = 0; c < JOINT_TRACK_COMPONENTS; c++ ) {
+			PutVarint(this->payload, ZigZagResidual(values[c], bDelta ? reference[c] : 0));
+			reference[c] = values[c];
+		}
+
+		reference += JOINT_TRACK_COMPONENTS;
+	}
+
+	this->current_count[id] = static_cast<uint8_t>(count);
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// JointTrackReader
+//------------------------------------------------------------------------------
+JointTrackReader::JointTrackReader() {
+	this->decoded_frame = JOINT_TRACK_NO_FRAME;
+}
+
+JointTrackReader::~JointTrackReader() {
+	this->close();
+}
+
+bool JointTrackReader::open(const std::string& filename) {
+	this->close();
+
+	if ( this->file.open(filename) == false ) {
+		std::cerr << "[JointTrackReader:open] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	const uint8_t* data = this->file.data();
+	if ( this->file.size() < JOINT_TRACK_HEADER_SIZE || LoadValue<uint32_t>(data) != JOINT_TRACK_MAGIC ) {
+		std::cerr << "[JointTrackReader:open] Error: Not a joint track: " << filename << std::endl;
+		this->close();
+		return false;
+	}
+
+	this->header.magic = LoadValue<uint32_t>(data);
+	this->header.version = LoadValue<uint32_t>(data + 4);
+	this->header.joint_count = LoadValue<uint32_t>(data + 8);
+	this->header.keyframe_interval = LoadValue<uint32_t>(data + 12);
+	this->header.position_scale = LoadValue<float>(data + 16);
+	this->header.image_scale = LoadValue<float>(data + 20);
+
+	if ( this->header.version > JOINT_TRACK_VERSION ) {
+		std::cerr << "[JointTrackReader:open] Warning: Joint track version " << this->header.version << " is newer than " << JOINT_TRACK_VERSION << std::endl;
+	}
+
+	if ( this->header.joint_count == 0 || this->header.joint_count > 255 || this->header.keyframe_interval == 0 ||
+		(this->header.position_scale > 0.0f) == false || (this->header.image_scale > 0.0f) == false ) {
+		std::cerr << "[JointTrackReader:open] Error: Invalid header in: " << filename << std::endl;
+		this->close();
+		return false;
+	}
+
+	if ( this->readIndex() == false ) {
+		std::cerr << "[JointTrackReader:open] Warning: Missing frame index, scanning: " << filename << std::endl;
+		this->scanFrames();
+	}
+
+	if ( this->buildLookup() == false ) {
+		std::cerr << "[JointTrackReader:open] Error: Frame indices out of order in: " << filename << std::endl;
+		this->close();
+		return false;
+	}
+
+	this->reference.assign(JOINT_TRACK_MAX_BODIES * this->header.joint_count * JOINT_TRACK_COMPONENTS, 0);
+	this->reference_count.assign(JOINT_TRACK_MAX_BODIES, 0);
+	this->current_count.assign(JOINT_TRACK_MAX_BODIES, 0);
+	this->joint_buffer.resize(this->header.joint_count);
+	return true;
+}
+
+bool JointTrackReader::close() {
+	this->index.clear();
+	this->frame_lookup.clear();
+	this->timestamp_lookup.clear();
+	this->header = JointTrackHeader();
+	this->decoded_frame = JOINT_TRACK_NO_FRAME;
+	if ( this->file.isOpen() == false ) return false;
+	return this->file.close();
+}
+
+bool JointTrackReader::isOpen() const {
+	return this->file.isOpen();
+}
+
+const JointTrackHeader& JointTrackReader::getHeader() const {
+	return this->header;
+}
+
+std::size_t JointTrackReader::getFrameCount() const {
+	return this->index.size();
+}
+
+const std::vector<JointTrackIndexEntry>& JointTrackReader::getIndex() const {
+	return this->index;
+}
+
+bool JointTrackReader::readIndex() {
+	std::size_t size = this->file.size();
+	if ( size < JOINT_TRACK_HEADER_SIZE + JOINT_TRACK_FOOTER_SIZE ) return false;
+
+	const uint8_t* footer_data = this->file.data() + size - JOINT_TRACK_FOOTER_SIZE;
+	JointTrackFooter footer;
+	footer.index_offset = LoadValue<uint64_t>(footer_data);
+	footer.frame_count = LoadValue<uint64_t>(footer_data + 8);
+	footer.magic = LoadValue<uint32_t>(footer_data + 16);
+
+	const uint64_t entry_size = 3 * sizeof(uint64_t);
+	if ( footer.magic != JOINT_TRACK_INDEX_MAGIC ) return false;
+	if ( footer.index_offset < JOINT_TRACK_HEADER_SIZE || footer.frame_count > size / entry_size ) return false;
+	if ( footer.index_offset + footer.frame_count * entry_size + JOINT_TRACK_FOOTER_SIZE != size ) return false;
+
+	const uint8_t* entry = this->file.data() + footer.index_offset;
+	this->index.resize(static_cast<std::size_t>(footer.frame_count));
+
+	for ( std::size_t i = 0; i < this->index.size(); i++, entry += entry_size ) {
+		this->index[i].frame_index = LoadValue<uint64_t>(entry);
+		this->index[i].timestamp = LoadValue<uint64_t>(entry + 8);
+		this->index[i].offset = LoadValue<uint64_t>(entry + 16);
+		if ( this->index[i].offset + JOINT_TRACK_FRAME_HEADER_SIZE > footer.index_offset ) {
+			this->index.clear();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/* Indexes a track without footer (the writer was interrupted). The scan
+ * stops at the first truncated or damaged frame.
+ */
+bool JointTrackReader::scanFrames() {
+	this->index.clear();
+
+	std::size_t size = this->file.size();
+	std::size_t offset = JOINT_TRACK_HEADER_SIZE;
+
+	while ( offset + JOINT_TRACK_FRAME_HEADER_SIZE <= size ) {
+		const uint8_t* frame = this->file.data() + offset;
+		uint32_t length = LoadValue<uint32_t>(frame + 16);
+		uint32_t crc = LoadValue<uint32_t>(frame + 20);
+
+		if ( offset + JOINT_TRACK_FRAME_HEADER_SIZE + length > size || Crc32c(frame + JOINT_TRACK_FRAME_HEADER_SIZE, length) != crc ) {
+			std::cerr << "[JointTrackReader:scanFrames] Warning: Damaged or truncated frame " << this->index.size() << " in: " << this->file.getFilename() << std::endl;
+			break;
+		}
+
+		JointTrackIndexEntry entry;
+		entry.frame_index = LoadValue<uint64_t>(frame);
+		entry.timestamp = LoadValue<uint64_t>(frame + 8);
+		entry.offset = offset;
+		if ( this->index.size() != 0 && entry.frame_index <= this->index.back().frame_index ) break;
+
+		this->index.push_back(entry);
+		offset += JOINT_TRACK_FRAME_HEADER_SIZE + length;
+	}
+
+	return true;
+}
+
+/* Frame indices follow the depth frames, so they are (nearly) dense and map
+ * to stored frames through a direct table; sparse tracks fall back to a
+ * binary search. Timestamps are hashed (the first frame of a timestamp wins).
+ */
+bool JointTrackReader::buildLookup() {
+	this->frame_lookup.clear();
+	this->timestamp_lookup.clear();
+	if ( this->index.size() == 0 ) return true;
+	if ( this->index.size() >= JOINT_TRACK_NO_ENTRY ) return false;
+
+	for ( std::size_t i = 1; i < this->index.size(); i++ ) {
+		if ( this->index[i].frame_index <= this->index[i - 1].frame_index ) return false;
+	}
+
+	uint64_t last = this->index.back().frame_index;
+	if ( last < 4 * uint64_t(this->index.size()) + JOINT_TRACK_DENSE_SLACK ) {
+		this->frame_lookup.assign(static_cast<std::size_t>(last) + 1, JOINT_TRACK_NO_ENTRY);
+		for ( std::size_t i = 0; i < this->index.size(); i++ ) this->frame_lookup[static_cast<std::size_t>(this->index[i].frame_index)] = static_cast<uint32_t>(i);
+	}
+
+	this->timestamp_lookup.reserve(this->index.size());
+	for ( std::size_t i = 0; i < this->index.size(); i++ ) this->timestamp_lookup.emplace(this->index[i].timestamp, static_cast<uint32_t>(i));
+	return true;
+}
+
+std::size_t JointTrackReader::findFrame(uint64_t frame_index) const {
+	if ( this->frame_lookup.size() != 0 ) {
+		if ( frame_index >= this->frame_lookup.size() ) return JOINT_TRACK_NO_FRAME;
+		uint32_t n = this->frame_lookup[static_cast<std::size_t>(frame_index)];
+		return (n == JOINT_TRACK_NO_ENTRY) ? JOINT_TRACK_NO_FRAME : n;
+	}
+
+	auto it = std::lower_bound(this->index.begin(), this->index.end(), frame_index, [](const JointTrackIndexEntry& entry, uint64_t value) { return entry.frame_index < value; });
+	if ( it == this->index.end() || it->frame_index != frame_index ) return JOINT_TRACK_NO_FRAME;
+	return static_cast<std::size_t>(it - this->index.begin());
+}
+
+std::size_t JointTrackReader::findTimestamp(uint64_t timestamp) const {
+	auto it = this->timestamp_lookup.find(timestamp);
+	if ( it == this->timestamp_lookup.end() ) return JOINT_TRACK_NO_FRAME;
+	return it->second;
+}
+
+bool JointTrackReader::readFrame(uint64_t frame_index, std::vector<Body>& bodies) {
+	std::size_t n = this->findFrame(frame_index);
+	if ( n == JOINT_TRACK_NO_FRAME ) {
+		bodies.clear();
+		return false;
+	}
+
+	return this->read(n, bodies);
+}
+
+bool JointTrackReader::readTimestamp(uint64_t timestamp, std::vector<Body>& bodies) {
+	std::size_t n = this->findTimestamp(timestamp);
+	if ( n == JOINT_TRACK_NO_FRAME ) {
+		bodies.clear();
+		return false;
+	}
+
+	return this->read(n, bodies);
+}
+
+/* Continues from the last decoded frame if it lies between the keyframe
+ * and n, otherwise decodes forward from the keyframe.
+ */
+bool JointTrackReader::read(std::size_t n, std::vector<Body>& bodies) {
+	if ( n >= this->index.size() ) {
+		bodies.clear();
+		return false;
+	}
+
+	std::size_t keyframe = n - n % this->header.keyframe_interval;
+	std::size_t start = keyframe;
+	if ( this->decoded_frame != JOINT_TRACK_NO_FRAME && this->decoded_frame >= keyframe && this->decoded_frame < n ) start = this->decoded_frame + 1;
+
+	for ( std::size_t i = start; i <= n; i++ ) {
+		if ( this->decode(i, (i == n) ? &bodies : nullptr) == false ) {
+			std::cerr << "[JointTrackReader:read] Error: Damaged frame " << i << " in: " << this->file.getFilename() << std::endl;
+			this->decoded_frame = JOINT_TRACK_NO_FRAME;
+			bodies.clear();
+			return false;
+		}
+
+		this->decoded_frame = i;
+	}
+
+	return true;
+}
+
+const uint8_t* JointTrackReader::framePayload(std::size_t n, std::size_t& length) const {
+	length = 0;
+	uint64_t offset = this->index[n].offset;
+	if ( offset + JOINT_TRACK_FRAME_HEADER_SIZE > this->file.size() ) return nullptr;
+
+	const uint8_t* frame = this->file.data() + offset;
+	uint32_t payload_length = LoadValue<uint32_t>(frame + 16);
+	uint32_t crc = LoadValue<uint32_t>(frame + 20);
+	if ( offset + JOINT_TRACK_FRAME_HEADER_SIZE + payload_length > this->file.size() ) return nullptr;
+
+	const uint8_t* payload = frame + JOINT_TRACK_FRAME_HEADER_SIZE;
+	if ( Crc32c(payload, payload_length) != crc ) return nullptr;
+	length = payload_length;
+	return payload;
+}
+
+/* Decodes frame n on top of the reference joints of frame n - 1; with
+ * bodies == nullptr only the references are updated.
+ */
+bool JointTrackReader::decode(std::size_t n, std::vector<Body>* bodies) {
+	std::size_t length = 0;
+	const uint8_t* data = this->framePayload(n, length);
+	if ( data == nullptr || length == 0 ) return false;
+
+	std::size_t position = 0;
+	std::size_t body_count = data[position++];
+	std::size_t stride = std::size_t(this->header.joint_count) * JOINT_TRACK_COMPONENTS;
+	std::fill(this->current_count.begin(), this->current_count.end(), uint8_t(0));
+	if ( bodies != nullptr ) bodies->resize(body_count);
+
+	for ( std::size_t b = 0; b < body_count; b++ ) {
+		if ( position + 4 > length ) return false;
+		std::size_t id = data[position++];
+		BodyStatus status = static_cast<BodyStatus>(data[position++]);
+		bool bDelta = (data[position++] & JOINT_TRACK_BODY_DELTA) != 0;
+		std::size_t count = data[position++];
+
+		if ( count > this->header.joint_count ) return false;
+		if ( bDelta && this->reference_count[id] != count ) return false;
+
+		for ( std::size_t j = 0; j < count; j++ ) {
+			if ( position >= length ) return false;
+			uint8_t code = data[position++];
+			this->joint_buffer[j].status = static_cast<JointStatus>(code & JOINT_TRACK_STATUS_MASK);
+			this->joint_buffer[j].type = static_cast<uint8_t>(j);
+
+			if ( (code & JOINT_TRACK_TYPE_FOLLOWS) != 0 ) {
+				if ( position >= length ) return false;
+				this->joint_buffer[j].type = data[position++];
+			}
+		}
+
+		int32_t* reference = this->reference.data() + id * stride;
+		for ( std::size_t j = 0; j < count; j++ ) {
+			for ( std::size_t c = 0; c < JOINT_TRACK_COMPONENTS; c++ ) {
+				uint32_t token = 0;
+				if ( GetVarint(data, length, position, token) == false ) return false;
+				reference[c] = UnZigZagResidual(token, bDelta ? reference[c] : 0);
+			}
+
+			Joint& joint = this->joint_buffer[j];
+			joint.x = float(reference[0]) / this->header.position_scale;
+			joint.y = float(reference[1]) / this->header.position_scale;
+			joint.z = float(reference[2]) / this->header.position_scale;
+			joint.u = float(reference[3]) / this->header.image_scale;
+			joint.v = float(reference[4]) / this->header.image_scale;
+			reference += JOINT_TRACK_COMPONENTS;
+		}
+
+		this->current_count[id] = static_cast<uint8_t>(count);
+		if ( bodies != nullptr ) (*bodies)[b].update(static_cast<uint8_t>(id), status, this->joint_buffer.data(), count);
+	}
+
+	this->reference_count.swap(this->current_count);
+	return true;
+}
+
+JointTrackReplay::JointTrackReplay() {}
+
+JointTrackReplay::~JointTrackReplay() {
+	this->close();
+}
+
+bool JointTrackReplay::open(const std::string& filename) {
+	this->bodies.clear();
+	return this->reader.open(filename);
+}
+
+bool JointTrackReplay::close() {
+	this->bodies.clear();
+	return this->reader.close();
+}
+
+bool JointTrackReplay::isOpen() const {
+	return this->reader.isOpen();
+}
+
+bool JointTrackReplay::update(const ReplayCamera& camera) {
+	if ( this->reader.isOpen() == false ) return false;
+	if ( camera.isConnected() == false ) {
+		this->bodies.clear();
+		return false;
+	}
+
+	return this->reader.readFrame(camera.getCurrentFrame(), this->bodies);
+}
+
+const std::vector<Body>& JointTrackReplay::getBodies() const {
+	return this->bodies;
+}
+
+}
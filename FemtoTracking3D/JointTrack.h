@@ -0,0 +1,201 @@
+#ifndef PX_JOINT_TRACK_H
+#define PX_JOINT_TRACK_H
+
+#include <string>
+#include <vector>
+#include <limits>
+#include <unordered_map>
+#include <BodyTracking.h>
+#include "MappedFile.h"
+#include "BufferedFileWriter.h"
+
+namespace px {
+
+class ReplayCamera;
+
+/* Body joint track, recorded next to a depth recording.
+ *
+ * Layout (little endian):
+ *   JointTrackHeader    magic, version, joints per body, keyframe interval,
+ *                       position and image quantization
+ *   frame 0..n-1        depth frame index, timestamp, payload length,
+ *                       CRC-32C of the payload, payload
+ *   index               n x JointTrackIndexEntry (frame index, timestamp, offset)
+ *   JointTrackFooter    index offset, frame count, footer magic
+ *
+ * A frame payload holds the body count, then per body its id, status, flags
+ * and joint count, one byte per joint (status; bit 7 = a type byte follows,
+ * if the type differs from the joint slot) and the quantized x, y, z, u, v
+ * of every joint as zigzag varints. Positions are residuals against the
+ * same body in the previous frame (flag JOINT_TRACK_BODY_DELTA); every
+ * keyframe_interval-th frame and bodies that just appeared are stored as
+ * absolute values. Positions are rounded to 1 / position_scale mm and
+ * 1 / image_scale px; non-finite values are stored as 0.
+ *
+ * The frame index and timestamp are those of the depth frame the bodies
+ * belong to, so both streams are addressed by the same keys.
+ */
+const static uint32_t JOINT_TRACK_MAGIC = 0x544A5850;        // "PXJT"
+const static uint32_t JOINT_TRACK_INDEX_MAGIC = 0x494A5850;  // "PXJI"
+const static uint32_t JOINT_TRACK_VERSION = 1;
+const static uint32_t JOINT_TRACK_KEYFRAME_INTERVAL = 30;
+const static float JOINT_TRACK_POSITION_SCALE = 10.0f;       // 0.1 mm
+const static float JOINT_TRACK_IMAGE_SCALE = 16.0f;          // 1/16 px
+const static uint8_t JOINT_TRACK_BODY_DELTA = 0x01;
+
+const static std::size_t JOINT_TRACK_NO_FRAME = std::numeric_limits<std::size_t>::max();
+
+struct JointTrackHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t joint_count;
+	uint32_t keyframe_interval;
+	float position_scale;
+	float image_scale;
+
+	JointTrackHeader();
+};
+
+const static std::size_t JOINT_TRACK_HEADER_SIZE = 6 * sizeof(uint32_t);
+const static std::size_t JOINT_TRACK_FRAME_HEADER_SIZE = 2 * sizeof(uint64_t) + 2 * sizeof(uint32_t);
+
+struct JointTrackIndexEntry {
+	uint64_t frame_index;
+	uint64_t timestamp;
+	uint64_t offset;
+};
+
+struct JointTrackFooter {
+	uint64_t index_offset;
+	uint64_t frame_count;
+	uint32_t magic;
+};
+
+const static std::size_t JOINT_TRACK_FOOTER_SIZE = 2 * sizeof(uint64_t) + sizeof(uint32_t);
+
+/* Writes the bodies of TrackingCamera::getBodies() frame by frame. Bodies
+ * that are not tracked (the unused slots of getBodies()) are skipped. The
+ * header goes out with the first frame, the index with close().
+ */
+class JointTrackWriter {
+public:
+	JointTrackWriter();
+	~JointTrackWriter();
+
+	bool open(const std::string& filename, uint32_t keyframe_interval = JOINT_TRACK_KEYFRAME_INTERVAL);
+	bool close();
+	bool isOpen() const;
+
+	/* Appends the bodies of the given depth frame; frame indices must
+	 * increase. Frames without bodies are recorded too (as empty frames).
+	 */
+	bool write(uint64_t frame_index, uint64_t timestamp, const std::vector<Body>& bodies);
+
+	std::size_t getFrameCount() const;
+
+protected:
+	JointTrackWriter(const JointTrackWriter&) = delete;
+	JointTrackWriter& operator = (const JointTrackWriter&) = delete;
+
+	bool writeHeader();
+	bool writeIndex();
+	bool encode(const std::vector<Body>& bodies, bool bKeyframe);
+	bool encodeBody(const Body& body, bool bKeyframe);
+
+	BufferedFileWriter out;
+	std::string filename;
+	JointTrackHeader header;
+	std::vector<JointTrackIndexEntry> index;
+	std::vector<uint8_t> payload;
+
+	// Quantized joints of every body id in the previous frame.
+	std::vector<int32_t> reference;
+	std::vector<uint8_t> reference_count;
+	std::vector<uint8_t> current_count;
+	bool bHeaderWritten;
+};
+
+/* Reads joint tracks. The track is memory mapped and indexed when opened;
+ * the bodies of a depth frame are looked up by frame index or timestamp in
+ * constant time and decoded from the preceding keyframe (at most
+ * keyframe_interval frames; sequential reads decode a single frame).
+ */
+class JointTrackReader {
+public:
+	JointTrackReader();
+	~JointTrackReader();
+
+	bool open(const std::string& filename);
+	bool close();
+	bool isOpen() const;
+
+	const JointTrackHeader& getHeader() const;
+	std::size_t getFrameCount() const;
+	const std::vector<JointTrackIndexEntry>& getIndex() const;
+
+	/* Number of the stored frame of the given depth frame index or
+	 * timestamp, JOINT_TRACK_NO_FRAME if it was not recorded.
+	 */
+	std::size_t findFrame(uint64_t frame_index) const;
+	std::size_t findTimestamp(uint64_t timestamp) const;
+
+	/* Bodies of the n-th stored frame. */
+	bool read(std::size_t n, std::vector<Body>& bodies);
+
+	/* Bodies of the given depth frame index or timestamp; false (and no
+	 * bodies) if the frame was not recorded.
+	 */
+	bool readFrame(uint64_t frame_index, std::vector<Body>& bodies);
+	bool readTimestamp(uint64_t timestamp, std::vector<Body>& bodies);
+
+protected:
+	JointTrackReader(const JointTrackReader&) = delete;
+	JointTrackReader& operator = (const JointTrackReader&) = delete;
+
+	bool readIndex();
+	bool scanFrames();
+	bool buildLookup();
+	bool decode(std::size_t n, std::vector<Body>* bodies);
+	const uint8_t* framePayload(std::size_t n, std::size_t& length) const;
+
+	MappedFile file;
+	JointTrackHeader header;
+	std::vector<JointTrackIndexEntry> index;
+	std::vector<uint32_t> frame_lookup;
+	std::unordered_map<uint64_t, uint32_t> timestamp_lookup;
+
+	std::vector<int32_t> reference;
+	std::vector<uint8_t> reference_count;
+	std::vector<uint8_t> current_count;
+	std::vector<Joint> joint_buffer;
+	std::size_t decoded_frame;
+};
+
+/* Replays a joint track with the ReplayCamera playing its depth recording:
+ * after each camera update(), update(camera) loads the bodies of the depth
+ * frame just delivered. Depth frames without recorded bodies clear the
+ * bodies.
+ */
+class JointTrackReplay {
+public:
+	JointTrackReplay();
+	~JointTrackReplay();
+
+	bool open(const std::string& filename);
+	bool close();
+	bool isOpen() const;
+
+	bool update(const ReplayCamera& camera);
+	const std::vector<Body>& getBodies() const;
+
+protected:
+	JointTrackReplay(const JointTrackReplay&) = delete;
+	JointTrackReplay& operator = (const JointTrackReplay&) = delete;
+
+	JointTrackReader reader;
+	std::vector<Body> bodies;
+};
+
+}
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef PX_KERNEL_H
+#define PX_KERNEL_H
+
+#include <vector>
+#include <cmath>
+#include "DataFrame.h"
+
+namespace px {
+
+/* Relative tolerance (to the largest weight) of the rank-1 test in
+ * Kernel::separate.
+ */
+const static double KERNEL_SEPARABLE_TOLERANCE = 1e-6;
+
+/* Convolution kernel for IntensityImage<ImageDataType>. Weights are stored
+ * row major as doubles whatever the image type, (i, j) is (row, column) like
+ * the images. The kernel is applied as a correlation centered on
+ * (centerY(), centerX()).
+ */
+template <typename ImageDataType>
+class Kernel : public DataFrame<double> {
+public:
+	Kernel();
+	Kernel(const Kernel<ImageDataType>& kernel);
+	Kernel(std::size_t width, std::size_t height);
+	Kernel(const double* weights, std::size_t width, std::size_t height);
+	virtual ~Kernel();
+
+	/* Fill the kernel with normalized (unit sum) box or Gaussian weights. */
+	bool box(std::size_t width, std::size_t height);
+	bool gaussian(std::size_t size, double sigma);
+
+	std::size_t centerX() const;
+	std::size_t centerY() const;
+	double sum() const;
+
+	/* Decomposes the kernel into a column and a row vector, such that
+	 * (i, j) = column[i] * row[j]. Returns false if the kernel is not
+	 * separable (not rank 1 within the tolerance).
+	 */
+	bool separate(std::vector<double>& column, std::vector<double>& row, double tolerance = KERNEL_SEPARABLE_TOLERANCE) const;
+	bool isSeparable(double tolerance = KERNEL_SEPARABLE_TOLERANCE) const;
+
+	Kernel<ImageDataType>& operator = (const Kernel<ImageDataType>& kernel);
+};
+
+template <typename ImageDataType>
+Kernel<ImageDataType>::Kernel() : DataFrame<double>() {
+	this->name = "Kernel";
+}
+
+template <typename ImageDataType>
+Kernel<ImageDataType>::Kernel(const Kernel<ImageDataType>& kernel) : DataFrame<double>(kernel) {
+	this->name = "Kernel";
+}
+
+template <typename ImageDataType>
+Kernel<ImageDataType>::Kernel(std::size_t width, std::size_t height) : DataFrame<double>(width, height) {
+	this->zero();
+	this->name = "Kernel";
+}
+
+template <typename ImageDataType>
+Kernel<ImageDataType>::Kernel(const double* weights, std::size_t width, std::size_t height) : DataFrame<double>(weights, width, height) {
+	this->name = "Kernel";
+}
+
+template <typename ImageDataType>
+Kernel<ImageDataType>::~Kernel() {}
+
+template <typename ImageDataType>
+bool Kernel<ImageDataType>::box(std::size_t width, std::size_t height) {
+	if ( width == 0 || height == 0 ) return false;
+	if ( this->resize(width, height) == false ) return false;
+	return this->uniform(double(1) / static_cast<double>(width * height));
+}
+
+template <typename ImageDataType>
+bool Kernel<ImageDataType>::gaussian(std::size_t size, double sigma) {
+	if ( size == 0 || sigma <= double(0) ) return false;
+	if ( this->resize(size, size) == false ) return false;
+
+	std::vector<double> weights(size);
+	double center = static_cast<double>(size - 1) / double(2);
+	double total = double(0);
+	for ( std::size_t i = 0; i < size; i++ ) {
+		double d = static_cast<double>(i) - center;
+		weights[i] = std::exp(-(d * d) / (double(2) * sigma * sigma));
+		total += weights[i];
+	}
+
+	for ( std::size_t i = 0; i < size; i++ )
+		for ( std::size_t j = 0; j < size; j++ )
+			this->data[i * size + j] = (weights[i] / total) * (weights[j] / total);
+
+	return true;
+}
+
+template <typename ImageDataType>
+std::size_t Kernel<ImageDataType>::centerX() const {
+	return this->w / 2;
+}
+
+template <typename ImageDataType>
+std::size_t Kernel<ImageDataType>::centerY() const {
+	return this->h / 2;
+}
+
+template <typename ImageDataType>
+double Kernel<ImageDataType>::sum() const {
+	double total = double(0);
+	for ( std::size_t i = 0; i < this->w * this->h; i++ )
+		total += this->data[i];
+	return total;
+}
+
+/* The largest weight is the pivot: its column scaled by the weight and its
+ * row divided by it reproduce every weight if the kernel is rank 1.
+ */
+template <typename ImageDataType>
+bool Kernel<ImageDataType>::separate(std::vector<double>& column, std::vector<double>& row, double tolerance) const {
+	if ( this->data == nullptr || this->w == 0 || this->h == 0 ) return false;
+
+	std::size_t pivot = 0;
+	double maximum = double(0);
+	for ( std::size_t i = 0; i < this->w * this->h; i++ ) {
+		if ( std::fabs(this->data[i]) > maximum ) {
+			maximum = std::fabs(this->data[i]);
+			pivot = i;
+		}
+	}
+
+	column.assign(this->h, double(0));
+	row.assign(this->w, double(0));
+	if ( maximum == double(0) ) return true;
+
+	std::size_t p = pivot / this->w;
+	std::size_t q = pivot % this->w;
+	for ( std::size_t i = 0; i < this->h; i++ )
+		column[i] = this->data[i * this->w + q];
+	for ( std::size_t j = 0; j < this->w; j++ )
+		row[j] = this->data[p * this->w + j] / this->data[pivot];
+
+	double limit = tolerance * maximum;
+	for ( std::size_t i = 0; i < this->h; i++ ) {
+		for ( std::size_t j = 0; j < this->w; j++ ) {
+			if ( std::fabs(this->data[i * this->w + j] - column[i] * row[j]) > limit ) return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename ImageDataType>
+bool Kernel<ImageDataType>::isSeparable(double tolerance) const {
+	std::vector<double> column, row;
+	return this->separate(column, row, tolerance);
+}
+
+template <typename ImageDataType>
+Kernel<ImageDataType>& Kernel<ImageDataType>::operator = (const Kernel<ImageDataType>& kernel) {
+	DataFrame<double>::operator = (kernel);
+	return *this;
+}
+
+typedef Kernel<float> Kernelf;
+typedef Kernel<double> Kerneld;
+typedef Kernel<uint16_t> Kernelu16;
+
+}
+
+#endif
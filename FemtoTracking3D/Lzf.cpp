@@ -0,0 +1,121 @@
+#include "Lzf.h"
+#include <vector>
+#include <cstring>
+#include <algorithm>
+
+namespace px {
+
+const static std::size_t LZF_HASH_LOG = 14;
+const static std::size_t LZF_MAX_LITERAL = 32;
+const static std::size_t LZF_MAX_OFFSET = 1 << 13;
+const static std::size_t LZF_MAX_MATCH = (1 << 8) + (1 << 3);
+
+std::size_t LzfCompressBound(std::size_t length) {
+	return length + length / LZF_MAX_LITERAL + 1;
+}
+
+/* Greedy matcher over a hash of the next three bytes. A control byte below
+ * 32 starts a literal run of ctrl + 1 bytes; otherwise its top three bits
+ * hold the match length - 2 (7 = extended by the next byte) and the low
+ * five bits the high part of the offset - 1, followed by its low byte. The
+ * control byte of the current literal run is reserved in advance and filled
+ * in (or given back) when the run ends.
+ */
+std::size_t LzfCompress(const uint8_t* in, std::size_t in_length, uint8_t* out, std::size_t out_length) {
+	if ( in == nullptr || out == nullptr || in_length == 0 || out_length < 2 ) return 0;
+
+	std::vector<uint32_t> table(std::size_t(1) << LZF_HASH_LOG, 0);
+	std::size_t ip = 0;
+	std::size_t op = 1;
+	std::size_t literals = 0;
+
+	while ( ip < in_length ) {
+		if ( ip + 2 < in_length ) {
+			uint32_t key = (uint32_t(in[ip]) << 16) | (uint32_t(in[ip + 1]) << 8) | uint32_t(in[ip + 2]);
+			uint32_t hash = (key * 2654435761u) >> (32 - LZF_HASH_LOG);
+			std::size_t ref = table[hash];
+			table[hash] = static_cast<uint32_t>(ip + 1);
+
+			// Table entries are positions + 1, 0 is empty.
+			if ( ref != 0 && ip - (ref - 1) <= LZF_MAX_OFFSET && std::memcmp(in + ref - 1, in + ip, 3) == 0 ) {
+				ref--;
+				std::size_t offset = ip - ref - 1;
+				std::size_t max_length = std::min(in_length - ip, LZF_MAX_MATCH);
+				std::size_t length = 3;
+				while ( length < max_length && in[ref + length] == in[ip + length] ) length++;
+
+				if ( op + 4 > out_length ) return 0;
+				if ( literals != 0 ) out[op - literals - 1] = static_cast<uint8_t>(literals - 1);
+				else op--;
+
+				std::size_t code = length - 2;
+				if ( code < 7 ) out[op++] = static_cast<uint8_t>((offset >> 8) + (code << 5));
+				else {
+					out[op++] = static_cast<uint8_t>((offset >> 8) + (7 << 5));
+					out[op++] = static_cast<uint8_t>(code - 7);
+				}
+				out[op++] = static_cast<uint8_t>(offset & 0xFF);
+
+				op++;
+				literals = 0;
+				ip += length;
+				continue;
+			}
+		}
+
+		if ( op >= out_length ) return 0;
+		out[op++] = in[ip++];
+		literals++;
+
+		if ( literals == LZF_MAX_LITERAL ) {
+			out[op - literals - 1] = static_cast<uint8_t>(literals - 1);
+			literals = 0;
+			op++;
+		}
+	}
+
+	if ( literals != 0 ) out[op - literals - 1] = static_cast<uint8_t>(literals - 1);
+	else op--;
+	return op;
+}
+
+std::size_t LzfDecompress(const uint8_t* in, std::size_t in_length, uint8_t* out, std::size_t out_length) {
+	if ( in == nullptr || out == nullptr ) return 0;
+
+	std::size_t ip = 0;
+	std::size_t op = 0;
+
+	while ( ip < in_length ) {
+		std::size_t control = in[ip++];
+
+		if ( control < LZF_MAX_LITERAL ) {
+			std::size_t length = control + 1;
+			if ( ip + length > in_length || op + length > out_length ) return 0;
+			std::memcpy(out + op, in + ip, length);
+			ip += length;
+			op += length;
+			continue;
+		}
+
+		std::size_t length = control >> 5;
+		if ( length == 7 ) {
+			if ( ip >= in_length ) return 0;
+			length += in[ip++];
+		}
+		if ( ip >= in_length ) return 0;
+
+		std::size_t distance = ((control & 0x1F) << 8) + in[ip++] + 1;
+		length += 2;
+		if ( distance > op || op + length > out_length ) return 0;
+
+		// Matches may overlap their own output (runs), those are copied bytewise.
+		const uint8_t* ref = out + op - distance;
+		if ( distance >= length ) std::memcpy(out + op, ref, length);
+		else for ( std::size_t i = 0; i < length; i++ ) out[op + i] = ref[i];
+		op += length;
+	}
+
+	return op;
+}
+
+}
@@ -0,0 +1,25 @@
+#ifndef PX_LZF_H
+#define PX_LZF_H
+
+#include <cstdint>
+#include <cstddef>
+
+namespace px {
+
+/* LZF block compression (the stream format of liblzf, as used by PCD
+ * binary_compressed data). Literal runs of up to 32 bytes and back
+ * references of 3-264 bytes within the last 8 KiB.
+ *
+ * Both functions return the number of bytes written to out, or 0 if out is
+ * too small (or the compressed data is damaged). Incompressible input grows
+ * by at most length / 32 + 1 bytes.
+ */
+std::size_t LzfCompress(const uint8_t* in, std::size_t in_length, uint8_t* out, std::size_t out_length);
+std::size_t LzfDecompress(const uint8_t* in, std::size_t in_length, uint8_t* out, std::size_t out_length);
+
+/* Output size that always fits the compressed form of length bytes. */
+std::size_t LzfCompressBound(std::size_t length);
+
+}
+
+#endif
@@ -0,0 +1,169 @@
+#include "MappedFile.h"
+#include <iostream>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace px {
+
+MappedFile::MappedFile() {
+	this->mapping = nullptr;
+	this->length = 0;
+#ifdef _WIN32
+	this->file_handle = INVALID_HANDLE_VALUE;
+	this->mapping_handle = nullptr;
+#else
+	this->file_descriptor = -1;
+#endif
+}
+
+MappedFile::~MappedFile() {
+	this->close();
+}
+
+#ifdef _WIN32
+bool MappedFile::open(const std::string& filename) {
+	if ( this->isOpen() ) this->close();
+
+	HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if ( file == INVALID_HANDLE_VALUE ) {
+		std::cerr << "[MappedFile:open] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	LARGE_INTEGER file_size;
+	if ( GetFileSizeEx(file, &file_size) == FALSE || file_size.QuadPart == 0 ) {
+		std::cerr << "[MappedFile:open] Error: Empty or unreadable file: " << filename << std::endl;
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping_handle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if ( mapping_handle == nullptr ) {
+		std::cerr << "[MappedFile:open] Error: CreateFileMapping failed (" << GetLastError() << "): " << filename << std::endl;
+		CloseHandle(file);
+		return false;
+	}
+
+	void* view = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+	if ( view == nullptr ) {
+		std::cerr << "[MappedFile:open] Error: MapViewOfFile failed (" << GetLastError() << "): " << filename << std::endl;
+		CloseHandle(mapping_handle);
+		CloseHandle(file);
+		return false;
+	}
+
+	this->file_handle = file;
+	this->mapping_handle = mapping_handle;
+	this->mapping = static_cast<const uint8_t*>(view);
+	this->length = static_cast<std::size_t>(file_size.QuadPart);
+	this->filename = filename;
+	return true;
+}
+
+bool MappedFile::close() {
+	if ( this->mapping == nullptr ) return false;
+
+	UnmapViewOfFile(this->mapping);
+	CloseHandle(this->mapping_handle);
+	CloseHandle(this->file_handle);
+	this->mapping = nullptr;
+	this->mapping_handle = nullptr;
+	this->file_handle = INVALID_HANDLE_VALUE;
+	this->length = 0;
+	return true;
+}
+
+bool MappedFile::willNeed(std::size_t offset, std::size_t length) const {
+	if ( this->mapping == nullptr || offset >= this->length ) return false;
+	if ( offset + length > this->length ) length = this->length - offset;
+
+	WIN32_MEMORY_RANGE_ENTRY range;
+	range.VirtualAddress = const_cast<uint8_t*>(this->mapping + offset);
+	range.NumberOfBytes = length;
+	return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != FALSE;
+}
+#else
+bool MappedFile::open(const std::string& filename) {
+	if ( this->isOpen() ) this->close();
+
+	int fd = ::open(filename.c_str(), O_RDONLY);
+	if ( fd < 0 ) {
+		std::cerr << "[MappedFile:open] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	struct stat info;
+	if ( fstat(fd, &info) != 0 || info.st_size == 0 ) {
+		std::cerr << "[MappedFile:open] Error: Empty or unreadable file: " << filename << std::endl;
+		::close(fd);
+		return false;
+	}
+
+	void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+	if ( view == MAP_FAILED ) {
+		std::cerr << "[MappedFile:open] Error: mmap failed: " << filename << std::endl;
+		::close(fd);
+		return false;
+	}
+
+	madvise(view, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+
+	this->file_descriptor = fd;
+	this->mapping = static_cast<const uint8_t*>(view);
+	this->length = static_cast<std::size_t>(info.st_size);
+	this->filename = filename;
+	return true;
+}
+
+bool MappedFile::close() {
+	if ( this->mapping == nullptr ) return false;
+
+	munmap(const_cast<uint8_t*>(this->mapping), this->length);
+	::close(this->file_descriptor);
+	this->mapping = nullptr;
+	this->file_descriptor = -1;
+	this->length = 0;
+	return true;
+}
+
+bool MappedFile::willNeed(std::size_t offset, std::size_t length) const {
+	if ( this->mapping == nullptr || offset >= this->length ) return false;
+	if ( offset + length > this->length ) length = this->length - offset;
+
+	// madvise requires a page aligned address.
+	std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+	std::size_t aligned = offset - (offset % page);
+	return madvise(const_cast<uint8_t*>(this->mapping + aligned), length + (offset - aligned), MADV_WILLNEED) == 0;
+}
+#endif
+
+bool MappedFile::isOpen() const {
+	return this->mapping != nullptr;
+}
+
+const uint8_t* MappedFile::data() const {
+	return this->mapping;
+}
+
+std::size_t MappedFile::size() const {
+	return this->length;
+}
+
+const std::string& MappedFile::getFilename() const {
+	return this->filename;
+}
+
+}
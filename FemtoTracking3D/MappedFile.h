@@ -0,0 +1,48 @@
+#ifndef PX_MAPPED_FILE_H
+#define PX_MAPPED_FILE_H
+
+#include <string>
+#include <cstdint>
+
+namespace px {
+
+/* Read-only memory mapping of a whole file (CreateFileMapping on Windows,
+ * mmap elsewhere). The mapped bytes are shared with the OS page cache, so
+ * reading through the mapping neither copies into a stream buffer nor
+ * duplicates the file in process memory.
+ */
+class MappedFile {
+public:
+	MappedFile();
+	~MappedFile();
+
+	bool open(const std::string& filename);
+	bool close();
+	bool isOpen() const;
+
+	const uint8_t* data() const;
+	std::size_t size() const;
+	const std::string& getFilename() const;
+
+	/* Hints that the byte range will be read soon (read-ahead). */
+	bool willNeed(std::size_t offset, std::size_t length) const;
+
+protected:
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator = (const MappedFile&) = delete;
+
+	std::string filename;
+	const uint8_t* mapping;
+	std::size_t length;
+
+#ifdef _WIN32
+	void* file_handle;
+	void* mapping_handle;
+#else
+	int file_descriptor;
+#endif
+};
+
+}
+
+#endif
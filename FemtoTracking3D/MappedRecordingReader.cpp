@@ -0,0 +1,190 @@
+#include "MappedRecordingReader.h"
+#include "RecordingReader.h"
+#include <algorithm>
+#include <cstring>
+
+namespace px {
+
+const static std::size_t FRAME_HEADER_SIZE = RECORDING_FRAME_HEADER_SIZE;
+
+MappedRecordingReader::MappedRecordingReader() {
+	this->file = nullptr;
+	this->type = SERIALIZE_COMPRESSED;
+	this->width = 0;
+	this->height = 0;
+	this->bLegacy = false;
+	this->bSorted = true;
+	this->bDelta = false;
+	this->bChunked = false;
+}
+
+MappedRecordingReader::~MappedRecordingReader() {
+	this->close();
+}
+
+/* The header, footer and index are parsed by RecordingReader (which only
+ * touches the index, or the frame headers of unindexed files), then the
+ * whole file is mapped for frame access.
+ */
+bool MappedRecordingReader::open(const std::string& filename, SerializeType legacy_type) {
+	if ( this->isOpen() ) this->close();
+
+	RecordingReader reader;
+	if ( reader.open(filename, legacy_type) == false ) return false;
+
+	this->index = reader.getIndex();
+	this->type = reader.getSerializeType();
+	this->width = reader.getWidth();
+	this->height = reader.getHeight();
+	this->bLegacy = reader.isLegacy();
+	this->rays = reader.getRayTable();
+	this->bDelta = reader.isDeltaCoded();
+	this->bChunked = reader.isChunked();
+	this->bSorted = reader.isSorted();
+	if ( this->bDelta ) this->decoder.configure(this->type, reader.getKeyframeInterval());
+	if ( this->bDelta || this->bChunked ) {
+		this->frame_sizes.resize(this->index.size());
+		for ( std::size_t i = 0; i < this->index.size(); i++ )
+			this->frame_sizes[i] = static_cast<std::size_t>(reader.getFrameSize(i));
+	}
+	reader.close();
+
+	this->file = std::make_shared<MappedFile>();
+	if ( this->file->open(filename) == false ) {
+		this->file = nullptr;
+		this->index.clear();
+		return false;
+	}
+
+	// Frame sizes follow from each frame header (delta and chunked frames from the index), all within the mapping.
+	const uint8_t* base = this->file->data();
+	this->frame_sizes.resize(this->index.size());
+	for ( std::size_t i = 0; i < this->index.size(); i++ ) {
+		uint32_t dims[2];
+		bool bInside = this->index[i].offset + sizeof(dims) <= this->file->size();
+
+		if ( bInside && this->bDelta == false && this->bChunked == false ) {
+			std::memcpy(dims, base + this->index[i].offset, sizeof(dims));
+			this->frame_sizes[i] = DepthCloud::SerializedSize(dims[0], dims[1], this->type);
+		}
+
+		if ( bInside == false || this->index[i].offset + this->frame_sizes[i] > this->file->size() ) {
+			std::cerr << "[MappedRecordingReader:open] Warning: Frame " << i << " exceeds the file, truncating the index." << std::endl;
+			this->index.resize(i);
+			this->frame_sizes.resize(i);
+			break;
+		}
+	}
+
+	return true;
+}
+
+bool MappedRecordingReader::close() {
+	if ( this->file == nullptr ) return false;
+	this->file = nullptr;
+	this->rays = nullptr;
+	this->index.clear();
+	this->frame_sizes.clear();
+	this->decoder.reset();
+	this->bDelta = false;
+	this->bChunked = false;
+	return true;
+}
+
+bool MappedRecordingReader::isOpen() const {
+	return this->file != nullptr;
+}
+
+const uint8_t* MappedRecordingReader::getFrameData(std::size_t frame, std::size_t& length) const {
+	length = 0;
+	if ( this->file == nullptr || frame >= this->index.size() ) return nullptr;
+	length = this->frame_sizes[frame];
+	const uint8_t* frame_data = this->file->data() + this->index[frame].offset;
+	if ( this->bChunked == false ) return frame_data;
+
+	const uint8_t* payload = RecordingChunkPayload(frame_data, length, length);
+	if ( payload == nullptr ) std::cerr << "[MappedRecordingReader:getFrameData] Error: Checksum mismatch in frame " << frame << std::endl;
+	return payload;
+}
+
+DepthCloudView MappedRecordingReader::getView(std::size_t frame) const {
+	if ( this->type != SERIALIZE_DEFAULT && this->type != SERIALIZE_RAW ) return DepthCloudView();
+
+	std::size_t length = 0;
+	const uint8_t* frame_data = this->getFrameData(frame, length);
+	if ( frame_data == nullptr ) return DepthCloudView();
+
+	uint32_t dims[2];
+	uint64_t timestamp;
+	std::memcpy(dims, frame_data, sizeof(dims));
+	std::memcpy(&timestamp, frame_data + sizeof(dims), sizeof(uint64_t));
+
+	// Raw frame payloads are 4-byte aligned: the header and every raw frame are multiples of 4 bytes.
+	const PointXYZ<Real>* points = reinterpret_cast<const PointXYZ<Real>*>(frame_data + FRAME_HEADER_SIZE);
+	return DepthCloudView(points, dims[0], dims[1], static_cast<std::size_t>(timestamp), this->file);
+}
+
+bool MappedRecordingReader::read(std::size_t frame, DepthCloud& cloud) {
+	std::size_t length = 0;
+	const uint8_t* frame_data = this->getFrameData(frame, length);
+	if ( frame_data == nullptr ) return false;
+	if ( this->rays != nullptr ) cloud.setRayTable(this->rays);
+
+	if ( this->bDelta ) {
+		DeltaFrameDecoder::FrameSource source = [this](std::size_t index, std::size_t& size) { return this->getFrameData(index, size); };
+		return this->decoder.decode(frame, source, cloud);
+	}
+
+	return cloud.decode(frame_data, length, this->type);
+}
+
+bool MappedRecordingReader::prefetch(std::size_t frame, std::size_t count) const {
+	if ( this->file == nullptr || frame >= this->index.size() ) return false;
+	std::size_t last = std::min(frame + count, this->index.size()) - 1;
+	std::size_t begin = static_cast<std::size_t>(this->index[frame].offset);
+	std::size_t end = static_cast<std::size_t>(this->index[last].offset) + this->frame_sizes[last];
+	return this->file->willNeed(begin, end - begin);
+}
+
+std::size_t MappedRecordingReader::findFrame(uint64_t timestamp) const {
+	return RecordingReader::FindFrame(this->index, timestamp, this->bSorted);
+}
+
+std::size_t MappedRecordingReader::getFrameCount() const {
+	return this->index.size();
+}
+
+uint64_t MappedRecordingReader::getTimestamp(std::size_t frame) const {
+	if ( frame >= this->index.size() ) return 0;
+	return this->index[frame].timestamp;
+}
+
+const std::vector<RecordingIndexEntry>& MappedRecordingReader::getIndex() const {
+	return this->index;
+}
+
+bool MappedRecordingReader::isDeltaCoded() const {
+	return this->bDelta;
+}
+
+bool MappedRecordingReader::isLegacy() const {
+	return this->bLegacy;
+}
+
+SerializeType MappedRecordingReader::getSerializeType() const {
+	return this->type;
+}
+
+const std::shared_ptr<const RayTable>& MappedRecordingReader::getRayTable() const {
+	return this->rays;
+}
+
+std::size_t MappedRecordingReader::getWidth() const {
+	return this->width;
+}
+
+std::size_t MappedRecordingReader::getHeight() const {
+	return this->height;
+}
+
+}
@@ -0,0 +1,84 @@
+#ifndef PX_MAPPED_RECORDING_READER_H
+#define PX_MAPPED_RECORDING_READER_H
+
+#include <memory>
+#include <vector>
+#include "MappedFile.h"
+#include "RecordingFormat.h"
+#include "DepthCloud.h"
+#include "DeltaCodec.h"
+
+namespace px {
+
+/* Random access reader for DepthCloud recordings over a memory mapping.
+ *
+ * Raw (uncompressed) frames are exposed as views directly over the mapped
+ * pages, with no read copy at all. Compressed frames are decoded straight
+ * from the mapped pages into the destination cloud, without the
+ * intermediate stream buffer and scratch copy of RecordingReader.
+ *
+ * Views keep the mapping alive (they share ownership of it), so they remain
+ * valid after the reader is closed or destroyed.
+ *
+ * Delta coded recordings keep the last decoded frame as the reference for
+ * the next read(), so read() modifies the reader and is not thread-safe.
+ * Threads sharing a reader of a recording that is not delta coded can
+ * decode its frames from getFrameData() with DepthCloud::decode, which
+ * only reads the mapping.
+ */
+class MappedRecordingReader {
+public:
+	MappedRecordingReader();
+	~MappedRecordingReader();
+
+	bool open(const std::string& filename, SerializeType legacy_type = SERIALIZE_COMPRESSED);
+	bool close();
+	bool isOpen() const;
+
+	/* Zero-copy view of a raw frame. Returns an invalid view for compressed
+	 * recordings, use read() to decode those.
+	 */
+	DepthCloudView getView(std::size_t frame) const;
+	bool read(std::size_t frame, DepthCloud& cloud);
+
+	/* Serialized bytes of a frame inside the mapping (as decoded by
+	 * DepthCloud::decode). The chunk checksum of chunked recordings is
+	 * verified on every call, nullptr is returned for damaged frames.
+	 */
+	const uint8_t* getFrameData(std::size_t frame, std::size_t& length) const;
+
+	/* Asks the OS to page in the given frames ahead of use. */
+	bool prefetch(std::size_t frame, std::size_t count = 1) const;
+
+	std::size_t findFrame(uint64_t timestamp) const;
+	std::size_t getFrameCount() const;
+	uint64_t getTimestamp(std::size_t frame) const;
+	const std::vector<RecordingIndexEntry>& getIndex() const;
+
+	bool isLegacy() const;
+	bool isDeltaCoded() const;
+	SerializeType getSerializeType() const;
+	const std::shared_ptr<const RayTable>& getRayTable() const;
+	std::size_t getWidth() const;
+	std::size_t getHeight() const;
+
+protected:
+	MappedRecordingReader(const MappedRecordingReader&) = delete;
+	MappedRecordingReader& operator = (const MappedRecordingReader&) = delete;
+
+	std::shared_ptr<MappedFile> file;
+	std::vector<RecordingIndexEntry> index;
+	std::vector<std::size_t> frame_sizes;
+	std::shared_ptr<const RayTable> rays;
+	DeltaFrameDecoder decoder;
+	SerializeType type;
+	std::size_t width, height;
+	bool bLegacy;
+	bool bSorted;
+	bool bDelta;
+	bool bChunked;
+};
+
+}
+
+#endif
@@ -1,207 +1,436 @@
-#include "OrbbecCamera.h"
-#include <sstream>
-
-namespace px {
-
-const static uint32_t DEFAULT_TIMEOUT_MS = 100;
-const static std::size_t INFRARED_WIDTH = 640;
-const static std::size_t INFRARED_HEIGHT = 480;
-const static std::size_t DEPTH_WIDTH = 640;
-const static std::size_t DEPTH_HEIGHT = 480;
-const static std::size_t COLOR_WIDTH = 1920;
-const static std::size_t COLOR_HEIGHT = 1080;
-
-OrbbecCamera::OrbbecCamera(bool bEnableInfrared, bool bEnablePointCloud) : PhysicalCamera() {
-	this->camera = std::make_unique<FemtoImp>();
-	this->bInfraredEnabled = bEnableInfrared;
-	this->bPointCloudEnabled = bEnablePointCloud;
-	this->timeout_ms = DEFAULT_TIMEOUT_MS;
-	this->infrared_image = nullptr;
-	this->depth_cloud = nullptr;
-	this->bConnected = false;
-}
-
-OrbbecCamera::~OrbbecCamera() {}
-
-bool OrbbecCamera::connect() {
-	if ( this->camera == nullptr ) return false;
-
-	try {
-		ob::Context::setLoggerSeverity(OB_LOG_SEVERITY_WARN);
-		this->camera->pipeline = std::make_shared<ob::Pipeline>();
-	}
-	catch (ob::Error e) {
-		std::cerr << "[OrbbecCamera:connect] Error: " << e.getMessage() << std::endl;
-		return false;
-	}
-
-	std::shared_ptr<ob::Config> config = std::make_shared<ob::Config>();
-
-	if ( this->bInfraredEnabled ) {
-		auto& p = this->camera->pipeline;
-		auto profiles = p->getStreamProfileList(OB_SENSOR_IR);
-		auto irProfile = profiles->getVideoStreamProfile(INFRARED_WIDTH, INFRARED_HEIGHT, OB_FORMAT_Y16);
-
-		if ( !irProfile ) irProfile = profiles->getProfile(0)->as<ob::VideoStreamProfile>();
-		config->enableStream(irProfile);
-
-		this->infrared_image = std::make_shared<IntensityImage<uint16_t>>();
-		this->infrared_image->resize(INFRARED_WIDTH, INFRARED_HEIGHT);
-	}
-
-	if ( this->bPointCloudEnabled ) {
-		auto& p = this->camera->pipeline;
-		auto depthProfiles = p->getStreamProfileList(OB_SENSOR_DEPTH);
-		auto depthProfile = depthProfiles->getVideoStreamProfile(DEPTH_WIDTH, DEPTH_HEIGHT, OB_FORMAT_Y16);
-
-		if ( !depthProfile ) depthProfile = depthProfiles->getProfile(0)->as<ob::VideoStreamProfile>();
-		config->enableStream(depthProfile);
-
-		this->depth_cloud = std::make_shared<DepthCloud>();
-		this->depth_cloud->resize(DEPTH_WIDTH, DEPTH_HEIGHT);
-	}
-
-	this->camera->pipeline->start(config);
-	this->bConnected = true;
-	return true;
-}
-
-inline bool UpdateIR(const std::unique_ptr<FemtoImp>& camera, const std::shared_ptr<ob::FrameSet>& frameset, const std::shared_ptr<IntensityImage<uint16_t>>& infrared_image) {
-	if ( camera == nullptr ) return false;
-	if ( frameset == nullptr ) return false;
-
-	const auto& frame = frameset->irFrame();
-	
-	if ( frame && frame->format() == OB_FORMAT_Y16 ) {
-		auto video_frame = frame->as<ob::VideoFrame>();
-		std::size_t width = video_frame->width();
-		std::size_t height = video_frame->height();
-
-		if ( infrared_image->width() != width || infrared_image->height() != height )
-			infrared_image->resize(width, height);
-
-		uint16_t* ir_data = infrared_image->getData();
-		std::memcpy(ir_data, video_frame->data(), width*height*sizeof(uint16_t));
-	}
-
-	return false;
-}
-
-inline bool UpdateCloud(const std::unique_ptr<FemtoImp>& camera, const std::shared_ptr<ob::FrameSet>& frameset, const std::shared_ptr<DepthCloud>& cloud) {
-	if ( camera == nullptr ) return false;
-	if ( frameset == nullptr ) return false;
-
-	try {
-		camera->point_cloud_filter.setCameraParam(camera->pipeline->getCameraParam());
-		camera->point_cloud_filter.setCreatePointFormat(OB_FORMAT_POINT);
-		std::shared_ptr<ob::Frame> frame = camera->point_cloud_filter.process(frameset);
-		
-		if ( frame ) {
-			std::size_t n = frame->dataSize() / sizeof(OBPoint);
-
-			if ( n != DEPTH_WIDTH * DEPTH_HEIGHT ) {
-				std::cerr << "[OrbbecCamera:UpdateCloud] Error: Frame size n != width*height" << std::endl;
-				return false;
-			}
-
-			OBPoint* obpoint_data = (OBPoint*)frame->data();
-			PointXYZ<Real>* cloud_data = cloud->getData();
-			std::memcpy(cloud_data, obpoint_data, n*sizeof(OBPoint));
-		}
-
-	}
-	catch (std::exception& e) {
-		std::cout << "[OrbbecCamera:UpdateCloud] Error: Get point cloud failed: " << e.what() << std::endl;
-	}
-
-	return false;
-}
-
-bool OrbbecCamera::update() {
-	if ( this->camera == nullptr ) return false;
-	auto& p = this->camera->pipeline;
-
-	this->camera->frame_set = p->waitForFrames(this->timeout_ms);
-	if ( this->camera->frame_set != nullptr && this->camera->frame_set->depthFrame() )
-		UpdateCloud(this->camera, this->camera->frame_set, this->depth_cloud);
-	if ( this->camera->frame_set != nullptr && this->camera->frame_set->irFrame() )
-		UpdateIR(this->camera, this->camera->frame_set, this->infrared_image);
-}
-
-bool OrbbecCamera::disconnect() {
-	if ( this->camera == nullptr ) return false;
-	if ( this->isConnected() == false ) return false;
-	
-	this->camera->pipeline->stop();
-	this->bInfraredEnabled = false;
-	this->bPointCloudEnabled = false;
-	this->timeout_ms = DEFAULT_TIMEOUT_MS;
-	this->infrared_image = nullptr;
-	this->depth_cloud = nullptr;
-	this->bConnected = false;
-
-	return true;
-}
-
-bool OrbbecCamera::isConnected() const {
-	if ( this->camera == nullptr ) return false;
-	return this->bConnected;
-}
-
-std::string OrbbecCamera::toString() const {
-	if ( this->camera == nullptr ) return std::string("No camera");
-
-	auto& p = this->camera->pipeline;
-	const auto info = p->getDevice()->getDeviceInfo();
-	const auto asic_name = info->asicName();
-	const auto serial = info->serialNumber();
-	const auto name = info->name();
-	const auto connection_type = info->connectionType();
-	const auto device_id = info->uid();
-	const auto version = info->hardwareVersion();
-	const auto device_type = info->deviceType();
-
-	std::stringstream stream;
-	stream << "ASIC Name: " << asic_name << std::endl;
-	stream << "Serial: " << serial << std::endl;
-	stream << "Name: " << name << std::endl;
-	stream << "Connection Type: " << connection_type << std::endl;
-	stream << "Device ID: " << device_id << std::endl;
-	stream << "Version: " << version << std::endl;
-	stream << "Device Type: OBDeviceType(" << device_type << ")" << std::endl;
-	return stream.str();
-}
-
-std::size_t OrbbecCamera::getInfraredWidth() const {
-	return INFRARED_WIDTH;
-}
-
-std::size_t OrbbecCamera::getInfraredHeight() const {
-	return INFRARED_HEIGHT;
-}
-
-std::size_t OrbbecCamera::getCloudWidth() const {
-	return DEPTH_WIDTH;
-}
-
-std::size_t OrbbecCamera::getCloudHeight() const {
-	return DEPTH_HEIGHT;
-}
-
-std::size_t OrbbecCamera::getColorWidth() const {
-	return COLOR_WIDTH;
-}
-
-std::size_t OrbbecCamera::getColorHeight() const {
-	return COLOR_HEIGHT;
-}
-
-const std::shared_ptr<IntensityImage<uint16_t>>& OrbbecCamera::getInfraredImage() const {
-	return this->infrared_image;
-}
-
-const std::shared_ptr<DepthCloud>& OrbbecCamera::getDepthCloud() const {
-	return this->depth_cloud;
-}
-
-}
+#include "OrbbecCamera.h"
+#include <sstream>
+
+namespace px {
+
+const static uint32_t DEFAULT_TIMEOUT_MS = 100;
+const static std::size_t INFRARED_WIDTH = 640;
+const static std::size_t INFRARED_HEIGHT = 480;
+const static std::size_t DEPTH_WIDTH = 640;
+const static std::size_t DEPTH_HEIGHT = 480;
+const static std::size_t COLOR_WIDTH = 1920;
+const static std::size_t COLOR_HEIGHT = 1080;
+
+/* Y16 depth is in millimeters, as are the SDK point cloud coordinates. */
+const static float DEPTH_VALUE_SCALE = 1.0f;
+
+OrbbecCamera::OrbbecCamera(bool bEnableInfrared, bool bEnablePointCloud) : PhysicalCamera() {
+	this->camera = std::make_unique<FemtoImp>();
+	this->bInfraredEnabled = bEnableInfrared;
+	this->bPointCloudEnabled = bEnablePointCloud;
+	this->timeout_ms = DEFAULT_TIMEOUT_MS;
+	this->bConnected = false;
+	this->bZeroCopy = false;
+	this->intrinsics = CameraIntrinsics();
+	this->ray_table = nullptr;
+	this->bCapturing = false;
+	this->captured_frames = 0;
+	this->capture_queue = nullptr;
+}
+
+OrbbecCamera::~OrbbecCamera() {
+	this->stopCapture();
+}
+
+bool OrbbecCamera::connect() {
+	if ( this->camera == nullptr ) return false;
+
+	try {
+		ob::Context::setLoggerSeverity(OB_LOG_SEVERITY_WARN);
+		this->camera->pipeline = std::make_shared<ob::Pipeline>();
+	}
+	catch (const ob::Error& e) {
+		std::cerr << "[OrbbecCamera:connect] Error: " << e.getMessage() << std::endl;
+		return false;
+	}
+
+	std::shared_ptr<ob::Config> config = std::make_shared<ob::Config>();
+
+	if ( this->bInfraredEnabled ) {
+		auto& p = this->camera->pipeline;
+		auto profiles = p->getStreamProfileList(OB_SENSOR_IR);
+		auto irProfile = profiles->getVideoStreamProfile(INFRARED_WIDTH, INFRARED_HEIGHT, OB_FORMAT_Y16);
+
+		if ( !irProfile ) irProfile = profiles->getProfile(0)->as<ob::VideoStreamProfile>();
+		config->enableStream(irProfile);
+
+		for ( std::size_t i = 0; i < this->frames.SlotCount(); i++ )
+			this->frames.slot(i).infrared_image = std::make_shared<IntensityImage<uint16_t>>(INFRARED_WIDTH, INFRARED_HEIGHT);
+	}
+
+	if ( this->bPointCloudEnabled ) {
+		auto& p = this->camera->pipeline;
+		auto depthProfiles = p->getStreamProfileList(OB_SENSOR_DEPTH);
+		auto depthProfile = depthProfiles->getVideoStreamProfile(DEPTH_WIDTH, DEPTH_HEIGHT, OB_FORMAT_Y16);
+
+		if ( !depthProfile ) depthProfile = depthProfiles->getProfile(0)->as<ob::VideoStreamProfile>();
+		config->enableStream(depthProfile);
+
+		for ( std::size_t i = 0; i < this->frames.SlotCount(); i++ )
+			this->frames.slot(i).depth_cloud = std::make_shared<DepthCloud>(DEPTH_WIDTH, DEPTH_HEIGHT);
+	}
+
+	this->camera->pipeline->start(config);
+
+	if ( this->bPointCloudEnabled ) {
+		OBCameraParam param = this->camera->pipeline->getCameraParam();
+		this->intrinsics.width = static_cast<uint32_t>(param.depthIntrinsic.width);
+		this->intrinsics.height = static_cast<uint32_t>(param.depthIntrinsic.height);
+		this->intrinsics.fx = param.depthIntrinsic.fx;
+		this->intrinsics.fy = param.depthIntrinsic.fy;
+		this->intrinsics.cx = param.depthIntrinsic.cx;
+		this->intrinsics.cy = param.depthIntrinsic.cy;
+		this->intrinsics.depth_scale = DEPTH_VALUE_SCALE;
+
+		std::shared_ptr<RayTable> rays = std::make_shared<RayTable>();
+		if ( rays->build(this->intrinsics) ) this->ray_table = rays;
+	}
+
+	this->bConnected = true;
+	return true;
+}
+
+inline bool UpdateIR(const std::unique_ptr<FemtoImp>& camera, const std::shared_ptr<ob::FrameSet>& frameset, const std::shared_ptr<IntensityImage<uint16_t>>& infrared_image) {
+	if ( camera == nullptr ) return false;
+	if ( frameset == nullptr ) return false;
+
+	const auto& frame = frameset->irFrame();
+	
+	if ( frame && frame->format() == OB_FORMAT_Y16 ) {
+		auto video_frame = frame->as<ob::VideoFrame>();
+		std::size_t width = video_frame->width();
+		std::size_t height = video_frame->height();
+
+		if ( infrared_image->width() != width || infrared_image->height() != height )
+			infrared_image->resize(width, height);
+
+		uint16_t* ir_data = infrared_image->getData();
+		std::memcpy(ir_data, video_frame->data(), width*height*sizeof(uint16_t));
+		infrared_image->timestamp();
+		return true;
+	}
+
+	return false;
+}
+
+/* Copies the native Y16 depth image into the cloud, so SERIALIZE_DEPTH
+ * records the sensor depth and not the z of the SDK point cloud. Frames the
+ * ray table does not describe (another size or depth scale) get none.
+ */
+inline bool UpdateDepth(const std::shared_ptr<ob::FrameSet>& frameset, const std::shared_ptr<DepthCloud>& depth_cloud, const CameraIntrinsics& intrinsics) {
+	if ( frameset == nullptr ) return false;
+	if ( depth_cloud == nullptr ) return false;
+
+	const auto& frame = frameset->depthFrame();
+
+	if ( frame && frame->format() == OB_FORMAT_Y16 ) {
+		std::size_t width = frame->width();
+		std::size_t height = frame->height();
+
+		if ( width != depth_cloud->width() || height != depth_cloud->height() ) return false;
+		if ( frame->getValueScale() != intrinsics.depth_scale ) return false;
+		return depth_cloud->setNativeDepth(reinterpret_cast<const uint16_t*>(frame->data()), width*height);
+	}
+
+	return false;
+}
+
+static_assert(sizeof(OBPoint) == sizeof(PointXYZ<Real>), "OBPoint and PointXYZ<Real> layouts must match.");
+
+inline bool UpdateCloud(const std::unique_ptr<FemtoImp>& camera, const std::shared_ptr<ob::FrameSet>& frameset, FemtoFrame& femto_frame, bool bCopy) {
+	if ( camera == nullptr ) return false;
+	if ( frameset == nullptr ) return false;
+
+	try {
+		camera->point_cloud_filter.setCameraParam(camera->pipeline->getCameraParam());
+		camera->point_cloud_filter.setCreatePointFormat(OB_FORMAT_POINT);
+		std::shared_ptr<ob::Frame> frame = camera->point_cloud_filter.process(frameset);
+		
+		if ( frame ) {
+			std::size_t n = frame->dataSize() / sizeof(OBPoint);
+			const auto& cloud = femto_frame.depth_cloud;
+
+			if ( n != cloud->width() * cloud->height() ) {
+				std::cerr << "[OrbbecCamera:UpdateCloud] Error: Frame size n != width*height" << std::endl;
+				return false;
+			}
+
+			femto_frame.point_frame = frame;
+			femto_frame.point_stamp = cloud->timestamp();
+			if ( bCopy == false ) return true;
+
+			OBPoint* obpoint_data = (OBPoint*)frame->data();
+			PointXYZ<Real>* cloud_data = cloud->getData();
+			std::memcpy(cloud_data, obpoint_data, n*sizeof(OBPoint));
+			return true;
+		}
+
+	}
+	catch (std::exception& e) {
+		std::cout << "[OrbbecCamera:UpdateCloud] Error: Get point cloud failed: " << e.what() << std::endl;
+	}
+
+	return false;
+}
+
+/* True when the frame is missing or a consumer still holds a copy of it.
+ * Consumers only copy from the front slot, so the count of a back slot frame
+ * can only drop. The acquire fence pairs with the release of the consumer's
+ * last shared_ptr decrement: its reads of the frame happen before the
+ * producer overwrites it.
+ */
+template <typename T>
+inline bool FrameInUse(const std::shared_ptr<T>& frame) {
+	if ( frame == nullptr || frame.use_count() > 1 ) return true;
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return false;
+}
+
+/* A consumer may still hold the frame last handed out from this slot (it
+ * copied the shared_ptr). Such frames are never overwritten; the slot gets a
+ * fresh frame instead, which is cheap since the buffers come from the pool.
+ */
+inline bool PrepareFrame(FemtoFrame& frame, bool bInfrared, bool bPointCloud) {
+	if ( bPointCloud && FrameInUse(frame.depth_cloud) )
+		frame.depth_cloud = std::make_shared<DepthCloud>(DEPTH_WIDTH, DEPTH_HEIGHT);
+	if ( bInfrared && FrameInUse(frame.infrared_image) )
+		frame.infrared_image = std::make_shared<IntensityImage<uint16_t>>(INFRARED_WIDTH, INFRARED_HEIGHT);
+	frame.point_frame = nullptr;
+	return true;
+}
+
+bool OrbbecCamera::convert(const std::shared_ptr<ob::FrameSet>& frame_set, FemtoFrame& frame) {
+	if ( frame_set == nullptr ) return false;
+	PrepareFrame(frame, this->bInfraredEnabled, this->bPointCloudEnabled);
+	if ( frame.depth_cloud != nullptr ) {
+		frame.depth_cloud->setRayTable(this->ray_table);
+		frame.depth_cloud->clearNativeDepth();
+	}
+
+	if ( this->bPointCloudEnabled && frame_set->depthFrame() ) {
+		// Zero-copy leaves the cloud stale, its native depth too.
+		if ( UpdateCloud(this->camera, frame_set, frame, !this->bZeroCopy) && this->bZeroCopy == false )
+			UpdateDepth(frame_set, frame.depth_cloud, this->intrinsics);
+	}
+	if ( this->bInfraredEnabled && frame_set->irFrame() )
+		UpdateIR(this->camera, frame_set, frame.infrared_image);
+
+	return true;
+}
+
+bool OrbbecCamera::process(const std::shared_ptr<ob::FrameSet>& frame_set) {
+	if ( this->convert(frame_set, this->frames.back()) == false ) return false;
+	return this->frames.publish();
+}
+
+bool OrbbecCamera::update() {
+	if ( this->camera == nullptr ) return false;
+	auto& p = this->camera->pipeline;
+	if ( p == nullptr ) return false;
+
+	if ( this->bCapturing ) {
+		FemtoCapture capture;
+		if ( this->capture_queue->tryPop(capture) == false ) return false;
+
+		this->camera->frame_set = capture.frame_set;
+		this->frames.back() = std::move(capture.frame);
+		return this->frames.publish();
+	}
+
+	this->camera->frame_set = p->waitForFrames(this->timeout_ms);
+	if ( this->camera->frame_set == nullptr ) return false;
+	return this->process(this->camera->frame_set);
+}
+
+bool OrbbecCamera::captureLoop() {
+	auto& p = this->camera->pipeline;
+
+	while ( this->bCapturing ) {
+		std::shared_ptr<ob::FrameSet> frame_set = nullptr;
+
+		try {
+			frame_set = p->waitForFrames(this->timeout_ms);
+		}
+		catch (const ob::Error& e) {
+			std::cerr << "[OrbbecCamera:captureLoop] Error: " << e.getMessage() << std::endl;
+			continue;
+		}
+
+		if ( frame_set == nullptr ) continue;
+
+		FemtoCapture capture;
+		capture.frame_set = frame_set;
+		if ( this->convert(frame_set, capture.frame) == false ) continue;
+
+		this->captured_frames++;
+		this->capture_queue->push(std::move(capture));
+	}
+
+	return true;
+}
+
+bool OrbbecCamera::startCapture(std::size_t queue_capacity, QueueDropPolicy policy) {
+	if ( this->isConnected() == false ) {
+		std::cerr << "[OrbbecCamera:startCapture] Error: Camera is not connected." << std::endl;
+		return false;
+	}
+
+	if ( this->bCapturing ) return false;
+	if ( policy == QUEUE_BLOCK ) {
+		std::cerr << "[OrbbecCamera:startCapture] Error: Capture cannot block on the consumer, use a drop policy." << std::endl;
+		return false;
+	}
+
+	this->capture_queue = std::make_unique<BoundedQueue<FemtoCapture> >(queue_capacity, policy);
+	this->captured_frames = 0;
+	this->bCapturing = true;
+	this->capture_thread = std::thread(&OrbbecCamera::captureLoop, this);
+	return true;
+}
+
+bool OrbbecCamera::stopCapture() {
+	if ( this->bCapturing == false ) return false;
+	this->bCapturing = false;
+	if ( this->capture_thread.joinable() ) this->capture_thread.join();
+	this->capture_queue->close();
+	return true;
+}
+
+bool OrbbecCamera::isCapturing() const {
+	return this->bCapturing;
+}
+
+std::size_t OrbbecCamera::getCapturedFrames() const {
+	return this->captured_frames;
+}
+
+std::size_t OrbbecCamera::getDroppedFrames() const {
+	if ( this->capture_queue == nullptr ) return 0;
+	return this->capture_queue->getDropped();
+}
+
+std::size_t OrbbecCamera::getQueueDepth() const {
+	if ( this->capture_queue == nullptr ) return 0;
+	return this->capture_queue->size();
+}
+
+bool OrbbecCamera::disconnect() {
+	if ( this->camera == nullptr ) return false;
+	if ( this->isConnected() == false ) return false;
+	
+	this->stopCapture();
+	this->camera->pipeline->stop();
+	this->bInfraredEnabled = false;
+	this->bPointCloudEnabled = false;
+	this->timeout_ms = DEFAULT_TIMEOUT_MS;
+	this->camera->frame_set = nullptr;
+	this->intrinsics = CameraIntrinsics();
+	this->ray_table = nullptr;
+	for ( std::size_t i = 0; i < this->frames.SlotCount(); i++ )
+		this->frames.slot(i) = FemtoFrame();
+	this->bConnected = false;
+
+	return true;
+}
+
+bool OrbbecCamera::isConnected() const {
+	if ( this->camera == nullptr ) return false;
+	return this->bConnected;
+}
+
+std::string OrbbecCamera::toString() const {
+	if ( this->camera == nullptr ) return std::string("No camera");
+
+	auto& p = this->camera->pipeline;
+	const auto info = p->getDevice()->getDeviceInfo();
+	const auto asic_name = info->asicName();
+	const auto serial = info->serialNumber();
+	const auto name = info->name();
+	const auto connection_type = info->connectionType();
+	const auto device_id = info->uid();
+	const auto version = info->hardwareVersion();
+	const auto device_type = info->deviceType();
+
+	std::stringstream stream;
+	stream << "ASIC Name: " << asic_name << std::endl;
+	stream << "Serial: " << serial << std::endl;
+	stream << "Name: " << name << std::endl;
+	stream << "Connection Type: " << connection_type << std::endl;
+	stream << "Device ID: " << device_id << std::endl;
+	stream << "Version: " << version << std::endl;
+	stream << "Device Type: OBDeviceType(" << device_type << ")" << std::endl;
+	return stream.str();
+}
+
+std::size_t OrbbecCamera::getInfraredWidth() const {
+	return INFRARED_WIDTH;
+}
+
+std::size_t OrbbecCamera::getInfraredHeight() const {
+	return INFRARED_HEIGHT;
+}
+
+std::size_t OrbbecCamera::getCloudWidth() const {
+	return DEPTH_WIDTH;
+}
+
+std::size_t OrbbecCamera::getCloudHeight() const {
+	return DEPTH_HEIGHT;
+}
+
+std::size_t OrbbecCamera::getColorWidth() const {
+	return COLOR_WIDTH;
+}
+
+std::size_t OrbbecCamera::getColorHeight() const {
+	return COLOR_HEIGHT;
+}
+
+const CameraIntrinsics& OrbbecCamera::getIntrinsics() const {
+	return this->intrinsics;
+}
+
+const std::shared_ptr<const RayTable>& OrbbecCamera::getRayTable() const {
+	return this->ray_table;
+}
+
+std::shared_ptr<IntensityImage<uint16_t>> OrbbecCamera::getInfraredImage() const {
+	return this->frames.front().infrared_image;
+}
+
+std::shared_ptr<DepthCloud> OrbbecCamera::getDepthCloud() const {
+	return this->frames.front().depth_cloud;
+}
+
+FemtoFrame OrbbecCamera::getFrame() const {
+	this->frames.update();
+	return this->frames.front();
+}
+
+bool OrbbecCamera::setZeroCopy(bool bEnable) {
+	this->bZeroCopy = bEnable;
+	return true;
+}
+
+bool OrbbecCamera::isZeroCopy() const {
+	return this->bZeroCopy;
+}
+
+DepthCloudView OrbbecCamera::getDepthCloudView() const {
+	const FemtoFrame& femto_frame = this->frames.front();
+
+	if ( this->bZeroCopy == false ) {
+		if ( femto_frame.depth_cloud == nullptr ) return DepthCloudView();
+		return DepthCloudView(femto_frame.depth_cloud);
+	}
+
+	if ( femto_frame.point_frame == nullptr || femto_frame.depth_cloud == nullptr ) return DepthCloudView();
+	const auto& frame = femto_frame.point_frame;
+	const auto& cloud = femto_frame.depth_cloud;
+
+	// The SDK frame was checked against the cloud size by UpdateCloud.
+	const PointXYZ<Real>* points = reinterpret_cast<const PointXYZ<Real>*>(frame->data());
+	return DepthCloudView(points, cloud->width(), cloud->height(), femto_frame.point_stamp, frame);
+}
+
+}
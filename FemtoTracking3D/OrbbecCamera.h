@@ -1,51 +1,128 @@
-
-#pragma once
-
-#include <memory>
-#include "PhysicalCamera.h"
-#include "IntensityImage.h"
-#include "DepthCloud.h"
-
-/* Orbbec */
-#include "libobsensor/ObSensor.hpp"
-
-namespace px {
-
-struct FemtoImp {
-	std::shared_ptr<ob::Pipeline> pipeline = nullptr;
-	ob::PointCloudFilter point_cloud_filter;
-	std::shared_ptr<ob::FrameSet> frame_set = nullptr;
-};
-
-class OrbbecCamera : public PhysicalCamera {
-public:
-	OrbbecCamera(bool bEnableInfrared, bool bEnablePointCloud);
-	virtual ~OrbbecCamera();
-
-	virtual bool connect();
-	virtual bool update();
-	virtual bool disconnect();
-	bool isConnected() const;
-	std::string toString() const;
-
-	std::size_t getInfraredWidth() const;
-	std::size_t getInfraredHeight() const;
-	std::size_t getCloudWidth() const;
-	std::size_t getCloudHeight() const;
-	std::size_t getColorWidth() const;
-	std::size_t getColorHeight() const;
-
-	const std::shared_ptr<IntensityImage<uint16_t>>& getInfraredImage() const;
-	const std::shared_ptr<DepthCloud>& getDepthCloud() const;
-
-protected:
-	std::unique_ptr<FemtoImp> camera;
-	std::shared_ptr<IntensityImage<uint16_t>> infrared_image;
-	std::shared_ptr<DepthCloud> depth_cloud;
-	bool bInfraredEnabled;
-	bool bPointCloudEnabled;
-	bool bConnected;
-	uint32_t timeout_ms;
-};
-
-}
+
+#pragma once
+
+#include <memory>
+#include <thread>
+#include <atomic>
+#include "PhysicalCamera.h"
+#include "IntensityImage.h"
+#include "DepthCloud.h"
+#include "TripleBuffer.h"
+#include "BoundedQueue.h"
+
+/* Orbbec */
+#include "libobsensor/ObSensor.hpp"
+
+namespace px {
+
+struct FemtoImp {
+	std::shared_ptr<ob::Pipeline> pipeline = nullptr;
+	ob::PointCloudFilter point_cloud_filter;
+	std::shared_ptr<ob::FrameSet> frame_set = nullptr;
+};
+
+/* The converted contents of one frameset: the depth cloud, the infrared
+ * image and the SDK point frame backing zero-copy views.
+ */
+struct FemtoFrame {
+	std::shared_ptr<DepthCloud> depth_cloud = nullptr;
+	std::shared_ptr<IntensityImage<uint16_t>> infrared_image = nullptr;
+	std::shared_ptr<ob::Frame> point_frame = nullptr;
+	std::size_t point_stamp = 0;
+};
+
+/* A frame produced by the asynchronous capture thread, queued together with
+ * its source frameset (used by the body tracker).
+ */
+struct FemtoCapture {
+	FemtoFrame frame;
+	std::shared_ptr<ob::FrameSet> frame_set = nullptr;
+};
+
+class OrbbecCamera : public PhysicalCamera {
+public:
+	OrbbecCamera(bool bEnableInfrared, bool bEnablePointCloud);
+	virtual ~OrbbecCamera();
+
+	virtual bool connect();
+	virtual bool update();
+	virtual bool disconnect();
+	bool isConnected() const;
+	std::string toString() const;
+
+	std::size_t getInfraredWidth() const;
+	std::size_t getInfraredHeight() const;
+	std::size_t getCloudWidth() const;
+	std::size_t getCloudHeight() const;
+	std::size_t getColorWidth() const;
+	std::size_t getColorHeight() const;
+
+	/* Depth sensor intrinsics and the matching ray table (valid once
+	 * connected). The ray table and the native Y16 depth image are attached
+	 * to every depth cloud, so SERIALIZE_DEPTH records the sensor depth
+	 * losslessly. The cloud x and y come from the SDK point cloud filter, not
+	 * from the pinhole rays: SERIALIZE_DEPTH recordings rebuild them from the
+	 * rays, record SERIALIZE_COMPRESSED or SERIALIZE_RAW to keep them.
+	 */
+	const CameraIntrinsics& getIntrinsics() const;
+	const std::shared_ptr<const RayTable>& getRayTable() const;
+
+	/* Frames are published through a lock-free triple buffer. update() (the
+	 * producer) always converts into a slot no consumer is reading.
+	 * getFrame() (the consumer) advances to the latest complete frame without
+	 * blocking and returns its cloud and infrared image, which come from the
+	 * same frameset. It is the only call that advances: getInfraredImage,
+	 * getDepthCloud and getDepthCloudView return parts of the frame last
+	 * returned by getFrame(). All of them return shared_ptr copies, and the
+	 * producer never writes into a frame that is still referenced. The
+	 * getters must be called from a single consumer thread.
+	 */
+	std::shared_ptr<IntensityImage<uint16_t>> getInfraredImage() const;
+	std::shared_ptr<DepthCloud> getDepthCloud() const;
+	FemtoFrame getFrame() const;
+
+	/* Zero-copy access to the latest point cloud. When zero-copy is enabled
+	 * update() no longer copies the SDK point buffer into the depth cloud,
+	 * the view references the SDK frame directly and keeps it alive. When
+	 * disabled the view references the depth cloud.
+	 */
+	bool setZeroCopy(bool bEnable);
+	bool isZeroCopy() const;
+	DepthCloudView getDepthCloudView() const;
+
+	/* Opt-in asynchronous capture. A worker thread owned by the camera waits
+	 * on the pipeline, converts each frameset to cloud and IR and pushes it
+	 * into a bounded queue (queue_capacity frames, full-queue behaviour set
+	 * by policy). update() then never blocks on the sensor: it takes the
+	 * next queued frame, if any, and publishes it to the getters.
+	 */
+	bool startCapture(std::size_t queue_capacity = 2, QueueDropPolicy policy = QUEUE_DROP_OLDEST);
+	bool stopCapture();
+	bool isCapturing() const;
+	std::size_t getCapturedFrames() const;
+	std::size_t getDroppedFrames() const;
+	std::size_t getQueueDepth() const;
+
+protected:
+	/* Converts the frameset into the back slot and publishes it. */
+	bool process(const std::shared_ptr<ob::FrameSet>& frame_set);
+	bool convert(const std::shared_ptr<ob::FrameSet>& frame_set, FemtoFrame& frame);
+	bool captureLoop();
+
+	std::unique_ptr<FemtoImp> camera;
+	mutable TripleBuffer<FemtoFrame> frames;
+	bool bInfraredEnabled;
+	bool bPointCloudEnabled;
+	bool bConnected;
+	bool bZeroCopy;
+	uint32_t timeout_ms;
+	CameraIntrinsics intrinsics;
+	std::shared_ptr<const RayTable> ray_table;
+
+	std::thread capture_thread;
+	std::atomic<bool> bCapturing;
+	std::atomic<std::size_t> captured_frames;
+	std::unique_ptr<BoundedQueue<FemtoCapture> > capture_queue;
+};
+
+}
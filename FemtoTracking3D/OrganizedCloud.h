@@ -1,121 +1,551 @@
-
-#ifndef PX_ORGANIZED_CLOUD_H
-#define PX_ORGANIZED_CLOUD_H
-
-#include <vector>
-#include <iomanip>
-#include "PointCloud.h"
-#include "DataFrame.h"
-#include "Mathematics.h"
-
-namespace px {
-
-template <class PointType>
-class OrganizedCloud;
-
-template <typename PointType>
-std::ostream& operator << (std::ostream& out, const OrganizedCloud<PointType>& cloud);
-
-template <class PointType>
-class OrganizedCloud : public DataFrame<PointType>, public PointCloud<PointType> {
-public:
-	OrganizedCloud();
-	OrganizedCloud(const OrganizedCloud<PointType>& cloud);
-	OrganizedCloud(std::size_t width, std::size_t height);
-	OrganizedCloud(const PointType* new_data, std::size_t width, std::size_t height);
-	virtual ~OrganizedCloud();
-
-	std::size_t size() const;
-	PointType* getData() const;
-	const PointType* constData() const;
-
-	friend std::ostream& operator << <> (std::ostream& out, const OrganizedCloud<PointType>& cloud);
-};
-
-template <class PointType>
-OrganizedCloud<PointType>::OrganizedCloud() : DataFrame<PointType>() {
-	this->data = nullptr;
-	this->w = 0;
-	this->h = 0;
-	this->timestamp();
-	this->name = "OrganizedCloud";
-}
-
-template <class PointType>
-OrganizedCloud<PointType>::OrganizedCloud(const OrganizedCloud<PointType>& cloud) {
-	if ( cloud.data != nullptr ) {
-		std::size_t n = cloud.w * cloud.h;
-		if ( this->w * this->h != n ) {
-			delete [] this->data;
-			this->data = new PointType[cloud.w * cloud.h];
-		}
-
-		this->w = cloud.w;
-		this->h = cloud.h;
-		this->stamp = cloud.stamp;
-		std::memcpy(this->data, cloud.data, this->w * this->h * sizeof(PointType));
-		this->name = cloud.name;
-	}
-	else {
-		this->w = 0;
-		this->h = 0;
-		this->stamp = 0;
-		this->data = nullptr;
-		this->name = "OrganizedCloud";
-	}
-}
-
-template <class PointType>
-OrganizedCloud<PointType>::OrganizedCloud(std::size_t width, std::size_t height) : DataFrame<PointType>() {
-	if ( width == 0 || height == 0 ) throw std::exception("[OrganizedCloud] Error: Invalid frame size.");
-	this->w = width;
-	this->h = height;
-	this->timestamp();
-	this->data = new PointType[this->w * this->h];
-	this->name = "OrganizedCloud";
-}
-
-template <class PointType>
-OrganizedCloud<PointType>::OrganizedCloud(const PointType* new_data, std::size_t width, std::size_t height) : DataFrame(new_data, width, height) {}
-
-template <class PointType>
-OrganizedCloud<PointType>::~OrganizedCloud() {}
-
-template <class PointType>
-std::size_t OrganizedCloud<PointType>::size() const {
-	return this->w * this->h;
-}
-
-template <class PointType>
-PointType* OrganizedCloud<PointType>::getData() const {
-	return this->data;
-}
-
-template <class PointType>
-const PointType* OrganizedCloud<PointType>::constData() const {
-	return this->data;
-}
-
-template <typename PointType>
-std::ostream& operator << (std::ostream& out, const OrganizedCloud<PointType>& cloud) {
-    if ( cloud.data == nullptr || cloud.w == 0 || cloud.h == 0 ) {
-        out << "[]";
-        return out;
-    }
-
-	out << "[" << std::endl;
-    for ( std::size_t i = 0; i < cloud.h; i++ ) {
-        for ( std::size_t j = 0; j < cloud.w; j++ ) {
-            out << std::setw(4);
-            out << cloud.data[i * cloud.w + j] << ' ';
-        }
-        out << std::endl;
-    }
-	out << "]" << std::endl;
-
-    return out;
-}
-
-}
-
-#endif
+
+#ifndef PX_ORGANIZED_CLOUD_H
+#define PX_ORGANIZED_CLOUD_H
+
+#include <vector>
+#include <iomanip>
+#include <limits>
+#include <type_traits>
+#include "PointCloud.h"
+#include "DataFrame.h"
+#include "Mathematics.h"
+
+namespace px {
+
+template <class PointType, class StoragePolicy = InterleavedStorage>
+class OrganizedCloud;
+
+template <typename PointType, class StoragePolicy>
+std::ostream& operator << (std::ostream& out, const OrganizedCloud<PointType, StoragePolicy>& cloud);
+
+template <class PointType, class StoragePolicy>
+class OrganizedCloud : public DataFrame<PointType, StoragePolicy>, public PointCloud<PointType> {
+	static_assert(std::is_same<StoragePolicy, InterleavedStorage>::value, "OrganizedCloud: unsupported storage policy for this point type.");
+
+public:
+	OrganizedCloud();
+	OrganizedCloud(const OrganizedCloud<PointType, StoragePolicy>& cloud);
+	OrganizedCloud(OrganizedCloud<PointType, StoragePolicy>&& cloud) noexcept;
+	OrganizedCloud(std::size_t width, std::size_t height);
+	OrganizedCloud(const PointType* new_data, std::size_t width, std::size_t height);
+	virtual ~OrganizedCloud();
+
+	std::size_t size() const;
+	PointType* getData() const;
+	const PointType* constData() const;
+
+	OrganizedCloud<PointType, StoragePolicy>& operator = (const OrganizedCloud<PointType, StoragePolicy>& cloud);
+	OrganizedCloud<PointType, StoragePolicy>& operator = (OrganizedCloud<PointType, StoragePolicy>&& cloud) noexcept;
+
+	friend std::ostream& operator << <> (std::ostream& out, const OrganizedCloud<PointType, StoragePolicy>& cloud);
+};
+
+template <class PointType, class StoragePolicy>
+OrganizedCloud<PointType, StoragePolicy>::OrganizedCloud() : DataFrame<PointType, StoragePolicy>() {
+	this->data = nullptr;
+	this->w = 0;
+	this->h = 0;
+	this->timestamp();
+	this->name = "OrganizedCloud";
+}
+
+template <class PointType, class StoragePolicy>
+OrganizedCloud<PointType, StoragePolicy>::OrganizedCloud(const OrganizedCloud<PointType, StoragePolicy>& cloud) : DataFrame<PointType, StoragePolicy>() {
+	if ( cloud.data != nullptr ) {
+		this->allocate(cloud.w, cloud.h);
+		this->stamp.store(cloud.stamp.load());
+		std::memcpy(this->data, cloud.data, this->w * this->h * sizeof(PointType));
+		this->name = cloud.name;
+	}
+	else {
+		this->stamp = 0;
+		this->name = "OrganizedCloud";
+	}
+}
+
+template <class PointType, class StoragePolicy>
+OrganizedCloud<PointType, StoragePolicy>::OrganizedCloud(OrganizedCloud<PointType, StoragePolicy>&& cloud) noexcept : DataFrame<PointType, StoragePolicy>(std::move(cloud)) {}
+
+template <class PointType, class StoragePolicy>
+OrganizedCloud<PointType, StoragePolicy>::OrganizedCloud(std::size_t width, std::size_t height) : DataFrame<PointType, StoragePolicy>() {
+	if ( width == 0 || height == 0 ) throw std::exception("[OrganizedCloud] Error: Invalid frame size.");
+	this->timestamp();
+	this->allocate(width, height);
+	this->name = "OrganizedCloud";
+}
+
+template <class PointType, class StoragePolicy>
+OrganizedCloud<PointType, StoragePolicy>::OrganizedCloud(const PointType* new_data, std::size_t width, std::size_t height) : DataFrame<PointType, StoragePolicy>(new_data, width, height) {}
+
+template <class PointType, class StoragePolicy>
+OrganizedCloud<PointType, StoragePolicy>::~OrganizedCloud() {}
+
+template <class PointType, class StoragePolicy>
+std::size_t OrganizedCloud<PointType, StoragePolicy>::size() const {
+	return this->w * this->h;
+}
+
+template <class PointType, class StoragePolicy>
+PointType* OrganizedCloud<PointType, StoragePolicy>::getData() const {
+	return this->data;
+}
+
+template <class PointType, class StoragePolicy>
+const PointType* OrganizedCloud<PointType, StoragePolicy>::constData() const {
+	return this->data;
+}
+
+template <class PointType, class StoragePolicy>
+OrganizedCloud<PointType, StoragePolicy>& OrganizedCloud<PointType, StoragePolicy>::operator = (const OrganizedCloud<PointType, StoragePolicy>& cloud) {
+	DataFrame<PointType, StoragePolicy>::operator = (cloud);
+	return *this;
+}
+
+template <class PointType, class StoragePolicy>
+OrganizedCloud<PointType, StoragePolicy>& OrganizedCloud<PointType, StoragePolicy>::operator = (OrganizedCloud<PointType, StoragePolicy>&& cloud) noexcept {
+	DataFrame<PointType, StoragePolicy>::operator = (std::move(cloud));
+	return *this;
+}
+
+template <typename PointType, class StoragePolicy>
+std::ostream& operator << (std::ostream& out, const OrganizedCloud<PointType, StoragePolicy>& cloud) {
+    if ( cloud.data == nullptr || cloud.w == 0 || cloud.h == 0 ) {
+        out << "[]";
+        return out;
+    }
+
+	out << "[" << std::endl;
+    for ( std::size_t i = 0; i < cloud.h; i++ ) {
+        for ( std::size_t j = 0; j < cloud.w; j++ ) {
+            out << std::setw(4);
+            out << cloud.data[i * cloud.w + j] << ' ';
+        }
+        out << std::endl;
+    }
+	out << "]" << std::endl;
+
+    return out;
+}
+
+/* Planar (structure-of-arrays) frame of PointXYZ. The x, y and z components
+ * are stored in three separate planes carved out of a single FramePool
+ * buffer. Each plane starts on a FRAME_ALIGNMENT boundary (the plane stride
+ * is padded to a multiple of the alignment and the padding is kept zero), so
+ * the accessors below return pointers suitable for aligned vector loads.
+ */
+template <typename Real>
+class DataFrame<PointXYZ<Real>, PlanarStorage> : public Object {
+public:
+	DataFrame();
+	DataFrame(const DataFrame<PointXYZ<Real>, PlanarStorage>& data_frame);
+	DataFrame(DataFrame<PointXYZ<Real>, PlanarStorage>&& data_frame) noexcept;
+	DataFrame(std::size_t width, std::size_t height);
+	virtual ~DataFrame();
+
+	bool resize(std::size_t width, std::size_t height);
+	bool zero();
+
+	bool serialize(BinaryFileWriter& out, SerializeType type = SERIALIZE_DEFAULT);
+	bool deserialize(BinaryFileReader& in, SerializeType type = SERIALIZE_DEFAULT);
+
+	/* Conversion to and from the interleaved layout. */
+	bool copy(const DataFrame<PointXYZ<Real>, InterleavedStorage>& data_frame);
+	bool copyTo(DataFrame<PointXYZ<Real>, InterleavedStorage>& data_frame) const;
+
+	bool get(std::size_t index, PointXYZ<Real>& out_point) const;
+	bool set(std::size_t index, const PointXYZ<Real>& in_point);
+
+	std::size_t width() const;
+	std::size_t height() const;
+	std::size_t size() const;
+
+	/* Distance (in elements) between the start of consecutive planes. */
+	std::size_t stride() const;
+
+	Real* xData();
+	Real* yData();
+	Real* zData();
+	const Real* constXData() const;
+	const Real* constYData() const;
+	const Real* constZData() const;
+	Real* getPlane(Axis axis);
+	const Real* constPlane(Axis axis) const;
+
+	DataFrame<PointXYZ<Real>, PlanarStorage>& operator = (const DataFrame<PointXYZ<Real>, PlanarStorage>& data_frame);
+	DataFrame<PointXYZ<Real>, PlanarStorage>& operator = (DataFrame<PointXYZ<Real>, PlanarStorage>&& data_frame) noexcept;
+
+protected:
+	bool allocate(std::size_t width, std::size_t height);
+	bool deallocate();
+
+	Real* buffer;
+	Real* planes[DIM3];
+	std::size_t w, h;
+	std::size_t plane_stride;
+};
+
+template <typename Real>
+DataFrame<PointXYZ<Real>, PlanarStorage>::DataFrame() : Object() {
+	this->buffer = nullptr;
+	this->planes[X] = this->planes[Y] = this->planes[Z] = nullptr;
+	this->w = 0;
+	this->h = 0;
+	this->plane_stride = 0;
+	this->name = "DataFrame";
+}
+
+template <typename Real>
+DataFrame<PointXYZ<Real>, PlanarStorage>::DataFrame(const DataFrame<PointXYZ<Real>, PlanarStorage>& data_frame) : DataFrame() {
+	*this = data_frame;
+}
+
+template <typename Real>
+DataFrame<PointXYZ<Real>, PlanarStorage>::DataFrame(DataFrame<PointXYZ<Real>, PlanarStorage>&& data_frame) noexcept : DataFrame() {
+	*this = std::move(data_frame);
+}
+
+template <typename Real>
+DataFrame<PointXYZ<Real>, PlanarStorage>::DataFrame(std::size_t width, std::size_t height) : DataFrame() {
+	if ( width == 0 || height == 0 ) throw std::exception("[DataFrame] Error: Invalid frame size.");
+	this->allocate(width, height);
+}
+
+template <typename Real>
+DataFrame<PointXYZ<Real>, PlanarStorage>::~DataFrame() {
+	this->deallocate();
+}
+
+template <typename Real>
+bool DataFrame<PointXYZ<Real>, PlanarStorage>::resize(std::size_t width, std::size_t height) {
+	if ( width == 0 || height == 0 ) {
+		std::cerr << "[DataFrame:resize] Error: Width or height = 0." << std::endl;
+		return false;
+	}
+
+	return this->allocate(width, height);
+}
+
+template <typename Real>
+bool DataFrame<PointXYZ<Real>, PlanarStorage>::zero() {
+	if ( this->buffer == nullptr ) return false;
+	std::memset(this->buffer, 0, this->plane_stride * DIM3 * sizeof(Real));
+	return true;
+}
+
+template <typename Real>
+bool DataFrame<PointXYZ<Real>, PlanarStorage>::serialize(BinaryFileWriter& out, SerializeType type) {
+	if ( out.isOpen() == false ) return false;
+	if ( this->buffer == nullptr ) return false;
+	out.writeUInt32(static_cast<uint32_t>(this->w));
+	out.writeUInt32(static_cast<uint32_t>(this->h));
+	out.writeUInt64(static_cast<uint64_t>(this->stamp));
+	for ( std::size_t c = 0; c < DIM3; c++ )
+		out.writeBuffer(this->planes[c], this->w * this->h);
+	return true;
+}
+
+template <typename Real>
+bool DataFrame<PointXYZ<Real>, PlanarStorage>::deserialize(BinaryFileReader& in, SerializeType type) {
+	if ( in.isOpen() == false ) return false;
+	uint32_t width = in.readUInt32();
+	uint32_t height = in.readUInt32();
+	uint64_t timestamp = in.readUInt64();
+
+	if ( this->allocate(width, height) == false ) return false;
+	this->setTimestamp(timestamp);
+	for ( std::size_t c = 0; c < DIM3; c++ )
+		in.readBuffer(this->planes[c], this->w * this->h);
+	return true;
+}
+
+template <typename Real>
+bool DataFrame<PointXYZ<Real>, PlanarStorage>::copy(const DataFrame<PointXYZ<Real>, InterleavedStorage>& data_frame) {
+	if ( data_frame.constData() == nullptr ) return false;
+	if ( this->allocate(data_frame.width(), data_frame.height()) == false ) return false;
+
+	const PointXYZ<Real>* points = data_frame.constData();
+	Real* x = this->planes[X];
+	Real* y = this->planes[Y];
+	Real* z = this->planes[Z];
+	std::size_t n = this->w * this->h;
+
+	for ( std::size_t i = 0; i < n; i++ ) {
+		x[i] = points[i].x;
+		y[i] = points[i].y;
+		z[i] = points[i].z;
+	}
+
+	this->stamp.store(data_frame.getTimestamp());
+	return true;
+}
+
+template <typename Real>
+bool DataFrame<PointXYZ<Real>, PlanarStorage>::copyTo(DataFrame<PointXYZ<Real>, InterleavedStorage>& data_frame) const {
+	if ( this->buffer == nullptr ) return false;
+	if ( data_frame.width() != this->w || data_frame.height() != this->h ) {
+		if ( data_frame.resize(this->w, this->h) == false ) return false;
+	}
+
+	PointXYZ<Real>* points = data_frame.getData();
+	const Real* x = this->planes[X];
+	const Real* y = this->planes[Y];
+	const Real* z = this->planes[Z];
+	std::size_t n = this->w * this->h;
+
+	for ( std::size_t i = 0; i < n; i++ ) {
+		points[i].x = x[i];
+		points[i].y = y[i];
+		points[i].z = z[i];
+	}
+
+	data_frame.setTimestamp(this->stamp);
+	return true;
+}
+
+template <typename Real>
+bool DataFrame<PointXYZ<Real>, PlanarStorage>::get(std::size_t index, PointXYZ<Real>& out_point) const {
+	if ( this->buffer == nullptr ) return false;
+	if ( index >= this->w * this->h ) {
+		std::cerr << "[DataFrame:get] Error: Invalid index: " << index << " for size: " << this->w*this->h << std::endl;
+		return false;
+	}
+
+	out_point.x = this->planes[X][index];
+	out_point.y = this->planes[Y][index];
+	out_point.z = this->planes[Z][index];
+	return true;
+}
+
+template <typename Real>
+bool DataFrame<PointXYZ<Real>, PlanarStorage>::set(std::size_t index, const PointXYZ<Real>& in_point) {
+	if ( this->buffer == nullptr ) return false;
+	if ( index >= this->w * this->h ) {
+		std::cerr << "[DataFrame:set] Error: Invalid index: " << index << " for size: " << this->w*this->h << std::endl;
+		return false;
+	}
+
+	this->planes[X][index] = in_point.x;
+	this->planes[Y][index] = in_point.y;
+	this->planes[Z][index] = in_point.z;
+	return true;
+}
+
+template <typename Real>
+std::size_t DataFrame<PointXYZ<Real>, PlanarStorage>::width() const {
+	return this->w;
+}
+
+template <typename Real>
+std::size_t DataFrame<PointXYZ<Real>, PlanarStorage>::height() const {
+	return this->h;
+}
+
+template <typename Real>
+std::size_t DataFrame<PointXYZ<Real>, PlanarStorage>::size() const {
+	return this->w * this->h;
+}
+
+template <typename Real>
+std::size_t DataFrame<PointXYZ<Real>, PlanarStorage>::stride() const {
+	return this->plane_stride;
+}
+
+template <typename Real>
+Real* DataFrame<PointXYZ<Real>, PlanarStorage>::xData() {
+	return this->planes[X];
+}
+
+template <typename Real>
+Real* DataFrame<PointXYZ<Real>, PlanarStorage>::yData() {
+	return this->planes[Y];
+}
+
+template <typename Real>
+Real* DataFrame<PointXYZ<Real>, PlanarStorage>::zData() {
+	return this->planes[Z];
+}
+
+template <typename Real>
+const Real* DataFrame<PointXYZ<Real>, PlanarStorage>::constXData() const {
+	return this->planes[X];
+}
+
+template <typename Real>
+const Real* DataFrame<PointXYZ<Real>, PlanarStorage>::constYData() const {
+	return this->planes[Y];
+}
+
+template <typename Real>
+const Real* DataFrame<PointXYZ<Real>, PlanarStorage>::constZData() const {
+	return this->planes[Z];
+}
+
+template <typename Real>
+Real* DataFrame<PointXYZ<Real>, PlanarStorage>::getPlane(Axis axis) {
+	if ( axis != X && axis != Y && axis != Z ) return nullptr;
+	return this->planes[axis];
+}
+
+template <typename Real>
+const Real* DataFrame<PointXYZ<Real>, PlanarStorage>::constPlane(Axis axis) const {
+	if ( axis != X && axis != Y && axis != Z ) return nullptr;
+	return this->planes[axis];
+}
+
+template <typename Real>
+DataFrame<PointXYZ<Real>, PlanarStorage>& DataFrame<PointXYZ<Real>, PlanarStorage>::operator = (const DataFrame<PointXYZ<Real>, PlanarStorage>& data_frame) {
+	if ( this == &data_frame ) return *this;
+	if ( data_frame.buffer == nullptr ) {
+		this->deallocate();
+		return *this;
+	}
+
+	this->allocate(data_frame.w, data_frame.h);
+	std::memcpy(this->buffer, data_frame.buffer, this->plane_stride * DIM3 * sizeof(Real));
+	this->stamp.store(data_frame.stamp.load());
+	this->name = data_frame.name;
+	return *this;
+}
+
+template <typename Real>
+DataFrame<PointXYZ<Real>, PlanarStorage>& DataFrame<PointXYZ<Real>, PlanarStorage>::operator = (DataFrame<PointXYZ<Real>, PlanarStorage>&& data_frame) noexcept {
+	if ( this == &data_frame ) return *this;
+	this->deallocate();
+
+	this->buffer = data_frame.buffer;
+	for ( std::size_t c = 0; c < DIM3; c++ ) this->planes[c] = data_frame.planes[c];
+	this->w = data_frame.w;
+	this->h = data_frame.h;
+	this->plane_stride = data_frame.plane_stride;
+	this->stamp.store(data_frame.stamp.load());
+	this->name = std::move(data_frame.name);
+
+	data_frame.buffer = nullptr;
+	data_frame.planes[X] = data_frame.planes[Y] = data_frame.planes[Z] = nullptr;
+	data_frame.w = 0;
+	data_frame.h = 0;
+	data_frame.plane_stride = 0;
+	return *this;
+}
+
+template <typename Real>
+bool DataFrame<PointXYZ<Real>, PlanarStorage>::allocate(std::size_t width, std::size_t height) {
+	const std::size_t lanes = FRAME_ALIGNMENT / sizeof(Real);
+	std::size_t n = width * height;
+	std::size_t stride = ((n + lanes - 1) / lanes) * lanes;
+
+	if ( this->buffer == nullptr || stride != this->plane_stride ) {
+		this->deallocate();
+		if ( n == 0 ) return false;
+
+		this->buffer = FramePool<Real>::Instance().acquire(stride * DIM3);
+		this->plane_stride = stride;
+		this->planes[X] = this->buffer;
+		this->planes[Y] = this->buffer + stride;
+		this->planes[Z] = this->buffer + stride * 2;
+	}
+
+	this->w = width;
+	this->h = height;
+
+	// Keep the padding deterministic for whole-buffer passes: a reused buffer
+	// may hold a larger frame's values past the new element count.
+	for ( std::size_t c = 0; c < DIM3; c++ )
+		std::memset(this->planes[c] + n, 0, (stride - n) * sizeof(Real));
+	return true;
+}
+
+template <typename Real>
+bool DataFrame<PointXYZ<Real>, PlanarStorage>::deallocate() {
+	if ( this->buffer == nullptr ) return false;
+	FramePool<Real>::Instance().release(this->buffer, this->plane_stride * DIM3);
+	this->buffer = nullptr;
+	this->planes[X] = this->planes[Y] = this->planes[Z] = nullptr;
+	this->w = 0;
+	this->h = 0;
+	this->plane_stride = 0;
+	return true;
+}
+
+/* Planar organized cloud of PointXYZ: the planar frame with the cloud passes
+ * that work on whole planes.
+ */
+template <typename Real>
+class OrganizedCloud<PointXYZ<Real>, PlanarStorage> : public DataFrame<PointXYZ<Real>, PlanarStorage> {
+public:
+	OrganizedCloud();
+	OrganizedCloud(const OrganizedCloud<PointXYZ<Real>, PlanarStorage>& cloud);
+	OrganizedCloud(OrganizedCloud<PointXYZ<Real>, PlanarStorage>&& cloud) noexcept;
+	OrganizedCloud(std::size_t width, std::size_t height);
+	virtual ~OrganizedCloud();
+
+	bool scale(Real uniform_scale);
+	bool getDepthBounds(Real& min, Real& max) const;
+
+	OrganizedCloud<PointXYZ<Real>, PlanarStorage>& operator = (const OrganizedCloud<PointXYZ<Real>, PlanarStorage>& cloud);
+	OrganizedCloud<PointXYZ<Real>, PlanarStorage>& operator = (OrganizedCloud<PointXYZ<Real>, PlanarStorage>&& cloud) noexcept;
+};
+
+template <typename Real>
+OrganizedCloud<PointXYZ<Real>, PlanarStorage>::OrganizedCloud() : DataFrame<PointXYZ<Real>, PlanarStorage>() {
+	this->name = "OrganizedCloud";
+}
+
+template <typename Real>
+OrganizedCloud<PointXYZ<Real>, PlanarStorage>::OrganizedCloud(const OrganizedCloud<PointXYZ<Real>, PlanarStorage>& cloud) : DataFrame<PointXYZ<Real>, PlanarStorage>(cloud) {}
+
+template <typename Real>
+OrganizedCloud<PointXYZ<Real>, PlanarStorage>::OrganizedCloud(OrganizedCloud<PointXYZ<Real>, PlanarStorage>&& cloud) noexcept : DataFrame<PointXYZ<Real>, PlanarStorage>(std::move(cloud)) {}
+
+template <typename Real>
+OrganizedCloud<PointXYZ<Real>, PlanarStorage>::OrganizedCloud(std::size_t width, std::size_t height) : DataFrame<PointXYZ<Real>, PlanarStorage>(width, height) {
+	this->name = "OrganizedCloud";
+}
+
+template <typename Real>
+OrganizedCloud<PointXYZ<Real>, PlanarStorage>::~OrganizedCloud() {}
+
+template <typename Real>
+bool OrganizedCloud<PointXYZ<Real>, PlanarStorage>::scale(Real uniform_scale) {
+	if ( this->buffer == nullptr ) return false;
+	// The planes are contiguous, scaling them is a single unit-stride pass.
+	Real* values = this->buffer;
+	std::size_t n = this->plane_stride * DIM3;
+	for ( std::size_t i = 0; i < n; i++ )
+		values[i] *= uniform_scale;
+	return true;
+}
+
+template <typename Real>
+bool OrganizedCloud<PointXYZ<Real>, PlanarStorage>::getDepthBounds(Real& min, Real& max) const {
+	if ( this->buffer == nullptr ) return false;
+	const Real* z = this->planes[Z];
+	std::size_t n = this->w * this->h;
+
+	Real curMin = std::numeric_limits<Real>::max();
+	Real curMax = std::numeric_limits<Real>::lowest();
+	for ( std::size_t i = 0; i < n; i++ ) {
+		curMin = z[i] < curMin ? z[i] : curMin;
+		curMax = z[i] > curMax ? z[i] : curMax;
+	}
+
+	min = curMin;
+	max = curMax;
+	return true;
+}
+
+template <typename Real>
+OrganizedCloud<PointXYZ<Real>, PlanarStorage>& OrganizedCloud<PointXYZ<Real>, PlanarStorage>::operator = (const OrganizedCloud<PointXYZ<Real>, PlanarStorage>& cloud) {
+	DataFrame<PointXYZ<Real>, PlanarStorage>::operator = (cloud);
+	return *this;
+}
+
+template <typename Real>
+OrganizedCloud<PointXYZ<Real>, PlanarStorage>& OrganizedCloud<PointXYZ<Real>, PlanarStorage>::operator = (OrganizedCloud<PointXYZ<Real>, PlanarStorage>&& cloud) noexcept {
+	DataFrame<PointXYZ<Real>, PlanarStorage>::operator = (std::move(cloud));
+	return *this;
+}
+
+}
+
+#endif
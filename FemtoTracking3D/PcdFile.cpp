@@ -0,0 +1,500 @@
+#include "PcdFile.h"
+#include "MappedFile.h"
+#include "BufferedFileWriter.h"
+#include "Lzf.h"
+#include <charconv>
+#include <sstream>
+#include <thread>
+#include <functional>
+#include <algorithm>
+#include <limits>
+
+namespace px {
+
+/* ASCII blocks smaller than this are not worth a thread. */
+const static std::size_t PCD_MIN_BLOCK_SIZE = 1 << 18;
+
+/* Longest std::to_chars output of a value (shortest round-trip form). */
+const static std::size_t PCD_MAX_VALUE_CHARS = 32;
+
+PcdHeader::PcdHeader() {
+	this->version = "0.7";
+	this->width = 0;
+	this->height = 0;
+	const float identity[7] = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f };
+	std::copy(identity, identity + 7, this->viewpoint);
+	this->points = 0;
+	this->data_type = PCD_ASCII;
+	this->data_offset = 0;
+}
+
+static bool IsValidPcdType(char type, uint32_t size) {
+	if ( type == 'F' ) return size == 4 || size == 8;
+	if ( type == 'I' || type == 'U' ) return size == 1 || size == 2 || size == 4 || size == 8;
+	return false;
+}
+
+bool PcdHeader::parse(const char* text, std::size_t length) {
+	std::vector<uint32_t> sizes, counts;
+	std::vector<char> types;
+	std::size_t position = 0;
+	bool bData = false;
+	bool bPoints = false;
+
+	while ( position < length && bData == false ) {
+		const char* line = text + position;
+		const char* newline = static_cast<const char*>(std::memchr(line, '\n', length - position));
+		std::size_t line_length = (newline != nullptr) ? std::size_t(newline - line) : length - position;
+		position += line_length + 1;
+
+		std::istringstream stream(std::string(line, line_length));
+		std::string key;
+		if ( !(stream >> key) || key[0] == '#' ) continue;
+
+		if ( key == "VERSION" ) stream >> this->version;
+		else if ( key == "FIELDS" ) {
+			this->fields.clear();
+			PcdField field = PcdField();
+			while ( stream >> field.name ) this->fields.push_back(field);
+		}
+		else if ( key == "SIZE" ) { uint32_t value; while ( stream >> value ) sizes.push_back(value); }
+		else if ( key == "TYPE" ) { char value; while ( stream >> value ) types.push_back(value); }
+		else if ( key == "COUNT" ) { uint32_t value; while ( stream >> value ) counts.push_back(value); }
+		else if ( key == "WIDTH" ) stream >> this->width;
+		else if ( key == "HEIGHT" ) stream >> this->height;
+		else if ( key == "VIEWPOINT" ) { for ( std::size_t i = 0; i < 7; i++ ) stream >> this->viewpoint[i]; }
+		else if ( key == "POINTS" ) { stream >> this->points; bPoints = true; }
+		else if ( key == "DATA" ) {
+			std::string data;
+			stream >> data;
+			if ( data == "ascii" ) this->data_type = PCD_ASCII;
+			else if ( data == "binary" ) this->data_type = PCD_BINARY;
+			else if ( data == "binary_compressed" ) this->data_type = PCD_BINARY_COMPRESSED;
+			else {
+				std::cerr << "[PcdHeader:parse] Error: Unknown DATA type: " << data << std::endl;
+				return false;
+			}
+			bData = true;
+		}
+		else {
+			std::cerr << "[PcdHeader:parse] Error: Unknown header entry: " << key << std::endl;
+			return false;
+		}
+
+		if ( stream.bad() ) return false;
+	}
+
+	if ( bData == false ) {
+		std::cerr << "[PcdHeader:parse] Error: Missing DATA entry." << std::endl;
+		return false;
+	}
+
+	// COUNT is optional (v0.6 files), everything else must describe every field.
+	if ( counts.size() == 0 ) counts.assign(this->fields.size(), 1);
+	if ( this->fields.size() == 0 || sizes.size() != this->fields.size() || types.size() != this->fields.size() || counts.size() != this->fields.size() ) {
+		std::cerr << "[PcdHeader:parse] Error: FIELDS, SIZE, TYPE and COUNT do not match." << std::endl;
+		return false;
+	}
+
+	std::size_t offset = 0;
+	std::size_t column = 0;
+	for ( std::size_t i = 0; i < this->fields.size(); i++ ) {
+		PcdField& field = this->fields[i];
+		field.size = sizes[i];
+		field.type = types[i];
+		field.count = counts[i];
+		field.offset = offset;
+		field.column = column;
+
+		if ( IsValidPcdType(field.type, field.size) == false || field.count == 0 ) {
+			std::cerr << "[PcdHeader:parse] Error: Invalid type of field: " << field.name << std::endl;
+			return false;
+		}
+
+		offset += std::size_t(field.size) * field.count;
+		column += field.count;
+	}
+
+	if ( bPoints == false ) this->points = uint64_t(this->width) * uint64_t(this->height);
+	this->data_offset = std::min(position, length);
+	return true;
+}
+
+int PcdHeader::findField(const std::string& name) const {
+	for ( std::size_t i = 0; i < this->fields.size(); i++ )
+		if ( this->fields[i].name == name ) return static_cast<int>(i);
+	return -1;
+}
+
+std::size_t PcdHeader::recordSize() const {
+	if ( this->fields.size() == 0 ) return 0;
+	const PcdField& last = this->fields.back();
+	return last.offset + std::size_t(last.size) * last.count;
+}
+
+std::string PcdDataTypeToString(PcdDataType data_type) {
+	switch ( data_type ) {
+		case PCD_ASCII: return "ascii";
+		case PCD_BINARY: return "binary";
+		case PCD_BINARY_COMPRESSED: return "binary_compressed";
+		default: return "unknown";
+	}
+}
+
+template <typename T>
+static Real LoadValue(const uint8_t* data) {
+	T value;
+	std::memcpy(&value, data, sizeof(T));
+	return static_cast<Real>(value);
+}
+
+static Real LoadPcdValue(const uint8_t* data, char type, uint32_t size) {
+	if ( type == 'F' ) return (size == 4) ? LoadValue<float>(data) : LoadValue<double>(data);
+
+	if ( type == 'I' ) {
+		switch ( size ) {
+			case 1: return LoadValue<int8_t>(data);
+			case 2: return LoadValue<int16_t>(data);
+			case 4: return LoadValue<int32_t>(data);
+			default: return LoadValue<int64_t>(data);
+		}
+	}
+
+	switch ( size ) {
+		case 1: return LoadValue<uint8_t>(data);
+		case 2: return LoadValue<uint16_t>(data);
+		case 4: return LoadValue<uint32_t>(data);
+		default: return LoadValue<uint64_t>(data);
+	}
+}
+
+/* Value i of axis c is at data + bases[c] + i * strides[c] (interleaved
+ * records for binary data, field planes for binary_compressed data).
+ */
+static void ExtractPcdPoints(const uint8_t* data, std::size_t n, const PcdField* const fields[DIM3], const std::size_t bases[DIM3], const std::size_t strides[DIM3], PointXYZ<Real>* points) {
+	for ( std::size_t c = 0; c < DIM3; c++ ) {
+		const uint8_t* values = data + bases[c];
+		std::size_t stride = strides[c];
+		char type = fields[c]->type;
+		uint32_t size = fields[c]->size;
+		Real* out = &points[0].x + c;
+
+		if ( type == 'F' && size == sizeof(Real) ) {
+			for ( std::size_t i = 0; i < n; i++ )
+				std::memcpy(out + i * DIM3, values + i * stride, sizeof(Real));
+		}
+		else {
+			for ( std::size_t i = 0; i < n; i++ )
+				out[i * DIM3] = LoadPcdValue(values + i * stride, type, size);
+		}
+	}
+}
+
+static bool IsPcdSpace(char c) {
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+/* Parses the lines in [begin, end) into points. Blank lines are skipped;
+ * on a malformed line error is set to its position and false returned.
+ */
+static bool ParsePcdAscii(const char* begin, const char* end, const std::size_t columns[DIM3], std::vector<PointXYZ<Real> >& points, const char*& error) {
+	std::size_t last_column = std::max(columns[X], std::max(columns[Y], columns[Z]));
+	const char* line = begin;
+
+	while ( line < end ) {
+		const char* line_end = static_cast<const char*>(std::memchr(line, '\n', end - line));
+		if ( line_end == nullptr ) line_end = end;
+
+		PointXYZ<Real> point;
+		Real* values = &point.x;
+		const char* p = line;
+		std::size_t column = 0;
+
+		for ( ; column <= last_column; column++ ) {
+			while ( p < line_end && IsPcdSpace(*p) ) p++;
+			if ( p == line_end ) break;
+
+			std::size_t axis = DIM3;
+			for ( std::size_t c = 0; c < DIM3; c++ )
+				if ( columns[c] == column ) axis = c;
+
+			if ( axis == DIM3 ) {
+				while ( p < line_end && IsPcdSpace(*p) == false ) p++;
+				continue;
+			}
+
+			std::from_chars_result result = std::from_chars(p, line_end, values[axis]);
+			if ( result.ec != std::errc() || (result.ptr != line_end && IsPcdSpace(*result.ptr) == false) ) {
+				error = p;
+				return false;
+			}
+			p = result.ptr;
+		}
+
+		if ( column > last_column ) points.push_back(point);
+		else if ( column != 0 ) {
+			error = line;
+			return false;
+		}
+
+		line = line_end + 1;
+	}
+
+	return true;
+}
+
+static std::size_t PcdThreadCount(std::size_t thread_count, std::size_t bytes) {
+	if ( thread_count == 0 ) thread_count = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+	return std::max<std::size_t>(std::min(thread_count, bytes / PCD_MIN_BLOCK_SIZE), 1);
+}
+
+static bool LoadPcdAscii(const char* begin, const char* end, const std::size_t columns[DIM3], std::size_t thread_count, std::vector<std::vector<PointXYZ<Real> > >& blocks, const char*& error) {
+	std::size_t bytes = end - begin;
+	std::size_t count = PcdThreadCount(thread_count, bytes);
+
+	// Block boundaries are moved forward to the next line start.
+	std::vector<const char*> bounds(count + 1, end);
+	bounds[0] = begin;
+	for ( std::size_t k = 1; k < count; k++ ) {
+		const char* split = std::max(begin + bytes * k / count, bounds[k - 1]);
+		const char* newline = static_cast<const char*>(std::memchr(split, '\n', end - split));
+		bounds[k] = (newline != nullptr) ? newline + 1 : end;
+	}
+
+	blocks.assign(count, std::vector<PointXYZ<Real> >());
+	std::vector<const char*> errors(count, nullptr);
+	std::vector<char> results(count, 1);
+
+	auto parse = [&](std::size_t k) {
+		blocks[k].reserve((bounds[k + 1] - bounds[k]) / 16);
+		results[k] = ParsePcdAscii(bounds[k], bounds[k + 1], columns, blocks[k], errors[k]) ? 1 : 0;
+	};
+
+	std::vector<std::thread> threads;
+	for ( std::size_t k = 1; k < count; k++ ) threads.emplace_back(parse, k);
+	parse(0);
+	for ( std::size_t k = 0; k < threads.size(); k++ ) threads[k].join();
+
+	for ( std::size_t k = 0; k < count; k++ ) {
+		if ( results[k] == 0 ) {
+			error = errors[k];
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool ReadPcdHeader(const std::string& filename, PcdHeader& header) {
+	MappedFile file;
+	if ( file.open(filename) == false ) return false;
+	return header.parse(reinterpret_cast<const char*>(file.data()), file.size());
+}
+
+bool LoadPcd(const std::string& filename, OrganizedCloud<PointXYZ<Real> >& cloud, std::size_t thread_count) {
+	MappedFile file;
+	if ( file.open(filename) == false ) {
+		std::cerr << "[LoadPcd] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	const char* text = reinterpret_cast<const char*>(file.data());
+	PcdHeader header;
+	if ( header.parse(text, file.size()) == false ) {
+		std::cerr << "[LoadPcd] Error: Invalid header in: " << filename << std::endl;
+		return false;
+	}
+
+	const PcdField* fields[DIM3] = { nullptr, nullptr, nullptr };
+	const char* names[DIM3] = { "x", "y", "z" };
+	for ( std::size_t c = 0; c < DIM3; c++ ) {
+		int index = header.findField(names[c]);
+		if ( index < 0 ) {
+			std::cerr << "[LoadPcd] Error: Missing field " << names[c] << " in: " << filename << std::endl;
+			return false;
+		}
+		fields[c] = &header.fields[index];
+	}
+
+	std::size_t n = static_cast<std::size_t>(header.points);
+	if ( n == 0 ) {
+		std::cerr << "[LoadPcd] Error: No points in: " << filename << std::endl;
+		return false;
+	}
+
+	std::size_t width = header.width;
+	std::size_t height = header.height;
+	if ( width * height != n ) {
+		width = n;
+		height = 1;
+	}
+
+	const uint8_t* data = file.data() + header.data_offset;
+	std::size_t data_size = file.size() - header.data_offset;
+	std::size_t record_size = header.recordSize();
+
+	if ( header.data_type == PCD_ASCII ) {
+		std::size_t columns[DIM3] = { fields[X]->column, fields[Y]->column, fields[Z]->column };
+		std::vector<std::vector<PointXYZ<Real> > > blocks;
+		const char* error = nullptr;
+
+		if ( LoadPcdAscii(text + header.data_offset, text + file.size(), columns, thread_count, blocks, error) == false ) {
+			std::cerr << "[LoadPcd] Error: Malformed data at byte " << (error - text) << " of: " << filename << std::endl;
+			return false;
+		}
+
+		std::size_t found = 0;
+		for ( std::size_t k = 0; k < blocks.size(); k++ ) found += blocks[k].size();
+		if ( found != n ) {
+			std::cerr << "[LoadPcd] Error: Expected " << n << " points, found " << found << " in: " << filename << std::endl;
+			return false;
+		}
+
+		if ( cloud.resize(width, height) == false ) return false;
+		PointXYZ<Real>* points = cloud.getData();
+		for ( std::size_t k = 0; k < blocks.size(); k++ ) {
+			std::copy(blocks[k].begin(), blocks[k].end(), points);
+			points += blocks[k].size();
+		}
+		return true;
+	}
+
+	if ( header.data_type == PCD_BINARY ) {
+		if ( data_size / record_size < n ) {
+			std::cerr << "[LoadPcd] Error: Binary data is truncated in: " << filename << std::endl;
+			return false;
+		}
+
+		std::size_t bases[DIM3] = { fields[X]->offset, fields[Y]->offset, fields[Z]->offset };
+		std::size_t strides[DIM3] = { record_size, record_size, record_size };
+		if ( cloud.resize(width, height) == false ) return false;
+		ExtractPcdPoints(data, n, fields, bases, strides, cloud.getData());
+		return true;
+	}
+
+	// binary_compressed: compressed and uncompressed size, then the LZF data of the field planes.
+	uint32_t sizes[2] = { 0, 0 };
+	if ( data_size < sizeof(sizes) ) {
+		std::cerr << "[LoadPcd] Error: Compressed data is truncated in: " << filename << std::endl;
+		return false;
+	}
+
+	std::memcpy(sizes, data, sizeof(sizes));
+	if ( sizes[0] > data_size - sizeof(sizes) || sizes[1] / record_size < n ) {
+		std::cerr << "[LoadPcd] Error: Compressed data is truncated in: " << filename << std::endl;
+		return false;
+	}
+
+	std::vector<uint8_t> planes(sizes[1]);
+	if ( LzfDecompress(data + sizeof(sizes), sizes[0], planes.data(), planes.size()) != planes.size() ) {
+		std::cerr << "[LoadPcd] Error: Compressed data is damaged in: " << filename << std::endl;
+		return false;
+	}
+
+	std::size_t bases[DIM3], strides[DIM3];
+	for ( std::size_t c = 0; c < DIM3; c++ ) {
+		bases[c] = fields[c]->offset * n;
+		strides[c] = std::size_t(fields[c]->size) * fields[c]->count;
+	}
+
+	if ( cloud.resize(width, height) == false ) return false;
+	ExtractPcdPoints(planes.data(), n, fields, bases, strides, cloud.getData());
+	return true;
+}
+
+/* Formats points [begin, end) as "x y z" lines. */
+static void FormatPcdAscii(const PointXYZ<Real>* points, std::size_t begin, std::size_t end, std::vector<char>& text) {
+	text.resize((end - begin) * DIM3 * PCD_MAX_VALUE_CHARS);
+	char* p = text.data();
+	char* last = text.data() + text.size();
+
+	for ( std::size_t i = begin; i < end; i++ ) {
+		const Real* values = &points[i].x;
+		for ( std::size_t c = 0; c < DIM3; c++ ) {
+			p = std::to_chars(p, last, values[c]).ptr;
+			*p++ = (c + 1 < DIM3) ? ' ' : '\n';
+		}
+	}
+
+	text.resize(p - text.data());
+}
+
+bool SavePcd(const std::string& filename, const OrganizedCloud<PointXYZ<Real> >& cloud, PcdDataType data_type, std::size_t thread_count) {
+	const PointXYZ<Real>* points = cloud.constData();
+	std::size_t n = cloud.size();
+	if ( points == nullptr || n == 0 ) return false;
+
+	BufferedFileWriter out;
+	if ( out.open(filename) == false ) {
+		std::cerr << "[SavePcd] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	std::stringstream header;
+	header << "# .PCD v0.7 - Point Cloud Data file format" << '\n';
+	header << "VERSION 0.7" << '\n';
+	header << "FIELDS x y z" << '\n';
+	header << "SIZE " << sizeof(Real) << ' ' << sizeof(Real) << ' ' << sizeof(Real) << '\n';
+	header << "TYPE F F F" << '\n';
+	header << "COUNT 1 1 1" << '\n';
+	header << "WIDTH " << cloud.width() << '\n';
+	header << "HEIGHT " << cloud.height() << '\n';
+	header << "VIEWPOINT 0 0 0 1 0 0 0" << '\n';
+	header << "POINTS " << n << '\n';
+	header << "DATA " << PcdDataTypeToString(data_type) << '\n';
+	std::string text = header.str();
+	out.writeBytes(text.data(), text.size());
+
+	if ( data_type == PCD_ASCII ) {
+		std::size_t count = PcdThreadCount(thread_count, n * DIM3 * PCD_MAX_VALUE_CHARS);
+		std::vector<std::vector<char> > blocks(count);
+		std::vector<std::thread> threads;
+
+		for ( std::size_t k = 1; k < count; k++ )
+			threads.emplace_back(FormatPcdAscii, points, n * k / count, n * (k + 1) / count, std::ref(blocks[k]));
+		FormatPcdAscii(points, 0, n / count, blocks[0]);
+		for ( std::size_t k = 0; k < threads.size(); k++ ) threads[k].join();
+
+		for ( std::size_t k = 0; k < count; k++ )
+			out.writeBytes(blocks[k].data(), blocks[k].size());
+	}
+	else if ( data_type == PCD_BINARY ) {
+		if ( sizeof(PointXYZ<Real>) == DIM3 * sizeof(Real) ) out.writeBytes(points, n * sizeof(PointXYZ<Real>));
+		else {
+			for ( std::size_t i = 0; i < n; i++ )
+				out.writeBytes(&points[i].x, DIM3 * sizeof(Real));
+		}
+	}
+	else {
+		// Planes of x, y and z values, LZF compressed as a whole.
+		std::vector<Real> planes(n * DIM3);
+		for ( std::size_t i = 0; i < n; i++ ) {
+			planes[i] = points[i].x;
+			planes[n + i] = points[i].y;
+			planes[2 * n + i] = points[i].z;
+		}
+
+		std::size_t plane_bytes = planes.size() * sizeof(Real);
+		std::vector<uint8_t> compressed(LzfCompressBound(plane_bytes));
+		std::size_t length = LzfCompress(reinterpret_cast<const uint8_t*>(planes.data()), plane_bytes, compressed.data(), compressed.size());
+		if ( length == 0 || plane_bytes > std::numeric_limits<uint32_t>::max() ) {
+			std::cerr << "[SavePcd] Error: Could not compress: " << filename << std::endl;
+			out.close();
+			return false;
+		}
+
+		uint32_t sizes[2] = { static_cast<uint32_t>(length), static_cast<uint32_t>(plane_bytes) };
+		out.writeBytes(sizes, sizeof(sizes));
+		out.writeBytes(compressed.data(), length);
+	}
+
+	out.close();
+	if ( out.getStatus() != FILE_OK ) {
+		std::cerr << "[SavePcd] Error: " << FileStatusToString(out.getStatus()) << " in: " << filename << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+}
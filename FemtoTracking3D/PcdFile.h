@@ -0,0 +1,66 @@
+#ifndef PX_PCD_FILE_H
+#define PX_PCD_FILE_H
+
+#include <string>
+#include <vector>
+#include "OrganizedCloud.h"
+
+namespace px {
+
+/* DATA section encodings of PCD v0.7 files. */
+enum PcdDataType {
+	PCD_ASCII,
+	PCD_BINARY,
+	PCD_BINARY_COMPRESSED
+};
+
+/* One FIELDS entry; the offset is the byte offset in a binary record, the
+ * column the index of the first value in an ASCII line.
+ */
+struct PcdField {
+	std::string name;
+	uint32_t size;
+	char type;
+	uint32_t count;
+	std::size_t offset;
+	std::size_t column;
+};
+
+struct PcdHeader {
+	std::string version;
+	std::vector<PcdField> fields;
+	uint32_t width;
+	uint32_t height;
+	float viewpoint[7];
+	uint64_t points;
+	PcdDataType data_type;
+	std::size_t data_offset;
+
+	PcdHeader();
+
+	/* Parses the header lines up to and including DATA; data_offset is the
+	 * position of the first byte after them.
+	 */
+	bool parse(const char* text, std::size_t length);
+	int findField(const std::string& name) const;
+	std::size_t recordSize() const;
+};
+
+/* Point Cloud Library PCD files, x/y/z fields only (other fields are
+ * skipped on load; fields may have any numeric type). Organized files
+ * (HEIGHT > 1) keep their dimensions, unorganized ones load as POINTS x 1.
+ *
+ * The file is memory mapped. ASCII data is split into line blocks that are
+ * parsed with std::from_chars on up to thread_count threads (0 = one per
+ * core); saving formats ASCII blocks in parallel with std::to_chars. Binary
+ * data is copied record by record, binary_compressed data is LZF.
+ */
+bool LoadPcd(const std::string& filename, OrganizedCloud<PointXYZ<Real> >& cloud, std::size_t thread_count = 0);
+bool SavePcd(const std::string& filename, const OrganizedCloud<PointXYZ<Real> >& cloud, PcdDataType data_type = PCD_BINARY, std::size_t thread_count = 0);
+bool ReadPcdHeader(const std::string& filename, PcdHeader& header);
+
+std::string PcdDataTypeToString(PcdDataType data_type);
+
+}
+
+#endif
@@ -0,0 +1,568 @@
+#include "PlyFile.h"
+#include <sstream>
+#include <cstdio>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+namespace px {
+
+/* Element counts are written as fixed-width decimals so close() can patch
+ * them in place.
+ */
+const static std::size_t PLY_COUNT_DIGITS = 10;
+
+/* Colored vertices are converted in batches of this many records. */
+const static std::size_t PLY_COLOR_BATCH = 4096;
+
+const static char* PLY_PROPERTY_NAMES[3][6] = {
+	{ "x", "y", "z", nullptr, nullptr, nullptr },
+	{ "x", "y", "z", "nx", "ny", "nz" },
+	{ "x", "y", "z", "red", "green", "blue" }
+};
+
+std::size_t PlyPropertyCount(PlyVertexFormat format) {
+	return (format == PLY_VERTEX_XYZ) ? 3 : 6;
+}
+
+/* Quantizes a [0, 1] color component to 0-255 (rounded, clamped, NaN is 0). */
+inline uint8_t PlyColorByte(Real value) {
+	Real scaled = std::round(value * Real(255));
+	if ( (scaled > Real(0)) == false ) return 0;
+	if ( scaled > Real(255) ) return 255;
+	return static_cast<uint8_t>(scaled);
+}
+
+PlyWriter::PlyWriter() {
+	this->format = PLY_VERTEX_XYZ;
+	this->grid_width = 0;
+	this->grid_height = 0;
+	this->vertex_count = 0;
+	this->face_count = 0;
+	this->vertex_count_offset = 0;
+	this->face_count_offset = 0;
+	this->bFaces = false;
+	this->bHeaderWritten = false;
+}
+
+PlyWriter::~PlyWriter() {
+	if ( this->out.isOpen() ) this->close();
+}
+
+bool PlyWriter::open(const std::string& filename, PlyVertexFormat format, bool bFaces) {
+	if ( this->out.isOpen() ) this->close();
+
+	if ( this->out.open(filename) == false ) {
+		std::cerr << "[PlyWriter:open] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	this->filename = filename;
+	this->format = format;
+	this->bFaces = bFaces;
+	this->grid_width = 0;
+	this->grid_height = 0;
+	this->vertex_count = 0;
+	this->face_count = 0;
+	this->bHeaderWritten = false;
+	return true;
+}
+
+bool PlyWriter::setGrid(std::size_t width, std::size_t height) {
+	if ( this->bHeaderWritten ) {
+		std::cerr << "[PlyWriter:setGrid] Error: The header was already written." << std::endl;
+		return false;
+	}
+
+	this->grid_width = width;
+	this->grid_height = height;
+	return true;
+}
+
+bool PlyWriter::writeHeader() {
+	std::stringstream header;
+	header << "ply\n";
+	header << "format binary_little_endian 1.0\n";
+	if ( this->grid_width != 0 && this->grid_height != 0 ) header << "obj_info grid " << this->grid_width << ' ' << this->grid_height << '\n';
+
+	header << "element vertex ";
+	this->vertex_count_offset = static_cast<uint64_t>(header.tellp());
+	header << std::string(PLY_COUNT_DIGITS, '0') << '\n';
+
+	for ( std::size_t i = 0; i < PlyPropertyCount(this->format); i++ ) {
+		bool bColor = this->format == PLY_VERTEX_XYZRGB && i >= 3;
+		header << "property " << (bColor ? "uchar " : (sizeof(Real) == 4 ? "float " : "double ")) << PLY_PROPERTY_NAMES[this->format][i] << '\n';
+	}
+
+	if ( this->bFaces ) {
+		header << "element face ";
+		this->face_count_offset = static_cast<uint64_t>(header.tellp());
+		header << std::string(PLY_COUNT_DIGITS, '0') << '\n';
+		header << "property list uchar int vertex_indices\n";
+	}
+
+	header << "end_header\n";
+	std::string text = header.str();
+	this->out.writeBytes(text.data(), text.size());
+	this->bHeaderWritten = true;
+	return true;
+}
+
+/* Writes consecutive records. Colored records (x y z r g b as Real) are
+ * stored as x y z and three color bytes.
+ */
+bool PlyWriter::writeRun(const uint8_t* records, std::size_t count, std::size_t record_size) {
+	if ( this->format != PLY_VERTEX_XYZRGB ) return this->out.writeBytes(records, count * record_size);
+
+	const std::size_t vertex_size = 3 * sizeof(Real) + 3;
+	this->color_records.resize(std::min(count, PLY_COLOR_BATCH) * vertex_size);
+
+	for ( std::size_t start = 0; start < count; start += PLY_COLOR_BATCH ) {
+		std::size_t batch = std::min(count - start, PLY_COLOR_BATCH);
+		uint8_t* vertex = this->color_records.data();
+
+		for ( std::size_t i = 0; i < batch; i++ ) {
+			Real values[6];
+			std::memcpy(values, records + (start + i) * record_size, sizeof(values));
+			std::memcpy(vertex, values, 3 * sizeof(Real));
+			vertex[3 * sizeof(Real)] = PlyColorByte(values[3]);
+			vertex[3 * sizeof(Real) + 1] = PlyColorByte(values[4]);
+			vertex[3 * sizeof(Real) + 2] = PlyColorByte(values[5]);
+			vertex += vertex_size;
+		}
+
+		if ( this->out.writeBytes(this->color_records.data(), batch * vertex_size) == false ) return false;
+	}
+
+	return true;
+}
+
+/* Records start with x, y, z (all point types derive from PointXYZ); runs
+ * of valid records are written with a single copy.
+ */
+bool PlyWriter::writeRecords(const uint8_t* records, std::size_t count, std::size_t record_size, bool bDropInvalid, std::vector<uint32_t>* indices) {
+	if ( this->out.isOpen() == false ) return false;
+	if ( this->face_count != 0 ) {
+		std::cerr << "[PlyWriter:writeVertices] Error: Vertices cannot follow faces." << std::endl;
+		return false;
+	}
+
+	if ( this->vertex_count + count >= PLY_NO_VERTEX ) {
+		std::cerr << "[PlyWriter:writeVertices] Error: Too many vertices." << std::endl;
+		return false;
+	}
+
+	if ( this->bHeaderWritten == false ) this->writeHeader();
+	if ( indices != nullptr ) indices->resize(count);
+
+	if ( bDropInvalid == false ) {
+		if ( indices != nullptr )
+			for ( std::size_t i = 0; i < count; i++ ) (*indices)[i] = static_cast<uint32_t>(this->vertex_count + i);
+		this->vertex_count += count;
+		return this->writeRun(records, count, record_size);
+	}
+
+	const std::size_t z_offset = 2 * sizeof(Real);
+	std::size_t run_start = 0;
+	std::size_t run_length = 0;
+
+	for ( std::size_t i = 0; i < count; i++ ) {
+		Real z;
+		std::memcpy(&z, records + i * record_size + z_offset, sizeof(Real));
+
+		if ( z != Real(0) && std::isnan(z) == false ) {
+			if ( run_length == 0 ) run_start = i;
+			run_length++;
+			if ( indices != nullptr ) (*indices)[i] = static_cast<uint32_t>(this->vertex_count);
+			this->vertex_count++;
+			continue;
+		}
+
+		if ( indices != nullptr ) (*indices)[i] = PLY_NO_VERTEX;
+		if ( run_length != 0 ) this->writeRun(records + run_start * record_size, run_length, record_size);
+		run_length = 0;
+	}
+
+	if ( run_length != 0 ) this->writeRun(records + run_start * record_size, run_length, record_size);
+	return this->out.getStatus() == FILE_OK;
+}
+
+bool PlyWriter::writeFace(uint32_t a, uint32_t b, uint32_t c) {
+	if ( this->out.isOpen() == false ) return false;
+	if ( this->bFaces == false ) {
+		std::cerr << "[PlyWriter:writeFace] Error: The file was opened without faces." << std::endl;
+		return false;
+	}
+
+	if ( this->bHeaderWritten == false ) this->writeHeader();
+	this->out.write(uint8_t(3));
+	this->out.write(a);
+	this->out.write(b);
+	this->out.write(c);
+	this->face_count++;
+	return true;
+}
+
+/* Quad a b / c d (image rows, y down) is split into triangles a c b and
+ * b c d, which face the camera (-z) for clouds in camera coordinates.
+ */
+bool PlyWriter::writeGrid(const uint8_t* records, std::size_t record_size, std::size_t width, std::size_t height, const std::vector<uint32_t>& indices, Real max_edge_length) {
+	if ( records == nullptr || indices.size() != width * height ) {
+		std::cerr << "[PlyWriter:writeGridFaces] Error: The vertex indices do not match the grid." << std::endl;
+		return false;
+	}
+
+	const Real max_squared = max_edge_length * max_edge_length;
+	auto isShort = [&](std::size_t i, std::size_t j) {
+		if ( max_edge_length <= Real(0) ) return true;
+		Real p[3], q[3];
+		std::memcpy(p, records + i * record_size, sizeof(p));
+		std::memcpy(q, records + j * record_size, sizeof(q));
+		Real dx = p[0] - q[0], dy = p[1] - q[1], dz = p[2] - q[2];
+		return dx * dx + dy * dy + dz * dz <= max_squared;
+	};
+
+	auto triangle = [&](std::size_t i, std::size_t j, std::size_t k) {
+		if ( indices[i] == PLY_NO_VERTEX || indices[j] == PLY_NO_VERTEX || indices[k] == PLY_NO_VERTEX ) return true;
+		if ( isShort(i, j) == false || isShort(j, k) == false || isShort(k, i) == false ) return true;
+		return this->writeFace(indices[i], indices[j], indices[k]);
+	};
+
+	for ( std::size_t y = 0; y + 1 < height; y++ ) {
+		for ( std::size_t x = 0; x + 1 < width; x++ ) {
+			std::size_t a = y * width + x;
+			std::size_t b = a + 1;
+			std::size_t c = a + width;
+			std::size_t d = c + 1;
+			if ( triangle(a, c, b) == false || triangle(b, c, d) == false ) return false;
+		}
+	}
+
+	return this->out.getStatus() == FILE_OK;
+}
+
+bool PlyWriter::close() {
+	if ( this->out.isOpen() == false ) return false;
+	if ( this->bHeaderWritten == false ) this->writeHeader();
+
+	char digits[32];
+	std::snprintf(digits, sizeof(digits), "%010llu", static_cast<unsigned long long>(this->vertex_count));
+	this->out.seek(this->vertex_count_offset);
+	this->out.writeBytes(digits, PLY_COUNT_DIGITS);
+
+	if ( this->bFaces ) {
+		std::snprintf(digits, sizeof(digits), "%010llu", static_cast<unsigned long long>(this->face_count));
+		this->out.seek(this->face_count_offset);
+		this->out.writeBytes(digits, PLY_COUNT_DIGITS);
+	}
+
+	this->out.close();
+	if ( this->out.getStatus() != FILE_OK ) {
+		std::cerr << "[PlyWriter:close] Error: " << FileStatusToString(this->out.getStatus()) << " in: " << this->filename << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+bool PlyWriter::isOpen() const {
+	return this->out.isOpen();
+}
+
+std::size_t PlyWriter::getVertexCount() const {
+	return this->vertex_count;
+}
+
+std::size_t PlyWriter::getFaceCount() const {
+	return this->face_count;
+}
+
+//------------------------------------------------------------------------------
+
+PlyReader::PlyReader() {
+	this->vertex_element = 0;
+	this->data_offset = 0;
+	this->grid_width = 0;
+	this->grid_height = 0;
+}
+
+PlyReader::~PlyReader() {
+	this->close();
+}
+
+bool PlyReader::open(const std::string& filename) {
+	if ( this->isOpen() ) this->close();
+
+	if ( this->file.open(filename) == false ) {
+		std::cerr << "[PlyReader:open] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	if ( this->parseHeader() == false ) {
+		std::cerr << "[PlyReader:open] Error: Invalid header in: " << filename << std::endl;
+		this->close();
+		return false;
+	}
+
+	return true;
+}
+
+bool PlyReader::close() {
+	if ( this->file.isOpen() == false ) return false;
+	this->elements.clear();
+	this->grid_width = 0;
+	this->grid_height = 0;
+	return this->file.close();
+}
+
+bool PlyReader::isOpen() const {
+	return this->file.isOpen();
+}
+
+static bool PlyScalarType(const std::string& name, char& type, uint32_t& size) {
+	if ( name == "char" || name == "int8" ) { type = 'I'; size = 1; }
+	else if ( name == "uchar" || name == "uint8" ) { type = 'U'; size = 1; }
+	else if ( name == "short" || name == "int16" ) { type = 'I'; size = 2; }
+	else if ( name == "ushort" || name == "uint16" ) { type = 'U'; size = 2; }
+	else if ( name == "int" || name == "int32" ) { type = 'I'; size = 4; }
+	else if ( name == "uint" || name == "uint32" ) { type = 'U'; size = 4; }
+	else if ( name == "float" || name == "float32" ) { type = 'F'; size = 4; }
+	else if ( name == "double" || name == "float64" ) { type = 'F'; size = 8; }
+	else return false;
+	return true;
+}
+
+bool PlyReader::parseHeader() {
+	const char* text = reinterpret_cast<const char*>(this->file.data());
+	std::size_t length = this->file.size();
+	std::size_t position = 0;
+	bool bEnd = false;
+	bool bFormat = false;
+
+	while ( position < length && bEnd == false ) {
+		const char* line = text + position;
+		const char* newline = static_cast<const char*>(std::memchr(line, '\n', length - position));
+		if ( newline == nullptr ) return false;
+		position += std::size_t(newline - line) + 1;
+
+		std::istringstream stream(std::string(line, newline - line));
+		std::string key;
+		if ( !(stream >> key) ) continue;
+
+		if ( key == "ply" || key == "comment" ) continue;
+		if ( key == "end_header" ) bEnd = true;
+		else if ( key == "format" ) {
+			std::string format;
+			stream >> format;
+			if ( format != "binary_little_endian" ) {
+				std::cerr << "[PlyReader:open] Error: Unsupported format: " << format << std::endl;
+				return false;
+			}
+			bFormat = true;
+		}
+		else if ( key == "obj_info" ) {
+			std::string info;
+			stream >> info;
+			if ( info == "grid" ) stream >> this->grid_width >> this->grid_height;
+		}
+		else if ( key == "element" ) {
+			Element element;
+			if ( !(stream >> element.name >> element.count) ) return false;
+			this->elements.push_back(element);
+		}
+		else if ( key == "property" ) {
+			if ( this->elements.size() == 0 ) return false;
+			Property property = Property();
+			std::string type;
+			stream >> type;
+
+			if ( type == "list" ) {
+				std::string count_type, item_type;
+				char count_kind;
+				stream >> count_type >> item_type;
+				if ( PlyScalarType(count_type, count_kind, property.list_count_size) == false || count_kind == 'F' ) return false;
+				if ( PlyScalarType(item_type, property.type, property.size) == false ) return false;
+				property.bList = true;
+			}
+			else if ( PlyScalarType(type, property.type, property.size) == false ) return false;
+
+			if ( !(stream >> property.name) ) return false;
+			this->elements.back().properties.push_back(property);
+		}
+		else return false;
+	}
+
+	if ( bEnd == false || bFormat == false ) return false;
+
+	this->vertex_element = this->elements.size();
+	for ( std::size_t i = 0; i < this->elements.size(); i++ )
+		if ( this->elements[i].name == "vertex" ) this->vertex_element = i;
+
+	this->data_offset = position;
+	return true;
+}
+
+std::size_t PlyReader::getVertexCount() const {
+	if ( this->vertex_element >= this->elements.size() ) return 0;
+	return this->elements[this->vertex_element].count;
+}
+
+std::size_t PlyReader::getFaceCount() const {
+	for ( std::size_t i = 0; i < this->elements.size(); i++ )
+		if ( this->elements[i].name == "face" ) return this->elements[i].count;
+	return 0;
+}
+
+std::size_t PlyReader::getWidth() const {
+	if ( this->grid_width * this->grid_height == this->getVertexCount() && this->grid_width != 0 ) return this->grid_width;
+	return this->getVertexCount();
+}
+
+std::size_t PlyReader::getHeight() const {
+	if ( this->grid_width * this->grid_height == this->getVertexCount() && this->grid_width != 0 ) return this->grid_height;
+	return 1;
+}
+
+static uint64_t LoadPlyCount(const uint8_t* data, uint32_t size) {
+	uint64_t value = 0;
+	std::memcpy(&value, data, size);
+	return value;
+}
+
+/* Returns the end of the element data, or nullptr if it exceeds the file. */
+const uint8_t* PlyReader::skipElement(const uint8_t* data, const Element& element) const {
+	const uint8_t* end = this->file.data() + this->file.size();
+	std::size_t record_size = 0;
+	bool bFixed = true;
+
+	for ( std::size_t p = 0; p < element.properties.size(); p++ ) {
+		if ( element.properties[p].bList ) bFixed = false;
+		else record_size += element.properties[p].size;
+	}
+
+	if ( bFixed ) {
+		if ( std::size_t(end - data) / std::max<std::size_t>(record_size, 1) < element.count ) return nullptr;
+		return data + record_size * element.count;
+	}
+
+	for ( std::size_t i = 0; i < element.count; i++ ) {
+		for ( std::size_t p = 0; p < element.properties.size(); p++ ) {
+			const Property& property = element.properties[p];
+			if ( property.bList == false ) {
+				if ( std::size_t(end - data) < property.size ) return nullptr;
+				data += property.size;
+				continue;
+			}
+
+			if ( std::size_t(end - data) < property.list_count_size ) return nullptr;
+			uint64_t items = LoadPlyCount(data, property.list_count_size);
+			data += property.list_count_size;
+			if ( uint64_t(end - data) / property.size < items ) return nullptr;
+			data += items * property.size;
+		}
+	}
+
+	return data;
+}
+
+template <typename T>
+static Real LoadPlyValue(const uint8_t* data) {
+	T value;
+	std::memcpy(&value, data, sizeof(T));
+	return static_cast<Real>(value);
+}
+
+/* Converts a property value; integer colors are scaled to [0, 1]. */
+static Real LoadPlyProperty(const uint8_t* data, char type, uint32_t size, bool bColor) {
+	if ( type == 'F' ) return (size == 4) ? LoadPlyValue<float>(data) : LoadPlyValue<double>(data);
+
+	Real value;
+	if ( type == 'I' ) {
+		switch ( size ) {
+			case 1: value = LoadPlyValue<int8_t>(data); break;
+			case 2: value = LoadPlyValue<int16_t>(data); break;
+			default: value = LoadPlyValue<int32_t>(data); break;
+		}
+	}
+	else {
+		switch ( size ) {
+			case 1: value = LoadPlyValue<uint8_t>(data); break;
+			case 2: value = LoadPlyValue<uint16_t>(data); break;
+			default: value = LoadPlyValue<uint32_t>(data); break;
+		}
+	}
+
+	if ( bColor ) value /= Real((uint64_t(1) << (8 * size - (type == 'I' ? 1 : 0))) - 1);
+	return value;
+}
+
+bool PlyReader::readRecords(uint8_t* records, std::size_t count, PlyVertexFormat format) {
+	if ( this->isOpen() == false || records == nullptr ) return false;
+	if ( this->vertex_element >= this->elements.size() || count != this->getVertexCount() ) {
+		std::cerr << "[PlyReader:readVertices] Error: Expected " << this->getVertexCount() << " vertices." << std::endl;
+		return false;
+	}
+
+	const uint8_t* data = this->file.data() + this->data_offset;
+	for ( std::size_t e = 0; e < this->vertex_element && data != nullptr; e++ )
+		data = this->skipElement(data, this->elements[e]);
+
+	const Element& vertex = this->elements[this->vertex_element];
+	if ( data == nullptr || this->skipElement(data, vertex) == nullptr ) {
+		std::cerr << "[PlyReader:readVertices] Error: Vertex data is truncated." << std::endl;
+		return false;
+	}
+
+	// Position of each wanted property in the vertex element (or none).
+	const std::size_t properties = PlyPropertyCount(format);
+	const std::size_t record_size = properties * sizeof(Real);
+	std::size_t source[6];
+	bool bExact = vertex.properties.size() == properties;
+
+	for ( std::size_t k = 0; k < properties; k++ ) {
+		source[k] = vertex.properties.size();
+		for ( std::size_t p = 0; p < vertex.properties.size(); p++ )
+			if ( vertex.properties[p].bList == false && vertex.properties[p].name == PLY_PROPERTY_NAMES[format][k] ) source[k] = p;
+
+		if ( source[k] == vertex.properties.size() && k < 3 ) {
+			std::cerr << "[PlyReader:readVertices] Error: Missing vertex property: " << PLY_PROPERTY_NAMES[format][k] << std::endl;
+			return false;
+		}
+
+		if ( source[k] != k || vertex.properties[k].type != 'F' || vertex.properties[k].size != sizeof(Real) ) bExact = false;
+	}
+
+	// Files in our own layout are a single copy.
+	if ( bExact ) {
+		std::memcpy(records, data, count * record_size);
+		return true;
+	}
+
+	std::vector<std::size_t> offsets(vertex.properties.size() + 1, 0);
+	for ( std::size_t i = 0; i < count; i++ ) {
+		// Property offsets of this record (they only vary with list properties).
+		const uint8_t* field = data;
+		for ( std::size_t p = 0; p < vertex.properties.size(); p++ ) {
+			const Property& property = vertex.properties[p];
+			offsets[p] = field - data;
+			if ( property.bList ) field += property.list_count_size + LoadPlyCount(field, property.list_count_size) * property.size;
+			else field += property.size;
+		}
+
+		uint8_t* record = records + i * record_size;
+		for ( std::size_t k = 0; k < properties; k++ ) {
+			Real value = Real(0);
+			if ( source[k] != vertex.properties.size() ) {
+				const Property& property = vertex.properties[source[k]];
+				value = LoadPlyProperty(data + offsets[source[k]], property.type, property.size, format == PLY_VERTEX_XYZRGB && k >= 3);
+			}
+			std::memcpy(record + k * sizeof(Real), &value, sizeof(Real));
+		}
+
+		data = field;
+	}
+
+	return true;
+}
+
+}
@@ -0,0 +1,235 @@
+#ifndef PX_PLY_FILE_H
+#define PX_PLY_FILE_H
+
+#include <string>
+#include <vector>
+#include <limits>
+#include "OrganizedCloud.h"
+#include "MappedFile.h"
+#include "BufferedFileWriter.h"
+
+namespace px {
+
+/* Vertex layouts of PLY files, matching the point types: x y z, then the
+ * normal (nx ny nz) or the color (red green blue). Coordinates and normals
+ * are stored as float. Colors are float in [0, 1] in the point types (like
+ * the Palette colors) and stored as uchar 0-255, which common viewers expect.
+ */
+enum PlyVertexFormat {
+	PLY_VERTEX_XYZ,
+	PLY_VERTEX_XYZN,
+	PLY_VERTEX_XYZRGB
+};
+
+template <class PointType>
+struct PlyVertexTraits;
+
+template <>
+struct PlyVertexTraits<PointXYZ<Real> > {
+	const static PlyVertexFormat format = PLY_VERTEX_XYZ;
+};
+
+template <>
+struct PlyVertexTraits<PointXYZN<Real> > {
+	const static PlyVertexFormat format = PLY_VERTEX_XYZN;
+};
+
+template <>
+struct PlyVertexTraits<PointXYZRGB<Real> > {
+	const static PlyVertexFormat format = PLY_VERTEX_XYZRGB;
+};
+
+/* Index of vertices that were dropped by PlyWriter::writeVertices. */
+const static uint32_t PLY_NO_VERTEX = std::numeric_limits<uint32_t>::max();
+
+std::size_t PlyPropertyCount(PlyVertexFormat format);
+
+/* Streaming binary little-endian PLY writer. Vertices are written straight
+ * from the point buffers (runs of valid points in a single copy, colored
+ * points are converted to uchar colors through a small buffer); invalid
+ * points (z == 0 or NaN) can be dropped on the fly. Triangles follow the
+ * vertices. The header goes out with the first vertices; the element counts
+ * are patched in by close(), so nothing has to be known in advance.
+ *
+ * A grid size (setGrid) is stored as obj_info; LoadPly restores the shape
+ * of organized clouds when the vertex count matches.
+ */
+class PlyWriter {
+public:
+	PlyWriter();
+	~PlyWriter();
+
+	bool open(const std::string& filename, PlyVertexFormat format, bool bFaces = false);
+	bool close();
+	bool isOpen() const;
+
+	bool setGrid(std::size_t width, std::size_t height);
+
+	/* Appends vertices. With indices, the vertex number of every point is
+	 * returned (PLY_NO_VERTEX for dropped points).
+	 */
+	template <class PointType>
+	bool writeVertices(const PointType* points, std::size_t count, bool bDropInvalid = false, std::vector<uint32_t>* indices = nullptr);
+
+	/* Appends triangles; no vertices can be written afterwards. Grid faces
+	 * connect the pixels of an organized cloud (two triangles per quad,
+	 * facing the camera) whose corners were all written, skipping triangles
+	 * with an edge longer than max_edge_length (0 = no limit).
+	 */
+	bool writeFace(uint32_t a, uint32_t b, uint32_t c);
+	template <class PointType>
+	bool writeGridFaces(const PointType* points, std::size_t width, std::size_t height, const std::vector<uint32_t>& indices, Real max_edge_length = Real(0));
+
+	std::size_t getVertexCount() const;
+	std::size_t getFaceCount() const;
+
+protected:
+	PlyWriter(const PlyWriter&) = delete;
+	PlyWriter& operator = (const PlyWriter&) = delete;
+
+	bool writeHeader();
+	bool writeRun(const uint8_t* records, std::size_t count, std::size_t record_size);
+	bool writeRecords(const uint8_t* records, std::size_t count, std::size_t record_size, bool bDropInvalid, std::vector<uint32_t>* indices);
+	bool writeGrid(const uint8_t* records, std::size_t record_size, std::size_t width, std::size_t height, const std::vector<uint32_t>& indices, Real max_edge_length);
+
+	BufferedFileWriter out;
+	std::string filename;
+	std::vector<uint8_t> color_records;
+	PlyVertexFormat format;
+	std::size_t grid_width, grid_height;
+	std::size_t vertex_count;
+	std::size_t face_count;
+	uint64_t vertex_count_offset;
+	uint64_t face_count_offset;
+	bool bFaces;
+	bool bHeaderWritten;
+};
+
+/* Reads the vertex element of binary little-endian PLY files (other
+ * elements are skipped). Properties of any scalar type are converted; color
+ * properties of integer type are scaled to [0, 1]. Missing normal or color
+ * properties read as 0.
+ */
+class PlyReader {
+public:
+	PlyReader();
+	~PlyReader();
+
+	bool open(const std::string& filename);
+	bool close();
+	bool isOpen() const;
+
+	std::size_t getVertexCount() const;
+	std::size_t getFaceCount() const;
+
+	/* Grid size from obj_info if it matches the vertex count, else count x 1. */
+	std::size_t getWidth() const;
+	std::size_t getHeight() const;
+
+	template <class PointType>
+	bool readVertices(PointType* points, std::size_t count);
+
+protected:
+	PlyReader(const PlyReader&) = delete;
+	PlyReader& operator = (const PlyReader&) = delete;
+
+	struct Property {
+		std::string name;
+		char type;
+		uint32_t size;
+		uint32_t list_count_size;
+		bool bList;
+	};
+
+	struct Element {
+		std::string name;
+		std::size_t count;
+		std::vector<Property> properties;
+	};
+
+	bool parseHeader();
+	bool readRecords(uint8_t* records, std::size_t count, PlyVertexFormat format);
+	const uint8_t* skipElement(const uint8_t* data, const Element& element) const;
+
+	MappedFile file;
+	std::vector<Element> elements;
+	std::size_t vertex_element;
+	std::size_t data_offset;
+	std::size_t grid_width, grid_height;
+};
+
+template <class PointType>
+bool SavePly(const std::string& filename, const OrganizedCloud<PointType>& cloud, bool bDropInvalid = true);
+
+/* Triangulates the pixel grid of the cloud (see PlyWriter::writeGridFaces). */
+template <class PointType>
+bool SavePlyMesh(const std::string& filename, const OrganizedCloud<PointType>& cloud, Real max_edge_length = Real(0));
+
+template <class PointType>
+bool LoadPly(const std::string& filename, OrganizedCloud<PointType>& cloud);
+
+//------------------------------------------------------------------------------
+// Implementation
+//------------------------------------------------------------------------------
+template <class PointType>
+bool PlyWriter::writeVertices(const PointType* points, std::size_t count, bool bDropInvalid, std::vector<uint32_t>* indices) {
+	static_assert(sizeof(PointType) == sizeof(Real) * (PlyVertexTraits<PointType>::format == PLY_VERTEX_XYZ ? 3 : 6), "PlyWriter: point type must be unpadded.");
+	if ( PlyVertexTraits<PointType>::format != this->format ) {
+		std::cerr << "[PlyWriter:writeVertices] Error: Point type does not match the vertex format." << std::endl;
+		return false;
+	}
+
+	return this->writeRecords(reinterpret_cast<const uint8_t*>(points), count, sizeof(PointType), bDropInvalid, indices);
+}
+
+template <class PointType>
+bool PlyWriter::writeGridFaces(const PointType* points, std::size_t width, std::size_t height, const std::vector<uint32_t>& indices, Real max_edge_length) {
+	return this->writeGrid(reinterpret_cast<const uint8_t*>(points), sizeof(PointType), width, height, indices, max_edge_length);
+}
+
+template <class PointType>
+bool PlyReader::readVertices(PointType* points, std::size_t count) {
+	static_assert(sizeof(PointType) == sizeof(Real) * (PlyVertexTraits<PointType>::format == PLY_VERTEX_XYZ ? 3 : 6), "PlyReader: point type must be unpadded.");
+	return this->readRecords(reinterpret_cast<uint8_t*>(points), count, PlyVertexTraits<PointType>::format);
+}
+
+template <class PointType>
+bool SavePly(const std::string& filename, const OrganizedCloud<PointType>& cloud, bool bDropInvalid) {
+	if ( cloud.constData() == nullptr ) return false;
+
+	PlyWriter writer;
+	if ( writer.open(filename, PlyVertexTraits<PointType>::format) == false ) return false;
+	if ( bDropInvalid == false ) writer.setGrid(cloud.width(), cloud.height());
+	if ( writer.writeVertices(cloud.constData(), cloud.size(), bDropInvalid) == false ) return false;
+	return writer.close();
+}
+
+template <class PointType>
+bool SavePlyMesh(const std::string& filename, const OrganizedCloud<PointType>& cloud, Real max_edge_length) {
+	if ( cloud.constData() == nullptr ) return false;
+
+	PlyWriter writer;
+	std::vector<uint32_t> indices;
+	if ( writer.open(filename, PlyVertexTraits<PointType>::format, true) == false ) return false;
+	if ( writer.writeVertices(cloud.constData(), cloud.size(), true, &indices) == false ) return false;
+	if ( writer.writeGridFaces(cloud.constData(), cloud.width(), cloud.height(), indices, max_edge_length) == false ) return false;
+	return writer.close();
+}
+
+template <class PointType>
+bool LoadPly(const std::string& filename, OrganizedCloud<PointType>& cloud) {
+	PlyReader reader;
+	if ( reader.open(filename) == false ) return false;
+
+	if ( reader.getVertexCount() == 0 ) {
+		std::cerr << "[LoadPly] Error: No vertices in: " << filename << std::endl;
+		return false;
+	}
+
+	if ( cloud.resize(reader.getWidth(), reader.getHeight()) == false ) return false;
+	return reader.readVertices(cloud.getData(), cloud.size());
+}
+
+}
+
+#endif
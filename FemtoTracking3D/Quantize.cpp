@@ -0,0 +1,240 @@
+#include "Quantize.h"
+#include "CpuFeatures.h"
+#include <atomic>
+
+#if defined(PX_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+namespace px {
+
+const static Real QUANTIZE_LOW = Real(-32768);
+const static Real QUANTIZE_HIGH = Real(32767);
+
+/* The period of the interleaved component pattern is lcm(3, lanes): 24
+ * Reals (three AVX2 registers) or 12 Reals (three SSE registers).
+ */
+const static std::size_t PATTERN_SIZE = 24;
+
+inline bool ExpandPattern(const Real values[DIM3], Real pattern[PATTERN_SIZE]) {
+	for ( std::size_t i = 0; i < PATTERN_SIZE; i++ )
+		pattern[i] = values[i % DIM3];
+	return true;
+}
+
+/* Written to match the vector min/max semantics exactly (a NaN input
+ * saturates to the low bound), so every kernel is bit-identical.
+ */
+inline int16_t QuantizeValue(Real value, Real offset, Real scale) {
+	Real v = (value - offset) * scale;
+	v = (v > QUANTIZE_LOW) ? v : QUANTIZE_LOW;
+	v = (v < QUANTIZE_HIGH) ? v : QUANTIZE_HIGH;
+	return static_cast<int16_t>(static_cast<int32_t>(v));
+}
+
+inline Real DequantizeValue(int16_t value, Real offset, Real scale) {
+	Real product = Real(value) * scale;
+	return offset + product;
+}
+
+void QuantizeScalar(const Real* src, int16_t* dst, std::size_t count, const Real* offset, const Real* scale) {
+	std::size_t index = 0;
+	for ( std::size_t i = 0; i < count; i++ ) {
+		dst[index] = QuantizeValue(src[index], offset[0], scale[0]);
+		dst[index+1] = QuantizeValue(src[index+1], offset[1], scale[1]);
+		dst[index+2] = QuantizeValue(src[index+2], offset[2], scale[2]);
+		index += DIM3;
+	}
+}
+
+void DequantizeScalar(const int16_t* src, Real* dst, std::size_t count, const Real* offset, const Real* scale) {
+	std::size_t index = 0;
+	for ( std::size_t i = 0; i < count; i++ ) {
+		dst[index] = DequantizeValue(src[index], offset[0], scale[0]);
+		dst[index+1] = DequantizeValue(src[index+1], offset[1], scale[1]);
+		dst[index+2] = DequantizeValue(src[index+2], offset[2], scale[2]);
+		index += DIM3;
+	}
+}
+
+#if defined(PX_SIMD_X86)
+PX_TARGET_SSE41 void QuantizeSSE41(const Real* src, int16_t* dst, std::size_t count, const Real* offset, const Real* scale) {
+	Real offsets[PATTERN_SIZE], scales[PATTERN_SIZE];
+	ExpandPattern(offset, offsets);
+	ExpandPattern(scale, scales);
+
+	const __m128 low = _mm_set1_ps(QUANTIZE_LOW);
+	const __m128 high = _mm_set1_ps(QUANTIZE_HIGH);
+	__m128 o[3], s[3];
+	for ( int k = 0; k < 3; k++ ) {
+		o[k] = _mm_loadu_ps(offsets + 4 * k);
+		s[k] = _mm_loadu_ps(scales + 4 * k);
+	}
+
+	std::size_t n = count * DIM3;
+	std::size_t i = 0;
+	for ( ; i + 12 <= n; i += 12 ) {
+		__m128i q[3];
+		for ( int k = 0; k < 3; k++ ) {
+			__m128 v = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(src + i + 4 * k), o[k]), s[k]);
+			v = _mm_min_ps(_mm_max_ps(v, low), high);
+			q[k] = _mm_cvttps_epi32(v);
+		}
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(q[0], q[1]));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i + 8), _mm_packs_epi32(q[2], q[2]));
+	}
+
+	QuantizeScalar(src + i, dst + i, (n - i) / DIM3, offset, scale);
+}
+
+PX_TARGET_SSE41 void DequantizeSSE41(const int16_t* src, Real* dst, std::size_t count, const Real* offset, const Real* scale) {
+	Real offsets[PATTERN_SIZE], scales[PATTERN_SIZE];
+	ExpandPattern(offset, offsets);
+	ExpandPattern(scale, scales);
+
+	__m128 o[3], s[3];
+	for ( int k = 0; k < 3; k++ ) {
+		o[k] = _mm_loadu_ps(offsets + 4 * k);
+		s[k] = _mm_loadu_ps(scales + 4 * k);
+	}
+
+	std::size_t n = count * DIM3;
+	std::size_t i = 0;
+	for ( ; i + 12 <= n; i += 12 ) {
+		for ( int k = 0; k < 3; k++ ) {
+			__m128i q = _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i + 4 * k)));
+			__m128 v = _mm_add_ps(o[k], _mm_mul_ps(_mm_cvtepi32_ps(q), s[k]));
+			_mm_storeu_ps(dst + i + 4 * k, v);
+		}
+	}
+
+	DequantizeScalar(src + i, dst + i, (n - i) / DIM3, offset, scale);
+}
+
+PX_TARGET_AVX2 void QuantizeAVX2(const Real* src, int16_t* dst, std::size_t count, const Real* offset, const Real* scale) {
+	Real offsets[PATTERN_SIZE], scales[PATTERN_SIZE];
+	ExpandPattern(offset, offsets);
+	ExpandPattern(scale, scales);
+
+	const __m256 low = _mm256_set1_ps(QUANTIZE_LOW);
+	const __m256 high = _mm256_set1_ps(QUANTIZE_HIGH);
+	__m256 o[3], s[3];
+	for ( int k = 0; k < 3; k++ ) {
+		o[k] = _mm256_loadu_ps(offsets + 8 * k);
+		s[k] = _mm256_loadu_ps(scales + 8 * k);
+	}
+
+	std::size_t n = count * DIM3;
+	std::size_t i = 0;
+	for ( ; i + PATTERN_SIZE <= n; i += PATTERN_SIZE ) {
+		for ( int k = 0; k < 3; k++ ) {
+			__m256 v = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(src + i + 8 * k), o[k]), s[k]);
+			v = _mm256_min_ps(_mm256_max_ps(v, low), high);
+			__m256i q = _mm256_cvttps_epi32(v);
+			__m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(q), _mm256_extracti128_si256(q, 1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8 * k), packed);
+		}
+	}
+
+	QuantizeScalar(src + i, dst + i, (n - i) / DIM3, offset, scale);
+}
+
+PX_TARGET_AVX2 void DequantizeAVX2(const int16_t* src, Real* dst, std::size_t count, const Real* offset, const Real* scale) {
+	Real offsets[PATTERN_SIZE], scales[PATTERN_SIZE];
+	ExpandPattern(offset, offsets);
+	ExpandPattern(scale, scales);
+
+	__m256 o[3], s[3];
+	for ( int k = 0; k < 3; k++ ) {
+		o[k] = _mm256_loadu_ps(offsets + 8 * k);
+		s[k] = _mm256_loadu_ps(scales + 8 * k);
+	}
+
+	std::size_t n = count * DIM3;
+	std::size_t i = 0;
+	for ( ; i + PATTERN_SIZE <= n; i += PATTERN_SIZE ) {
+		for ( int k = 0; k < 3; k++ ) {
+			__m256i q = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8 * k)));
+			__m256 v = _mm256_add_ps(o[k], _mm256_mul_ps(_mm256_cvtepi32_ps(q), s[k]));
+			_mm256_storeu_ps(dst + i + 8 * k, v);
+		}
+	}
+
+	DequantizeScalar(src + i, dst + i, (n - i) / DIM3, offset, scale);
+}
+#endif
+
+inline QuantizeKernel BestQuantizeKernel(QuantizeKernel requested) {
+#if defined(PX_SIMD_X86)
+	const CpuFeatures& features = CpuFeatures::Get();
+	if ( requested == QUANTIZE_AVX2 && features.avx2 ) return QUANTIZE_AVX2;
+	if ( requested != QUANTIZE_SCALAR && features.sse41 ) return QUANTIZE_SSE41;
+#endif
+	return QUANTIZE_SCALAR;
+}
+
+static std::atomic<int> active_kernel(-1);
+
+inline QuantizeKernel ActiveKernel() {
+	int kernel = active_kernel.load(std::memory_order_relaxed);
+	if ( kernel >= 0 ) return static_cast<QuantizeKernel>(kernel);
+
+	QuantizeKernel best = BestQuantizeKernel(QUANTIZE_AVX2);
+	active_kernel.store(static_cast<int>(best), std::memory_order_relaxed);
+	return best;
+}
+
+void QuantizeXYZ(const Real* src, int16_t* dst, std::size_t count, const Real offset[DIM3], const Real scale[DIM3]) {
+	switch ( ActiveKernel() ) {
+#if defined(PX_SIMD_X86)
+		case QUANTIZE_AVX2: QuantizeAVX2(src, dst, count, offset, scale); return;
+		case QUANTIZE_SSE41: QuantizeSSE41(src, dst, count, offset, scale); return;
+#endif
+		default: QuantizeScalar(src, dst, count, offset, scale); return;
+	}
+}
+
+void DequantizeXYZ(const int16_t* src, Real* dst, std::size_t count, const Real offset[DIM3], const Real scale[DIM3]) {
+	switch ( ActiveKernel() ) {
+#if defined(PX_SIMD_X86)
+		case QUANTIZE_AVX2: DequantizeAVX2(src, dst, count, offset, scale); return;
+		case QUANTIZE_SSE41: DequantizeSSE41(src, dst, count, offset, scale); return;
+#endif
+		default: DequantizeScalar(src, dst, count, offset, scale); return;
+	}
+}
+
+void QuantizePlanarXYZ(const Real* const planes[DIM3], int16_t* dst, std::size_t count, const Real offset[DIM3], const Real scale[DIM3]) {
+	const Real* x = planes[X];
+	const Real* y = planes[Y];
+	const Real* z = planes[Z];
+	for ( std::size_t i = 0; i < count; i++ ) {
+		dst[i * DIM3] = QuantizeValue(x[i], offset[0], scale[0]);
+		dst[i * DIM3 + 1] = QuantizeValue(y[i], offset[1], scale[1]);
+		dst[i * DIM3 + 2] = QuantizeValue(z[i], offset[2], scale[2]);
+	}
+}
+
+void DequantizePlanarXYZ(const int16_t* src, Real* const planes[DIM3], std::size_t count, const Real offset[DIM3], const Real scale[DIM3]) {
+	Real* x = planes[X];
+	Real* y = planes[Y];
+	Real* z = planes[Z];
+	for ( std::size_t i = 0; i < count; i++ ) {
+		x[i] = DequantizeValue(src[i * DIM3], offset[0], scale[0]);
+		y[i] = DequantizeValue(src[i * DIM3 + 1], offset[1], scale[1]);
+		z[i] = DequantizeValue(src[i * DIM3 + 2], offset[2], scale[2]);
+	}
+}
+
+bool SetQuantizeKernel(QuantizeKernel kernel) {
+	QuantizeKernel selected = BestQuantizeKernel(kernel);
+	active_kernel.store(static_cast<int>(selected), std::memory_order_relaxed);
+	return selected == kernel;
+}
+
+QuantizeKernel GetQuantizeKernel() {
+	return ActiveKernel();
+}
+
+}
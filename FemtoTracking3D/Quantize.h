@@ -0,0 +1,43 @@
+#ifndef PX_QUANTIZE_H
+#define PX_QUANTIZE_H
+
+#include <cstdint>
+#include "Mathematics.h"
+
+namespace px {
+
+enum QuantizeKernel {
+	QUANTIZE_SCALAR,
+	QUANTIZE_SSE41,
+	QUANTIZE_AVX2
+};
+
+/* Quantizes interleaved (x, y, z) Real triplets to int16:
+ *   q = saturate_int16(trunc((v - offset[c]) * scale[c]))
+ * and dequantizes them back:
+ *   v = offset[c] + q * scale[c]
+ * where c is the component index. The count is in points (triplets).
+ *
+ * All kernels produce bit-identical results. Out of range values saturate
+ * to [-32768, 32767] instead of wrapping.
+ */
+void QuantizeXYZ(const Real* src, int16_t* dst, std::size_t count, const Real offset[DIM3], const Real scale[DIM3]);
+void DequantizeXYZ(const int16_t* src, Real* dst, std::size_t count, const Real offset[DIM3], const Real scale[DIM3]);
+
+/* The same quantization for planar clouds: the x, y and z planes are read
+ * with unit stride and the samples are written (or read) as interleaved
+ * int16 triplets, the serialized layout. Results are bit-identical to
+ * QuantizeXYZ / DequantizeXYZ of the interleaved points.
+ */
+void QuantizePlanarXYZ(const Real* const planes[DIM3], int16_t* dst, std::size_t count, const Real offset[DIM3], const Real scale[DIM3]);
+void DequantizePlanarXYZ(const int16_t* src, Real* const planes[DIM3], std::size_t count, const Real offset[DIM3], const Real scale[DIM3]);
+
+/* The best supported kernel is selected on first use. Setting a kernel the
+ * CPU does not support falls back to the best supported one.
+ */
+bool SetQuantizeKernel(QuantizeKernel kernel);
+QuantizeKernel GetQuantizeKernel();
+
+}
+
+#endif
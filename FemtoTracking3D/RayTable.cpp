@@ -0,0 +1,172 @@
+#include "RayTable.h"
+#include <sstream>
+#include <cmath>
+
+namespace px {
+
+bool CameraIntrinsics::isValid() const {
+	if ( this->width == 0 || this->height == 0 ) return false;
+	if ( this->fx <= 0.0f || this->fy <= 0.0f ) return false;
+	if ( this->depth_scale <= 0.0f ) return false;
+	return true;
+}
+
+std::string CameraIntrinsics::toString() const {
+	std::stringstream stream;
+	stream << "Size: " << this->width << "x" << this->height << std::endl;
+	stream << "Focal: " << this->fx << ", " << this->fy << std::endl;
+	stream << "Center: " << this->cx << ", " << this->cy << std::endl;
+	stream << "Depth Scale: " << this->depth_scale << std::endl;
+	return stream.str();
+}
+
+RayTable::RayTable() {
+	this->intrinsics = CameraIntrinsics();
+}
+
+RayTable::RayTable(const CameraIntrinsics& intrinsics) {
+	this->intrinsics = CameraIntrinsics();
+	this->build(intrinsics);
+}
+
+bool RayTable::build(const CameraIntrinsics& intrinsics) {
+	if ( intrinsics.isValid() == false ) {
+		std::cerr << "[RayTable:build] Error: Invalid camera intrinsics." << std::endl;
+		return false;
+	}
+
+	this->intrinsics = intrinsics;
+	std::size_t w = intrinsics.width;
+	std::size_t h = intrinsics.height;
+	this->ray_x.resize(w * h);
+	this->ray_y.resize(w * h);
+
+	const Real inv_fx = Real(1) / Real(intrinsics.fx);
+	const Real inv_fy = Real(1) / Real(intrinsics.fy);
+
+	for ( std::size_t i = 0; i < h; i++ ) {
+		Real ry = (Real(i) - Real(intrinsics.cy)) * inv_fy;
+		for ( std::size_t j = 0; j < w; j++ ) {
+			this->ray_x[i * w + j] = (Real(j) - Real(intrinsics.cx)) * inv_fx;
+			this->ray_y[i * w + j] = ry;
+		}
+	}
+
+	return true;
+}
+
+bool RayTable::isValid() const {
+	return this->ray_x.size() != 0;
+}
+
+bool RayTable::reconstruct(const uint16_t* depth, PointXYZ<Real>* points, std::size_t count) const {
+	if ( depth == nullptr || points == nullptr ) return false;
+	if ( count != this->ray_x.size() ) return false;
+
+	const Real scale = Real(this->intrinsics.depth_scale);
+	const Real* rx = this->ray_x.data();
+	const Real* ry = this->ray_y.data();
+
+	for ( std::size_t i = 0; i < count; i++ ) {
+		Real z = Real(depth[i]) * scale;
+		points[i].x = rx[i] * z;
+		points[i].y = ry[i] * z;
+		points[i].z = z;
+	}
+
+	return true;
+}
+
+/* Native depth of z: rounded and saturated to [0, 65535]. */
+inline uint16_t ProjectDepth(Real z, Real inv_scale) {
+	const Real high = Real(65535);
+	Real d = std::round(z * inv_scale);
+	d = (d > Real(0)) ? d : Real(0);
+	d = (d < high) ? d : high;
+	return static_cast<uint16_t>(d);
+}
+
+bool RayTable::project(const PointXYZ<Real>* points, uint16_t* depth, std::size_t count) const {
+	if ( depth == nullptr || points == nullptr ) return false;
+	if ( this->intrinsics.depth_scale <= 0.0f ) return false;
+
+	const Real inv_scale = Real(1) / Real(this->intrinsics.depth_scale);
+	for ( std::size_t i = 0; i < count; i++ )
+		depth[i] = ProjectDepth(points[i].z, inv_scale);
+
+	return true;
+}
+
+bool RayTable::matches(const PointXYZ<Real>* points, std::size_t count) const {
+	if ( points == nullptr ) return false;
+	if ( count != this->ray_x.size() ) return false;
+
+	// Half a pixel at depth z is z / (2 f) in x and y.
+	const Real tol_x = Real(0.5) / Real(this->intrinsics.fx);
+	const Real tol_y = Real(0.5) / Real(this->intrinsics.fy);
+	const Real* rx = this->ray_x.data();
+	const Real* ry = this->ray_y.data();
+
+	for ( std::size_t i = 0; i < count; i++ ) {
+		Real z = std::abs(points[i].z);
+		if ( std::abs(points[i].x - rx[i] * points[i].z) > tol_x * z ) return false;
+		if ( std::abs(points[i].y - ry[i] * points[i].z) > tol_y * z ) return false;
+	}
+
+	return true;
+}
+
+bool RayTable::reconstruct(const uint16_t* depth, Real* x, Real* y, Real* z, std::size_t count) const {
+	if ( depth == nullptr || x == nullptr || y == nullptr || z == nullptr ) return false;
+	if ( count != this->ray_x.size() ) return false;
+
+	const Real scale = Real(this->intrinsics.depth_scale);
+	const Real* rx = this->ray_x.data();
+	const Real* ry = this->ray_y.data();
+
+	for ( std::size_t i = 0; i < count; i++ ) {
+		Real d = Real(depth[i]) * scale;
+		x[i] = rx[i] * d;
+		y[i] = ry[i] * d;
+		z[i] = d;
+	}
+
+	return true;
+}
+
+bool RayTable::project(const Real* z, uint16_t* depth, std::size_t count) const {
+	if ( depth == nullptr || z == nullptr ) return false;
+	if ( this->intrinsics.depth_scale <= 0.0f ) return false;
+
+	const Real inv_scale = Real(1) / Real(this->intrinsics.depth_scale);
+	for ( std::size_t i = 0; i < count; i++ )
+		depth[i] = ProjectDepth(z[i], inv_scale);
+
+	return true;
+}
+
+std::size_t RayTable::width() const {
+	return this->intrinsics.width;
+}
+
+std::size_t RayTable::height() const {
+	return this->intrinsics.height;
+}
+
+std::size_t RayTable::size() const {
+	return this->ray_x.size();
+}
+
+const CameraIntrinsics& RayTable::getIntrinsics() const {
+	return this->intrinsics;
+}
+
+const Real* RayTable::constRayX() const {
+	return this->ray_x.data();
+}
+
+const Real* RayTable::constRayY() const {
+	return this->ray_y.data();
+}
+
+}
@@ -0,0 +1,76 @@
+#ifndef PX_RAY_TABLE_H
+#define PX_RAY_TABLE_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "Mathematics.h"
+#include "PointTypes.h"
+
+namespace px {
+
+/* Pinhole intrinsics of a depth sensor. The depth scale converts native
+ * depth units to cloud units (z = depth * depth_scale).
+ */
+struct CameraIntrinsics {
+	uint32_t width;
+	uint32_t height;
+	float fx, fy;
+	float cx, cy;
+	float depth_scale;
+
+	bool isValid() const;
+	std::string toString() const;
+};
+
+/* Per-pixel viewing rays of a depth sensor, computed once from its
+ * intrinsics. A point is rebuilt from its native depth sample as
+ *   z = depth * depth_scale, x = ray_x * z, y = ray_y * z
+ * which is one multiply per component and vectorizes trivially.
+ */
+class RayTable {
+public:
+	RayTable();
+	RayTable(const CameraIntrinsics& intrinsics);
+
+	bool build(const CameraIntrinsics& intrinsics);
+	bool isValid() const;
+
+	/* Rebuilds (x, y, z) from native depth samples. Zero depth (no return)
+	 * becomes the zero point.
+	 */
+	bool reconstruct(const uint16_t* depth, PointXYZ<Real>* points, std::size_t count) const;
+
+	/* Recovers native depth from the z component (rounded, saturated). For
+	 * clouds rebuilt by reconstruct() this is the exact inverse.
+	 */
+	bool project(const PointXYZ<Real>* points, uint16_t* depth, std::size_t count) const;
+
+	/* True when every point lies within half a pixel of its pixel's ray
+	 * (x = ray_x * z, y = ray_y * z), i.e. reconstruct() rebuilds x and y
+	 * from the projected depth. Clouds from another camera model (e.g. SDK
+	 * clouds corrected for lens distortion) do not match. Used for clouds
+	 * recorded without native depth.
+	 */
+	bool matches(const PointXYZ<Real>* points, std::size_t count) const;
+
+	/* Planar variants: x, y and z are separate planes of count values. */
+	bool reconstruct(const uint16_t* depth, Real* x, Real* y, Real* z, std::size_t count) const;
+	bool project(const Real* z, uint16_t* depth, std::size_t count) const;
+
+	std::size_t width() const;
+	std::size_t height() const;
+	std::size_t size() const;
+	const CameraIntrinsics& getIntrinsics() const;
+	const Real* constRayX() const;
+	const Real* constRayY() const;
+
+protected:
+	CameraIntrinsics intrinsics;
+	std::vector<Real> ray_x;
+	std::vector<Real> ray_y;
+};
+
+}
+
+#endif
@@ -0,0 +1,313 @@
+#include "RecordingEncoder.h"
+#include <sstream>
+#include <cstring>
+#include <algorithm>
+
+namespace px {
+
+typedef std::chrono::duration<double, std::milli> Milliseconds;
+
+EncoderStatistics::EncoderStatistics() {
+	this->submitted = 0;
+	this->written = 0;
+	this->dropped = 0;
+	this->rejected = 0;
+	this->failed = 0;
+	this->backlog = 0;
+	this->peak_backlog = 0;
+	this->mean_encode_ms = 0.0;
+	this->max_encode_ms = 0.0;
+	this->mean_latency_ms = 0.0;
+	this->max_latency_ms = 0.0;
+}
+
+std::string EncoderStatistics::toString() const {
+	std::stringstream stream;
+	stream << "Frames: " << this->written << " written, " << this->submitted << " submitted, " << this->dropped << " dropped, " << this->rejected << " rejected, " << this->failed << " failed" << std::endl;
+	stream << "Backlog: " << this->backlog << " (peak " << this->peak_backlog << ")" << std::endl;
+	stream << "Encode: " << this->mean_encode_ms << " ms mean, " << this->max_encode_ms << " ms max" << std::endl;
+	stream << "Latency: " << this->mean_latency_ms << " ms mean, " << this->max_latency_ms << " ms max" << std::endl;
+	return stream.str();
+}
+
+/* All queues hold at most max_backlog jobs, so pushes never block or drop. */
+RecordingEncoder::RecordingEncoder(std::size_t worker_count, std::size_t max_backlog, FileSyncPolicy policy) :
+	free_jobs(std::max<std::size_t>(max_backlog, 1), QUEUE_BLOCK),
+	pending_jobs(std::max<std::size_t>(max_backlog, 1), QUEUE_BLOCK),
+	encoded_jobs(std::max<std::size_t>(max_backlog, 1), QUEUE_BLOCK),
+	recording(OVERFLOW_DROP, 64 << 20, policy),
+	infrared_out(64 << 20, policy, OVERFLOW_DROP) {
+	this->worker_count = std::max<std::size_t>(worker_count, 1);
+	this->type = SERIALIZE_COMPRESSED;
+	this->next_sequence = 0;
+	this->next_write = 0;
+	this->last_depth_stamp = 0;
+	this->last_infrared_stamp = 0;
+	this->bFirstDepth = true;
+	this->bFirstInfrared = true;
+	this->bOpen = false;
+	this->total_encode_ms = 0.0;
+	this->total_latency_ms = 0.0;
+
+	std::size_t slots = this->free_jobs.capacity();
+	this->reorder.assign(slots, nullptr);
+	for ( std::size_t i = 0; i < slots; i++ ) {
+		this->jobs.push_back(std::unique_ptr<EncoderJob>(new EncoderJob()));
+		this->free_jobs.push(this->jobs.back().get());
+	}
+}
+
+RecordingEncoder::~RecordingEncoder() {
+	this->close();
+}
+
+bool RecordingEncoder::open(const std::string& depth_filename, const std::string& infrared_filename, SerializeType type) {
+	if ( this->bOpen ) this->close();
+
+	if ( this->recording.open(depth_filename, type) == false ) return false;
+
+	if ( infrared_filename.length() != 0 && this->infrared_out.open(infrared_filename) == false ) {
+		std::cerr << "[RecordingEncoder:open] Error: Could not open: " << infrared_filename << std::endl;
+		this->recording.close();
+		return false;
+	}
+
+	this->type = type;
+	this->next_sequence = 0;
+	this->next_write = 0;
+	this->bFirstDepth = true;
+	this->bFirstInfrared = true;
+	std::fill(this->reorder.begin(), this->reorder.end(), nullptr);
+	this->pending_jobs.reopen();
+	this->encoded_jobs.reopen();
+	this->resetStatistics();
+
+	this->bOpen = true;
+	for ( std::size_t i = 0; i < this->worker_count; i++ )
+		this->workers.push_back(std::thread(&RecordingEncoder::encodeLoop, this));
+	this->writer = std::thread(&RecordingEncoder::writeLoop, this);
+	return true;
+}
+
+/* Workers finish the queued frames before they exit, then the writer drains
+ * the reorder buffer, so nothing that was accepted is lost.
+ */
+bool RecordingEncoder::close() {
+	{
+		std::lock_guard<std::mutex> lock(this->submit_mutex);
+		if ( this->bOpen == false ) return false;
+		this->bOpen = false;
+	}
+
+	this->pending_jobs.close();
+	for ( std::size_t i = 0; i < this->workers.size(); i++ )
+		if ( this->workers[i].joinable() ) this->workers[i].join();
+	this->workers.clear();
+
+	this->encoded_jobs.close();
+	if ( this->writer.joinable() ) this->writer.join();
+
+	this->recording.close();
+	if ( this->infrared_out.isOpen() ) this->infrared_out.close();
+	return true;
+}
+
+bool RecordingEncoder::isOpen() const {
+	return this->bOpen;
+}
+
+bool RecordingEncoder::setIntrinsics(const CameraIntrinsics& intrinsics) {
+	if ( this->bOpen ) {
+		std::cerr << "[RecordingEncoder:setIntrinsics] Error: Intrinsics must be set before open()." << std::endl;
+		return false;
+	}
+
+	return this->recording.setIntrinsics(intrinsics);
+}
+
+bool RecordingEncoder::submit(const std::shared_ptr<const DepthCloud>& cloud) {
+	if ( cloud == nullptr ) return false;
+
+	// Depth frames without a ray table are copied and given the recording's one.
+	if ( this->type == SERIALIZE_DEPTH && cloud->getRayTable() == nullptr ) return this->submit(*cloud);
+	return this->enqueue(cloud, nullptr);
+}
+
+bool RecordingEncoder::submit(const std::shared_ptr<const IntensityImage<uint16_t>>& image) {
+	if ( image == nullptr ) return false;
+	return this->enqueue(nullptr, image);
+}
+
+bool RecordingEncoder::submit(const DepthCloud& cloud) {
+	std::shared_ptr<DepthCloud> copy = std::make_shared<DepthCloud>(cloud);
+	if ( this->type == SERIALIZE_DEPTH && copy->getRayTable() == nullptr ) copy->setRayTable(this->recording.getRayTable());
+	return this->enqueue(copy, nullptr);
+}
+
+bool RecordingEncoder::submit(const IntensityImage<uint16_t>& image) {
+	return this->enqueue(nullptr, std::make_shared<IntensityImage<uint16_t>>(image));
+}
+
+bool RecordingEncoder::enqueue(const std::shared_ptr<const DepthCloud>& cloud, const std::shared_ptr<const IntensityImage<uint16_t>>& image) {
+	std::lock_guard<std::mutex> lock(this->submit_mutex);
+	if ( this->bOpen == false ) return false;
+
+	if ( image != nullptr && this->infrared_out.isOpen() == false ) return false;
+
+	bool bDepth = cloud != nullptr;
+	std::size_t timestamp = bDepth ? cloud->getTimestamp() : image->getTimestamp();
+	bool bFirst = bDepth ? this->bFirstDepth : this->bFirstInfrared;
+	std::size_t& last_stamp = bDepth ? this->last_depth_stamp : this->last_infrared_stamp;
+
+	if ( bFirst == false && timestamp < last_stamp ) {
+		std::lock_guard<std::mutex> stats_lock(this->stats_mutex);
+		this->statistics.rejected++;
+		return false;
+	}
+
+	EncoderJob* job = nullptr;
+	if ( this->free_jobs.tryPop(job) == false ) {
+		std::lock_guard<std::mutex> stats_lock(this->stats_mutex);
+		this->statistics.dropped++;
+		return false;
+	}
+
+	last_stamp = timestamp;
+	if ( bDepth ) this->bFirstDepth = false;
+	else this->bFirstInfrared = false;
+
+	job->cloud = cloud;
+	job->image = image;
+	job->sequence = this->next_sequence++;
+	job->submit_time = std::chrono::steady_clock::now();
+	job->encode_ms = 0.0;
+	job->bEncoded = false;
+
+	{
+		std::lock_guard<std::mutex> stats_lock(this->stats_mutex);
+		this->statistics.submitted++;
+		this->statistics.backlog++;
+		this->statistics.peak_backlog = std::max(this->statistics.peak_backlog, this->statistics.backlog);
+	}
+
+	this->pending_jobs.push(job);
+	return true;
+}
+
+void RecordingEncoder::encodeLoop() {
+	EncoderJob* job = nullptr;
+
+	while ( this->pending_jobs.pop(job) ) {
+		auto start = std::chrono::steady_clock::now();
+		job->bEncoded = this->encode(*job);
+		job->encode_ms = Milliseconds(std::chrono::steady_clock::now() - start).count();
+		this->encoded_jobs.push(job);
+	}
+}
+
+/* Infrared frames use the DataFrame::serialize layout (w, h, stamp, data). */
+bool RecordingEncoder::encode(EncoderJob& job) const {
+	if ( job.cloud != nullptr ) return job.cloud->encode(job.encoded, this->type);
+	if ( job.image == nullptr ) return false;
+
+	const IntensityImage<uint16_t>& image = *job.image;
+	std::size_t n = image.width() * image.height();
+	job.encoded.resize(RECORDING_FRAME_HEADER_SIZE + n * sizeof(uint16_t));
+
+	uint32_t dims[2] = { static_cast<uint32_t>(image.width()), static_cast<uint32_t>(image.height()) };
+	uint64_t timestamp = static_cast<uint64_t>(image.getTimestamp());
+	std::memcpy(job.encoded.data(), dims, sizeof(dims));
+	std::memcpy(job.encoded.data() + sizeof(dims), &timestamp, sizeof(uint64_t));
+	if ( n != 0 ) std::memcpy(job.encoded.data() + RECORDING_FRAME_HEADER_SIZE, image.getData(), n * sizeof(uint16_t));
+	return true;
+}
+
+/* Encoded frames arrive in any order; each is parked in the reorder buffer
+ * (at most max_backlog frames are in flight, so sequence numbers modulo the
+ * buffer size never collide) and written once all earlier frames are.
+ */
+void RecordingEncoder::writeLoop() {
+	EncoderJob* job = nullptr;
+	std::size_t slots = this->reorder.size();
+
+	while ( this->encoded_jobs.pop(job) ) {
+		this->reorder[job->sequence % slots] = job;
+
+		while ( true ) {
+			EncoderJob*& next = this->reorder[this->next_write % slots];
+			if ( next == nullptr || next->sequence != this->next_write ) break;
+
+			this->finish(next);
+			next = nullptr;
+			this->next_write++;
+		}
+	}
+}
+
+bool RecordingEncoder::write(EncoderJob& job) {
+	if ( job.bEncoded == false ) return false;
+	if ( job.cloud != nullptr ) return this->recording.write(*job.cloud, job.encoded.data(), job.encoded.size());
+	return this->infrared_out.writeFrame(job.encoded.data(), job.encoded.size());
+}
+
+/* Frames dropped by a full write buffer count as dropped, not failed. */
+bool RecordingEncoder::finish(EncoderJob* job) {
+	std::size_t drops = this->recording.getDroppedFrames() + this->infrared_out.getDroppedFrames();
+	bool bWritten = this->write(*job);
+	bool bDropped = bWritten == false && this->recording.getDroppedFrames() + this->infrared_out.getDroppedFrames() != drops;
+	double latency_ms = Milliseconds(std::chrono::steady_clock::now() - job->submit_time).count();
+
+	{
+		std::lock_guard<std::mutex> lock(this->stats_mutex);
+		if ( bWritten ) {
+			this->statistics.written++;
+			this->total_encode_ms += job->encode_ms;
+			this->total_latency_ms += latency_ms;
+			this->statistics.max_encode_ms = std::max(this->statistics.max_encode_ms, job->encode_ms);
+			this->statistics.max_latency_ms = std::max(this->statistics.max_latency_ms, latency_ms);
+			this->statistics.mean_encode_ms = this->total_encode_ms / double(this->statistics.written);
+			this->statistics.mean_latency_ms = this->total_latency_ms / double(this->statistics.written);
+		}
+		else if ( bDropped ) this->statistics.dropped++;
+		else this->statistics.failed++;
+		this->statistics.backlog--;
+	}
+
+	if ( bWritten == false && bDropped == false ) std::cerr << "[RecordingEncoder:write] Error: Could not write frame " << job->sequence << std::endl;
+
+	job->cloud = nullptr;
+	job->image = nullptr;
+	return this->free_jobs.push(job);
+}
+
+std::size_t RecordingEncoder::getBacklog() const {
+	std::lock_guard<std::mutex> lock(this->stats_mutex);
+	return this->statistics.backlog;
+}
+
+std::size_t RecordingEncoder::getWorkerCount() const {
+	return this->worker_count;
+}
+
+std::size_t RecordingEncoder::getMaxBacklog() const {
+	return this->reorder.size();
+}
+
+EncoderStatistics RecordingEncoder::getStatistics() const {
+	std::lock_guard<std::mutex> lock(this->stats_mutex);
+	return this->statistics;
+}
+
+/* Clears the counters; the current backlog is kept. */
+bool RecordingEncoder::resetStatistics() {
+	std::lock_guard<std::mutex> lock(this->stats_mutex);
+	std::size_t backlog = this->statistics.backlog;
+	this->statistics = EncoderStatistics();
+	this->statistics.backlog = backlog;
+	this->statistics.peak_backlog = backlog;
+	this->total_encode_ms = 0.0;
+	this->total_latency_ms = 0.0;
+	return true;
+}
+
+}
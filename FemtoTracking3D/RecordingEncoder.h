@@ -0,0 +1,135 @@
+#ifndef PX_RECORDING_ENCODER_H
+#define PX_RECORDING_ENCODER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include "BoundedQueue.h"
+#include "RecordingWriter.h"
+#include "IntensityImage.h"
+
+namespace px {
+
+/* Counters of a RecordingEncoder. Encode time is the time a worker spent
+ * compressing a frame, latency is the time from submit() until the frame
+ * was written. The backlog is the number of frames submitted but not yet
+ * written.
+ */
+struct EncoderStatistics {
+	std::size_t submitted;
+	std::size_t written;
+	std::size_t dropped;
+	std::size_t rejected;
+	std::size_t failed;
+	std::size_t backlog;
+	std::size_t peak_backlog;
+	double mean_encode_ms;
+	double max_encode_ms;
+	double mean_latency_ms;
+	double max_latency_ms;
+
+	EncoderStatistics();
+	std::string toString() const;
+};
+
+/* Recording sink that compresses frames on a pool of worker threads.
+ *
+ * submit() never blocks the capture thread: a frame is handed to the
+ * workers when one of the max_backlog frame slots is free, and dropped (and
+ * counted) otherwise. Frames are encoded out of order but written strictly
+ * in submission order through a reorder buffer; frames whose timestamp is
+ * older than the previous frame of the same stream are rejected, so each
+ * output file is in timestamp order.
+ *
+ * Depth frames go to an indexed recording (RecordingWriter, not delta
+ * coded), infrared frames to a file of DataFrame::serialize frames (as read
+ * by ReplayCamera). Both files are written by AsyncFileWriter flush threads
+ * with OVERFLOW_DROP, so a stalling disk does not hold up the encoder
+ * either: frames that do not fit the write buffer are dropped and counted.
+ */
+class RecordingEncoder {
+public:
+	RecordingEncoder(std::size_t worker_count = 2, std::size_t max_backlog = 8, FileSyncPolicy policy = SYNC_NONE);
+	~RecordingEncoder();
+
+	bool open(const std::string& depth_filename, const std::string& infrared_filename = "", SerializeType type = SERIALIZE_COMPRESSED);
+
+	/* Waits until every submitted frame is written, then closes the files. */
+	bool close();
+	bool isOpen() const;
+
+	/* Sensor intrinsics for SERIALIZE_DEPTH recordings, set before open(). */
+	bool setIntrinsics(const CameraIntrinsics& intrinsics);
+
+	/* Shared frames are encoded in place (no copy); the producer must not
+	 * modify them afterwards (the cameras allocate a new frame while the
+	 * previous one is still referenced). The other overloads copy the frame.
+	 */
+	bool submit(const std::shared_ptr<const DepthCloud>& cloud);
+	bool submit(const std::shared_ptr<const IntensityImage<uint16_t>>& image);
+	bool submit(const DepthCloud& cloud);
+	bool submit(const IntensityImage<uint16_t>& image);
+
+	std::size_t getBacklog() const;
+	std::size_t getWorkerCount() const;
+	std::size_t getMaxBacklog() const;
+	EncoderStatistics getStatistics() const;
+	bool resetStatistics();
+
+protected:
+	RecordingEncoder(const RecordingEncoder&) = delete;
+	RecordingEncoder& operator = (const RecordingEncoder&) = delete;
+
+	struct EncoderJob {
+		std::shared_ptr<const DepthCloud> cloud;
+		std::shared_ptr<const IntensityImage<uint16_t>> image;
+		std::vector<uint8_t> encoded;
+		uint64_t sequence;
+		std::chrono::steady_clock::time_point submit_time;
+		double encode_ms;
+		bool bEncoded;
+	};
+
+	bool enqueue(const std::shared_ptr<const DepthCloud>& cloud, const std::shared_ptr<const IntensityImage<uint16_t>>& image);
+	void encodeLoop();
+	void writeLoop();
+	bool encode(EncoderJob& job) const;
+	bool write(EncoderJob& job);
+	bool finish(EncoderJob* job);
+
+	std::vector<std::unique_ptr<EncoderJob>> jobs;
+	std::vector<EncoderJob*> reorder;
+	BoundedQueue<EncoderJob*> free_jobs;
+	BoundedQueue<EncoderJob*> pending_jobs;
+	BoundedQueue<EncoderJob*> encoded_jobs;
+
+	std::vector<std::thread> workers;
+	std::thread writer;
+	std::size_t worker_count;
+
+	RecordingWriter recording;
+	AsyncFileWriter infrared_out;
+	SerializeType type;
+
+	std::mutex submit_mutex;
+	uint64_t next_sequence;
+	uint64_t next_write;
+	std::size_t last_depth_stamp;
+	std::size_t last_infrared_stamp;
+	bool bFirstDepth;
+	bool bFirstInfrared;
+	std::atomic<bool> bOpen;
+
+	mutable std::mutex stats_mutex;
+	EncoderStatistics statistics;
+	double total_encode_ms;
+	double total_latency_ms;
+};
+
+}
+
+#endif
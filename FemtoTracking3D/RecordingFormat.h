@@ -0,0 +1,162 @@
+#ifndef PX_RECORDING_FORMAT_H
+#define PX_RECORDING_FORMAT_H
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "Mathematics.h"
+#include "Serializable.h"
+#include "RayTable.h"
+#include "Crc32c.h"
+
+namespace px {
+
+/* Indexed DepthCloud recording container.
+ *
+ * Layout (little endian):
+ *   RecordingHeader   magic, version, serialize type, dimensions, compression bounds,
+ *                     camera intrinsics (version 2), frame codec (version 3),
+ *                     framing (version 4)
+ *   frame 0..n-1      DepthCloud::serialize payloads (unchanged frame format),
+ *                     or delta frames (RECORDING_CODEC_DELTA, see DeltaCodec.h);
+ *                     each wrapped in a checksummed chunk (RECORDING_FRAMING_CHUNKED)
+ *   index             n x RecordingIndexEntry (offset, timestamp)
+ *   RecordingFooter   index offset, frame count, footer magic
+ *
+ * The index is written when the recording is closed. A recording without a
+ * valid footer (e.g. the writer was interrupted) and legacy headerless files
+ * (a bare sequence of DepthCloud::serialize frames) are indexed by scanning
+ * the frame headers when opened. The index offsets point at the chunk
+ * headers of chunked recordings.
+ */
+const static uint32_t RECORDING_MAGIC = 0x43525850;        // "PXRC"
+const static uint32_t RECORDING_INDEX_MAGIC = 0x49525850;  // "PXRI"
+const static uint32_t RECORDING_VERSION = 4;
+const static uint32_t RECORDING_CHUNK_MAGIC = 0x4B435850;  // "PXCK"
+
+/* RECORDING_CODEC_DELTA stores every keyframe_interval-th frame as a keyframe
+ * and the frames in between as residuals against their predecessor.
+ */
+enum RecordingCodec {
+	RECORDING_CODEC_NONE = 0,
+	RECORDING_CODEC_DELTA = 1
+};
+
+/* RECORDING_FRAMING_CHUNKED wraps every frame in a chunk:
+ *   magic, tag, payload length, CRC-32C of (tag, length, payload)
+ * so damaged or truncated frames are detected before they are decoded and
+ * a scan can hop from chunk to chunk without decoding payloads.
+ */
+enum RecordingFraming {
+	RECORDING_FRAMING_NONE = 0,
+	RECORDING_FRAMING_CHUNKED = 1
+};
+
+/* Chunks with unknown tags are skipped by readers. */
+enum RecordingChunkTag {
+	CHUNK_FRAME = 1
+};
+
+struct RecordingChunkHeader {
+	uint32_t magic;
+	uint32_t tag;
+	uint32_t length;
+	uint32_t crc;
+
+	/* Reads the header fields from 16 bytes of memory. */
+	bool parse(const uint8_t* data);
+	bool isValid() const;
+};
+
+const static std::size_t RECORDING_CHUNK_HEADER_SIZE = 4 * sizeof(uint32_t);
+
+inline uint32_t RecordingChunkChecksum(uint32_t tag, uint32_t length, const uint8_t* payload) {
+	uint32_t fields[2] = { tag, length };
+	return Crc32c(payload, length, Crc32c(fields, sizeof(fields)));
+}
+
+inline bool RecordingChunkHeader::parse(const uint8_t* data) {
+	std::memcpy(&this->magic, data, sizeof(uint32_t));
+	std::memcpy(&this->tag, data + sizeof(uint32_t), sizeof(uint32_t));
+	std::memcpy(&this->length, data + 2 * sizeof(uint32_t), sizeof(uint32_t));
+	std::memcpy(&this->crc, data + 3 * sizeof(uint32_t), sizeof(uint32_t));
+	return this->isValid();
+}
+
+inline bool RecordingChunkHeader::isValid() const {
+	return this->magic == RECORDING_CHUNK_MAGIC;
+}
+
+/* Returns the payload of the chunk stored in the given bytes (and its
+ * length), or nullptr if the chunk is damaged or incomplete.
+ */
+inline const uint8_t* RecordingChunkPayload(const uint8_t* chunk, std::size_t size, std::size_t& length, bool bVerify = true) {
+	length = 0;
+	RecordingChunkHeader header;
+	if ( chunk == nullptr || size < RECORDING_CHUNK_HEADER_SIZE ) return nullptr;
+	if ( header.parse(chunk) == false ) return nullptr;
+	if ( RECORDING_CHUNK_HEADER_SIZE + std::size_t(header.length) > size ) return nullptr;
+
+	const uint8_t* payload = chunk + RECORDING_CHUNK_HEADER_SIZE;
+	if ( bVerify && RecordingChunkChecksum(header.tag, header.length, payload) != header.crc ) return nullptr;
+	length = header.length;
+	return payload;
+}
+
+/* Size of the per-frame header written by DepthCloud::serialize (w, h, stamp). */
+const static std::size_t RECORDING_FRAME_HEADER_SIZE = 2 * sizeof(uint32_t) + sizeof(uint64_t);
+
+struct RecordingHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t serialize_type;
+	uint32_t width;
+	uint32_t height;
+	float min_distance;
+	float max_distance;
+	float min_range;
+	float max_range;
+	CameraIntrinsics intrinsics;
+	uint32_t codec;
+	uint32_t keyframe_interval;
+	uint32_t framing;
+};
+
+struct RecordingIndexEntry {
+	uint64_t offset;
+	uint64_t timestamp;
+};
+
+struct RecordingFooter {
+	uint64_t index_offset;
+	uint64_t frame_count;
+	uint32_t magic;
+};
+
+/* Version 1 headers end after the compression bounds. Version 2 adds the
+ * intrinsics (fx, fy, cx, cy, depth scale; the size is the header size),
+ * version 3 the frame codec and keyframe interval, version 4 the framing.
+ */
+const static std::size_t RECORDING_HEADER_SIZE_V1 = 5 * sizeof(uint32_t) + 4 * sizeof(float);
+const static std::size_t RECORDING_HEADER_SIZE_V2 = RECORDING_HEADER_SIZE_V1 + 5 * sizeof(float);
+const static std::size_t RECORDING_HEADER_SIZE_V3 = RECORDING_HEADER_SIZE_V2 + 2 * sizeof(uint32_t);
+const static std::size_t RECORDING_HEADER_SIZE = RECORDING_HEADER_SIZE_V3 + sizeof(uint32_t);
+
+inline std::size_t RecordingHeaderSize(uint32_t version) {
+	if ( version < 2 ) return RECORDING_HEADER_SIZE_V1;
+	if ( version < 3 ) return RECORDING_HEADER_SIZE_V2;
+	if ( version < 4 ) return RECORDING_HEADER_SIZE_V3;
+	return RECORDING_HEADER_SIZE;
+}
+
+/* Frames larger than this are treated as corrupt (guards the allocation
+ * made from a damaged width / height).
+ */
+const static uint64_t RECORDING_MAX_FRAME_POINTS = uint64_t(16384) * 16384;
+
+const static std::size_t RECORDING_INDEX_ENTRY_SIZE = 2 * sizeof(uint64_t);
+const static std::size_t RECORDING_FOOTER_SIZE = 2 * sizeof(uint64_t) + sizeof(uint32_t);
+
+}
+
+#endif
@@ -0,0 +1,489 @@
+#include "RecordingReader.h"
+#include <algorithm>
+
+namespace px {
+
+inline bool IndexEntryLess(const RecordingIndexEntry& entry, uint64_t timestamp) {
+	return entry.timestamp < timestamp;
+}
+
+RecordingReader::RecordingReader() {
+	this->header = RecordingHeader();
+	this->rays = nullptr;
+	this->header_size = 0;
+	this->frames_end = 0;
+	this->position = 0;
+	this->bLegacy = false;
+	this->bIndexed = false;
+	this->bSorted = true;
+}
+
+RecordingReader::~RecordingReader() {
+	if ( this->in.isOpen() ) this->in.close();
+}
+
+bool RecordingReader::open(const std::string& filename, SerializeType legacy_type) {
+	if ( this->in.isOpen() ) this->in.close();
+
+	if ( this->in.open(filename) == false ) {
+		std::cerr << "[RecordingReader:open] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	this->filename = filename;
+	this->header = RecordingHeader();
+	this->index.clear();
+	this->rays = nullptr;
+	this->header_size = 0;
+	this->frames_end = 0;
+	this->position = 0;
+	this->bLegacy = false;
+	this->bIndexed = false;
+	this->bSorted = true;
+
+	uint64_t file_size = this->in.size();
+
+	if ( this->readHeader() == false ) {
+		this->bLegacy = true;
+		this->header.serialize_type = static_cast<uint32_t>(legacy_type);
+		this->scanFrames(0, file_size);
+	}
+	else if ( this->readIndex(file_size) == false ) {
+		std::cerr << "[RecordingReader:open] Warning: Missing frame index, scanning: " << filename << std::endl;
+		this->scanFrames(this->header_size, file_size);
+	}
+	else this->bIndexed = true;
+
+	if ( this->getSerializeType() == SERIALIZE_DEPTH ) {
+		std::shared_ptr<RayTable> table = std::make_shared<RayTable>();
+		if ( table->build(this->header.intrinsics) == false ) {
+			std::cerr << "[RecordingReader:open] Error: Depth recording without valid intrinsics: " << filename << std::endl;
+			this->close();
+			return false;
+		}
+
+		this->rays = table;
+	}
+
+	if ( this->isDeltaCoded() && this->decoder.configure(this->getSerializeType(), this->header.keyframe_interval) == false ) {
+		std::cerr << "[RecordingReader:open] Error: Invalid delta coding (type " << this->header.serialize_type << ", keyframe interval " << this->header.keyframe_interval << "): " << filename << std::endl;
+		this->close();
+		return false;
+	}
+
+	for ( std::size_t i = 1; i < this->index.size(); i++ ) {
+		if ( this->index[i].timestamp < this->index[i - 1].timestamp ) {
+			this->bSorted = false;
+			break;
+		}
+	}
+
+	return this->seekFrame(0) || this->index.size() == 0;
+}
+
+bool RecordingReader::readHeader() {
+	if ( this->in.size() < RECORDING_HEADER_SIZE_V1 ) return false;
+
+	this->in.seek(0);
+	this->header.magic = this->in.readUInt32();
+	if ( this->header.magic != RECORDING_MAGIC ) return false;
+
+	this->header.version = this->in.readUInt32();
+	this->header.serialize_type = this->in.readUInt32();
+	this->header.width = this->in.readUInt32();
+	this->header.height = this->in.readUInt32();
+	this->header.min_distance = this->in.readFloat();
+	this->header.max_distance = this->in.readFloat();
+	this->header.min_range = this->in.readFloat();
+	this->header.max_range = this->in.readFloat();
+	this->header_size = RecordingHeaderSize(this->header.version);
+
+	if ( this->header.version >= 2 ) {
+		this->header.intrinsics.width = this->header.width;
+		this->header.intrinsics.height = this->header.height;
+		this->header.intrinsics.fx = this->in.readFloat();
+		this->header.intrinsics.fy = this->in.readFloat();
+		this->header.intrinsics.cx = this->in.readFloat();
+		this->header.intrinsics.cy = this->in.readFloat();
+		this->header.intrinsics.depth_scale = this->in.readFloat();
+	}
+
+	if ( this->header.version >= 3 ) {
+		this->header.codec = this->in.readUInt32();
+		this->header.keyframe_interval = this->in.readUInt32();
+	}
+
+	if ( this->header.version >= 4 ) this->header.framing = this->in.readUInt32();
+
+	if ( this->header.version > RECORDING_VERSION ) {
+		std::cerr << "[RecordingReader:readHeader] Warning: Recording version " << this->header.version << " is newer than " << RECORDING_VERSION << std::endl;
+	}
+
+	return true;
+}
+
+bool RecordingReader::readIndex(uint64_t file_size) {
+	if ( file_size < this->header_size + RECORDING_FOOTER_SIZE ) return false;
+
+	RecordingFooter footer;
+	this->in.seek(file_size - RECORDING_FOOTER_SIZE);
+	footer.index_offset = this->in.readUInt64();
+	footer.frame_count = this->in.readUInt64();
+	footer.magic = this->in.readUInt32();
+
+	if ( footer.magic != RECORDING_INDEX_MAGIC ) return false;
+	if ( footer.index_offset < this->header_size ) return false;
+
+	// Checked by division first: a corrupt count must not overflow the size.
+	if ( footer.index_offset > file_size - RECORDING_FOOTER_SIZE ) return false;
+	if ( footer.frame_count > (file_size - RECORDING_FOOTER_SIZE - footer.index_offset) / RECORDING_INDEX_ENTRY_SIZE ) return false;
+	if ( footer.index_offset + footer.frame_count * RECORDING_INDEX_ENTRY_SIZE + RECORDING_FOOTER_SIZE != file_size ) return false;
+
+	this->index.resize(static_cast<std::size_t>(footer.frame_count));
+	this->in.seek(footer.index_offset);
+
+	for ( std::size_t i = 0; i < this->index.size(); i++ ) {
+		this->index[i].offset = this->in.readUInt64();
+		this->index[i].timestamp = this->in.readUInt64();
+	}
+
+	this->frames_end = footer.index_offset;
+	return true;
+}
+
+/* Builds the index by reading only the frame headers; frame sizes follow
+ * from the dimensions and the serialize type (or the payload length of
+ * delta frames). A truncated last frame is ignored. Frames whose size does
+ * not match the recording end the scan: what follows cannot be trusted.
+ */
+bool RecordingReader::scanFrames(uint64_t start, uint64_t end) {
+	if ( this->isChunked() ) return this->scanChunks(start, end);
+
+	SerializeType type = static_cast<SerializeType>(this->header.serialize_type);
+	uint64_t offset = start;
+
+	while ( offset + RECORDING_FRAME_HEADER_SIZE <= end ) {
+		this->in.seek(offset);
+		uint32_t width = this->in.readUInt32();
+		uint32_t height = this->in.readUInt32();
+		uint64_t timestamp = this->in.readUInt64();
+		if ( this->isValidFrameSize(width, height) == false ) {
+			std::cerr << "[RecordingReader:scanFrames] Warning: Invalid frame size " << width << "x" << height << " at frame " << this->index.size() << " in: " << this->filename << std::endl;
+			break;
+		}
+
+		uint64_t frame_size = DepthCloud::SerializedSize(width, height, type);
+		if ( this->isDeltaCoded() ) {
+			if ( offset + DELTA_FRAME_PREFIX_SIZE > end ) break;
+			this->in.seek(offset + DELTA_FRAME_PREFIX_SIZE - sizeof(uint32_t));
+			frame_size = DELTA_FRAME_PREFIX_SIZE + uint64_t(this->in.readUInt32());
+		}
+
+		if ( offset + frame_size > end ) {
+			std::cerr << "[RecordingReader:scanFrames] Warning: Truncated frame " << this->index.size() << " in: " << this->filename << std::endl;
+			break;
+		}
+
+		if ( this->index.size() == 0 && this->bLegacy ) {
+			this->header.width = width;
+			this->header.height = height;
+		}
+
+		RecordingIndexEntry entry;
+		entry.offset = offset;
+		entry.timestamp = timestamp;
+		this->index.push_back(entry);
+		offset += frame_size;
+	}
+
+	this->frames_end = offset;
+	return true;
+}
+
+/* Hops from chunk header to chunk header (payloads are not read or
+ * verified, see RecordingScanner for that). Chunks with other tags are
+ * skipped.
+ */
+bool RecordingReader::scanChunks(uint64_t start, uint64_t end) {
+	uint64_t offset = start;
+	uint8_t bytes[RECORDING_CHUNK_HEADER_SIZE + RECORDING_FRAME_HEADER_SIZE];
+
+	while ( offset + RECORDING_CHUNK_HEADER_SIZE <= end ) {
+		this->in.seek(offset);
+		this->in.readBuffer(bytes, sizeof(bytes));
+
+		RecordingChunkHeader chunk;
+		if ( chunk.parse(bytes) == false ) {
+			std::cerr << "[RecordingReader:scanFrames] Warning: Damaged chunk at offset " << offset << " in: " << this->filename << std::endl;
+			break;
+		}
+
+		uint64_t chunk_size = RECORDING_CHUNK_HEADER_SIZE + uint64_t(chunk.length);
+		if ( offset + chunk_size > end ) {
+			std::cerr << "[RecordingReader:scanFrames] Warning: Truncated frame " << this->index.size() << " in: " << this->filename << std::endl;
+			break;
+		}
+
+		if ( chunk.tag == CHUNK_FRAME ) {
+			uint32_t width, height;
+			uint64_t timestamp;
+			std::memcpy(&width, bytes + RECORDING_CHUNK_HEADER_SIZE, sizeof(uint32_t));
+			std::memcpy(&height, bytes + RECORDING_CHUNK_HEADER_SIZE + sizeof(uint32_t), sizeof(uint32_t));
+			std::memcpy(&timestamp, bytes + RECORDING_CHUNK_HEADER_SIZE + 2 * sizeof(uint32_t), sizeof(uint64_t));
+
+			if ( chunk.length < RECORDING_FRAME_HEADER_SIZE || this->isValidFrameSize(width, height) == false ) {
+				std::cerr << "[RecordingReader:scanFrames] Warning: Invalid frame " << this->index.size() << " in: " << this->filename << std::endl;
+				break;
+			}
+
+			RecordingIndexEntry entry;
+			entry.offset = offset;
+			entry.timestamp = timestamp;
+			this->index.push_back(entry);
+		}
+
+		offset += chunk_size;
+	}
+
+	this->frames_end = offset;
+	return true;
+}
+
+/* Indexed recordings have fixed dimensions; legacy files only get a sanity
+ * limit (the dimensions of their first frame are adopted).
+ */
+bool RecordingReader::isValidFrameSize(uint32_t width, uint32_t height) const {
+	if ( width == 0 || height == 0 ) return false;
+	if ( uint64_t(width) * uint64_t(height) > RECORDING_MAX_FRAME_POINTS ) return false;
+	if ( this->bLegacy == false && (width != this->header.width || height != this->header.height) ) return false;
+	return true;
+}
+
+bool RecordingReader::close() {
+	if ( this->in.isOpen() == false ) return false;
+	this->index.clear();
+	this->position = 0;
+	this->decoder.reset();
+	return this->in.close();
+}
+
+bool RecordingReader::isOpen() const {
+	return this->in.isOpen();
+}
+
+bool RecordingReader::read(DepthCloud& cloud) {
+	if ( this->hasNext() == false ) return false;
+
+	if ( this->rays != nullptr ) cloud.setRayTable(this->rays);
+
+	if ( this->isChunked() && this->isDeltaCoded() == false ) {
+		std::size_t length = 0;
+		const uint8_t* frame_data = this->readFrameData(this->position, length);
+		if ( frame_data == nullptr ) return false;
+		if ( cloud.decode(frame_data, length, this->getSerializeType()) == false ) return false;
+		this->position++;
+		return true;
+	}
+
+	if ( this->isDeltaCoded() ) {
+		DeltaFrameDecoder::FrameSource source = [this](std::size_t frame, std::size_t& length) { return this->readFrameData(frame, length); };
+		if ( this->decoder.decode(this->position, source, cloud) == false ) return false;
+		this->position++;
+		return true;
+	}
+
+	if ( cloud.deserialize(this->in, this->getSerializeType()) == false ) return false;
+	if ( this->in.getStream().fail() ) {
+		std::cerr << "[RecordingReader:read] Error: Could not read frame " << this->position << " in: " << this->filename << std::endl;
+		return false;
+	}
+
+	this->position++;
+	return true;
+}
+
+/* Reads the bytes of a frame into the frame buffer; for chunked recordings
+ * the checksum is verified and the payload returned.
+ */
+const uint8_t* RecordingReader::readFrameData(std::size_t frame, std::size_t& length) {
+	length = 0;
+	uint64_t frame_size = this->getFrameSize(frame);
+	if ( frame_size == 0 || this->in.seek(this->index[frame].offset) == false ) return nullptr;
+
+	this->frame_buffer.resize(static_cast<std::size_t>(frame_size));
+	this->in.readBuffer(this->frame_buffer.data(), this->frame_buffer.size());
+	if ( this->in.getStream().fail() ) {
+		std::cerr << "[RecordingReader:read] Error: Could not read frame " << frame << " in: " << this->filename << std::endl;
+		return nullptr;
+	}
+
+	length = this->frame_buffer.size();
+	if ( this->isChunked() == false ) return this->frame_buffer.data();
+
+	const uint8_t* payload = RecordingChunkPayload(this->frame_buffer.data(), this->frame_buffer.size(), length);
+	if ( payload == nullptr ) std::cerr << "[RecordingReader:read] Error: Checksum mismatch in frame " << frame << " of: " << this->filename << std::endl;
+	return payload;
+}
+
+bool RecordingReader::readFrameData(std::size_t frame, std::vector<uint8_t>& frame_data) {
+	frame_data.clear();
+	if ( this->isDeltaCoded() ) {
+		std::cerr << "[RecordingReader:readFrameData] Error: Delta coded frames must be decoded with read()." << std::endl;
+		return false;
+	}
+
+	std::size_t length = 0;
+	const uint8_t* data = this->readFrameData(frame, length);
+	if ( data != nullptr ) frame_data.assign(data, data + length);
+
+	// The read position (next frame of read()) is left unchanged.
+	if ( this->position < this->index.size() ) this->in.seek(this->index[this->position].offset);
+	return data != nullptr;
+}
+
+bool RecordingReader::read(std::size_t frame, DepthCloud& cloud) {
+	if ( this->seekFrame(frame) == false ) return false;
+	return this->read(cloud);
+}
+
+bool RecordingReader::hasNext() const {
+	if ( this->in.isOpen() == false ) return false;
+	return this->position < this->index.size();
+}
+
+bool RecordingReader::seekFrame(std::size_t frame) {
+	if ( frame >= this->index.size() ) {
+		this->position = this->index.size();
+		return false;
+	}
+
+	if ( this->in.seek(this->index[frame].offset) == false ) return false;
+	this->position = frame;
+	return true;
+}
+
+bool RecordingReader::seekTimestamp(uint64_t timestamp) {
+	return this->seekFrame(this->findFrame(timestamp));
+}
+
+/* Returns the first frame with a timestamp >= timestamp, or the frame count
+ * if there is none. Recordings with non-monotonic timestamps (e.g. files
+ * that were concatenated) fall back to a linear search.
+ */
+std::size_t RecordingReader::findFrame(uint64_t timestamp) const {
+	return FindFrame(this->index, timestamp, this->bSorted);
+}
+
+std::size_t RecordingReader::FindFrame(const std::vector<RecordingIndexEntry>& index, uint64_t timestamp, bool bSorted) {
+	if ( bSorted ) {
+		auto it = std::lower_bound(index.begin(), index.end(), timestamp, IndexEntryLess);
+		return static_cast<std::size_t>(it - index.begin());
+	}
+
+	for ( std::size_t i = 0; i < index.size(); i++ )
+		if ( index[i].timestamp >= timestamp ) return i;
+	return index.size();
+}
+
+std::size_t RecordingReader::getFrameIndex() const {
+	return this->position;
+}
+
+std::size_t RecordingReader::getFrameCount() const {
+	return this->index.size();
+}
+
+uint64_t RecordingReader::getTimestamp(std::size_t frame) const {
+	if ( frame >= this->index.size() ) return 0;
+	return this->index[frame].timestamp;
+}
+
+/* Stored size of a frame in bytes, from the index (frames are contiguous). */
+uint64_t RecordingReader::getFrameSize(std::size_t frame) const {
+	if ( frame >= this->index.size() ) return 0;
+	uint64_t end = (frame + 1 < this->index.size()) ? this->index[frame + 1].offset : this->frames_end;
+	if ( end < this->index[frame].offset ) return 0;
+	return end - this->index[frame].offset;
+}
+
+const std::vector<RecordingIndexEntry>& RecordingReader::getIndex() const {
+	return this->index;
+}
+
+bool RecordingReader::isLegacy() const {
+	return this->bLegacy;
+}
+
+bool RecordingReader::isIndexed() const {
+	return this->bIndexed;
+}
+
+bool RecordingReader::isSorted() const {
+	return this->bSorted;
+}
+
+uint32_t RecordingReader::getVersion() const {
+	return this->header.version;
+}
+
+bool RecordingReader::isDeltaCoded() const {
+	return this->header.codec == RECORDING_CODEC_DELTA;
+}
+
+bool RecordingReader::isChunked() const {
+	return this->header.framing == RECORDING_FRAMING_CHUNKED;
+}
+
+std::size_t RecordingReader::getKeyframeInterval() const {
+	return this->header.keyframe_interval;
+}
+
+SerializeType RecordingReader::getSerializeType() const {
+	return static_cast<SerializeType>(this->header.serialize_type);
+}
+
+std::size_t RecordingReader::getWidth() const {
+	return this->header.width;
+}
+
+std::size_t RecordingReader::getHeight() const {
+	return this->header.height;
+}
+
+Real RecordingReader::getMinDistance() const {
+	return this->header.min_distance;
+}
+
+Real RecordingReader::getMaxDistance() const {
+	return this->header.max_distance;
+}
+
+Real RecordingReader::getMinRange() const {
+	return this->header.min_range;
+}
+
+Real RecordingReader::getMaxRange() const {
+	return this->header.max_range;
+}
+
+const RecordingHeader& RecordingReader::getHeader() const {
+	return this->header;
+}
+
+std::size_t RecordingReader::getHeaderSize() const {
+	return this->header_size;
+}
+
+uint64_t RecordingReader::getFramesEnd() const {
+	return this->frames_end;
+}
+
+const CameraIntrinsics& RecordingReader::getIntrinsics() const {
+	return this->header.intrinsics;
+}
+
+const std::shared_ptr<const RayTable>& RecordingReader::getRayTable() const {
+	return this->rays;
+}
+
+}
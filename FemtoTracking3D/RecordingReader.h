@@ -0,0 +1,125 @@
+#ifndef PX_RECORDING_READER_H
+#define PX_RECORDING_READER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "RecordingFormat.h"
+#include "DepthCloud.h"
+#include "DeltaCodec.h"
+
+namespace px {
+
+/* Random access reader for DepthCloud recordings (see RecordingFormat.h).
+ *
+ * Indexed recordings load their frame index from the footer. Recordings
+ * without a footer and legacy headerless files are indexed once on open by
+ * hopping over the frame headers (no frame data is decoded). Seeking by
+ * frame is O(1), seeking by timestamp is O(log n) on the index.
+ *
+ * Delta coded recordings decode a frame from its keyframe on random access;
+ * sequential reads decode every frame once. Chunked recordings verify the
+ * checksum of every frame they read.
+ */
+class RecordingReader {
+public:
+	RecordingReader();
+	~RecordingReader();
+
+	/* The legacy type is the serialize type used to decode headerless files
+	 * (which do not record it). It is ignored for indexed recordings.
+	 */
+	bool open(const std::string& filename, SerializeType legacy_type = SERIALIZE_COMPRESSED);
+	bool close();
+	bool isOpen() const;
+
+	/* Reads the frame at the current position and advances. */
+	bool read(DepthCloud& cloud);
+	bool read(std::size_t frame, DepthCloud& cloud);
+
+	/* Copies the serialized bytes of a frame (as decoded by DepthCloud::decode,
+	 * checksum verified for chunked recordings) without decoding them, so the
+	 * frame can be decoded on another thread. Not available for delta coded
+	 * recordings, whose frames depend on their predecessors.
+	 */
+	bool readFrameData(std::size_t frame, std::vector<uint8_t>& frame_data);
+	bool hasNext() const;
+
+	bool seekFrame(std::size_t frame);
+
+	/* Positions the reader at the first frame with a timestamp >= timestamp.
+	 * Returns false if every frame is older.
+	 */
+	bool seekTimestamp(uint64_t timestamp);
+	std::size_t findFrame(uint64_t timestamp) const;
+
+	/* Timestamp search over any recording index, shared with
+	 * MappedRecordingReader. bSorted selects the binary search (see isSorted).
+	 */
+	static std::size_t FindFrame(const std::vector<RecordingIndexEntry>& index, uint64_t timestamp, bool bSorted);
+
+	std::size_t getFrameIndex() const;
+	std::size_t getFrameCount() const;
+	uint64_t getTimestamp(std::size_t frame) const;
+	uint64_t getFrameSize(std::size_t frame) const;
+	const std::vector<RecordingIndexEntry>& getIndex() const;
+
+	bool isLegacy() const;
+	bool isIndexed() const;
+
+	/* False when the frame timestamps are not monotonic (e.g. concatenated files). */
+	bool isSorted() const;
+	bool isDeltaCoded() const;
+	bool isChunked() const;
+	std::size_t getKeyframeInterval() const;
+	uint32_t getVersion() const;
+	SerializeType getSerializeType() const;
+	std::size_t getWidth() const;
+	std::size_t getHeight() const;
+	Real getMinDistance() const;
+	Real getMaxDistance() const;
+	Real getMinRange() const;
+	Real getMaxRange() const;
+
+	/* Header as stored, its size and the end of the frame data (the index
+	 * offset, or the end of the last complete frame of scanned files).
+	 */
+	const RecordingHeader& getHeader() const;
+	std::size_t getHeaderSize() const;
+	uint64_t getFramesEnd() const;
+
+	/* Sensor intrinsics (version 2 recordings) and, for SERIALIZE_DEPTH
+	 * recordings, the ray table that read() attaches to the clouds.
+	 */
+	const CameraIntrinsics& getIntrinsics() const;
+	const std::shared_ptr<const RayTable>& getRayTable() const;
+
+protected:
+	RecordingReader(const RecordingReader&) = delete;
+	RecordingReader& operator = (const RecordingReader&) = delete;
+
+	bool readHeader();
+	bool readIndex(uint64_t file_size);
+	bool scanFrames(uint64_t start, uint64_t end);
+	bool scanChunks(uint64_t start, uint64_t end);
+	bool isValidFrameSize(uint32_t width, uint32_t height) const;
+	const uint8_t* readFrameData(std::size_t frame, std::size_t& length);
+
+	BinaryFileReader in;
+	std::string filename;
+	RecordingHeader header;
+	std::vector<RecordingIndexEntry> index;
+	std::shared_ptr<const RayTable> rays;
+	DeltaFrameDecoder decoder;
+	std::vector<uint8_t> frame_buffer;
+	std::size_t header_size;
+	uint64_t frames_end;
+	std::size_t position;
+	bool bLegacy;
+	bool bIndexed;
+	bool bSorted;
+};
+
+}
+
+#endif
@@ -0,0 +1,255 @@
+#include "RecordingScanner.h"
+#include "RecordingReader.h"
+#include <sstream>
+#include <chrono>
+#include <algorithm>
+
+namespace px {
+
+/* Resynchronization searches for the chunk magic in windows of this size. */
+const static std::size_t RESYNC_WINDOW_SIZE = 1 << 16;
+
+RecordingScanReport::RecordingScanReport() {
+	this->frames = 0;
+	this->damaged_regions = 0;
+	this->skipped_chunks = 0;
+	this->dropped_frames = 0;
+	this->bytes_scanned = 0;
+	this->bytes_damaged = 0;
+	this->first_error_offset = 0;
+	this->bTruncated = false;
+	this->bIndexed = false;
+	this->bIndexValid = false;
+	this->seconds = 0.0;
+}
+
+bool RecordingScanReport::isClean() const {
+	return this->damaged_regions == 0 && this->bTruncated == false && this->bIndexValid;
+}
+
+std::string RecordingScanReport::toString() const {
+	std::stringstream stream;
+	stream << "Frames: " << this->frames << " intact, " << this->dropped_frames << " dropped, " << this->skipped_chunks << " other chunks" << std::endl;
+	stream << "Damage: " << this->damaged_regions << " regions, " << this->bytes_damaged << " bytes";
+	if ( this->damaged_regions != 0 ) stream << " (first at offset " << this->first_error_offset << ")";
+	if ( this->bTruncated ) stream << ", truncated";
+	stream << std::endl;
+	stream << "Index: " << (this->bIndexed ? (this->bIndexValid ? "valid" : "inconsistent") : "missing") << std::endl;
+	stream << "Scanned: " << this->bytes_scanned << " bytes in " << this->seconds << " s";
+	if ( this->seconds > 0.0 ) stream << " (" << double(this->bytes_scanned) / (this->seconds * 1048576.0) << " MiB/s)";
+	stream << std::endl;
+	return stream.str();
+}
+
+RecordingScanner::RecordingScanner() {}
+
+bool RecordingScanner::scan(const std::string& filename, bool bVerify) {
+	return this->run(filename, bVerify, nullptr);
+}
+
+bool RecordingScanner::salvage(const std::string& filename, const std::string& output_filename) {
+	BufferedFileWriter out;
+	if ( out.open(output_filename) == false ) {
+		std::cerr << "[RecordingScanner:salvage] Error: Could not open: " << output_filename << std::endl;
+		return false;
+	}
+
+	bool bResult = this->run(filename, true, &out);
+	out.close();
+
+	if ( bResult && out.getStatus() != FILE_OK ) {
+		std::cerr << "[RecordingScanner:salvage] Error: " << FileStatusToString(out.getStatus()) << " in: " << output_filename << std::endl;
+		return false;
+	}
+
+	return bResult;
+}
+
+/* Reads the chunk at offset (the full payload with bVerify, else just the
+ * frame header part of it) into the chunk buffer. Fails for chunks that are
+ * damaged or do not end before end.
+ */
+bool RecordingScanner::readChunk(uint64_t offset, uint64_t end, bool bVerify, RecordingChunkHeader& chunk) {
+	chunk = RecordingChunkHeader();
+	if ( offset + RECORDING_CHUNK_HEADER_SIZE > end ) return false;
+
+	uint8_t bytes[RECORDING_CHUNK_HEADER_SIZE];
+	if ( this->in.seek(offset) == false || this->in.readBytes(bytes, sizeof(bytes)) == false ) return false;
+	if ( chunk.parse(bytes) == false ) return false;
+	if ( offset + RECORDING_CHUNK_HEADER_SIZE + uint64_t(chunk.length) > end ) return false;
+	if ( chunk.tag == CHUNK_FRAME && chunk.length < RECORDING_FRAME_HEADER_SIZE ) return false;
+
+	std::size_t length = bVerify ? chunk.length : std::min<std::size_t>(chunk.length, DELTA_FRAME_PREFIX_SIZE);
+	if ( this->chunk_buffer.size() < RECORDING_CHUNK_HEADER_SIZE + length ) this->chunk_buffer.resize(RECORDING_CHUNK_HEADER_SIZE + length);
+
+	uint8_t* payload = this->chunk_buffer.data() + RECORDING_CHUNK_HEADER_SIZE;
+	std::memcpy(this->chunk_buffer.data(), bytes, sizeof(bytes));
+	if ( this->in.readBytes(payload, length) == false ) return false;
+
+	if ( bVerify == false ) return true;
+	return RecordingChunkChecksum(chunk.tag, chunk.length, payload) == chunk.crc;
+}
+
+/* Offset of the next chunk at or after offset that verifies, or end. */
+uint64_t RecordingScanner::resync(uint64_t offset, uint64_t end) {
+	uint8_t magic[sizeof(uint32_t)];
+	std::memcpy(magic, &RECORDING_CHUNK_MAGIC, sizeof(magic));
+	this->window.resize(RESYNC_WINDOW_SIZE);
+
+	while ( offset + RECORDING_CHUNK_HEADER_SIZE <= end ) {
+		std::size_t count = static_cast<std::size_t>(std::min<uint64_t>(this->window.size(), end - offset));
+		if ( this->in.seek(offset) == false || this->in.readBytes(this->window.data(), count) == false ) return end;
+
+		const uint8_t* first = this->window.data();
+		const uint8_t* hit = std::search(first, first + count, magic, magic + sizeof(magic));
+		if ( hit == first + count ) {
+			// A magic may straddle the window boundary.
+			offset += count - (sizeof(magic) - 1);
+			continue;
+		}
+
+		uint64_t candidate = offset + uint64_t(hit - first);
+		RecordingChunkHeader chunk;
+		if ( this->readChunk(candidate, end, true, chunk) ) return candidate;
+		offset = candidate + 1;
+	}
+
+	return end;
+}
+
+/* The header and footer are parsed by RecordingReader; the frame data up to
+ * the index (or the end of unindexed files) is then walked chunk by chunk.
+ * With an output, intact chunks are copied and a new index is written.
+ */
+bool RecordingScanner::run(const std::string& filename, bool bVerify, BufferedFileWriter* out) {
+	auto start_time = std::chrono::steady_clock::now();
+	this->report = RecordingScanReport();
+	this->index.clear();
+
+	RecordingReader reader;
+	if ( reader.open(filename) == false ) return false;
+
+	if ( reader.isChunked() == false ) {
+		std::cerr << "[RecordingScanner:scan] Error: Only chunked recordings can be scanned: " << filename << std::endl;
+		return false;
+	}
+
+	std::size_t header_size = reader.getHeaderSize();
+	bool bDelta = reader.isDeltaCoded();
+	this->report.bIndexed = reader.isIndexed();
+	this->stored_index = reader.getIndex();
+	uint64_t end = reader.getFramesEnd();
+	reader.close();
+
+	if ( this->in.open(filename) == false ) {
+		std::cerr << "[RecordingScanner:scan] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	if ( this->report.bIndexed == false ) end = this->in.size();
+
+	if ( out != nullptr ) {
+		this->chunk_buffer.resize(std::max(this->chunk_buffer.size(), header_size));
+		if ( this->in.readBytes(this->chunk_buffer.data(), header_size) == false ) return false;
+		out->writeBytes(this->chunk_buffer.data(), header_size);
+	}
+
+	uint64_t offset = header_size;
+	bool bIndexMatch = true;
+	bool bChainBroken = false;
+
+	while ( offset < end ) {
+		RecordingChunkHeader chunk;
+
+		if ( this->readChunk(offset, end, bVerify || out != nullptr, chunk) ) {
+			std::size_t chunk_size = RECORDING_CHUNK_HEADER_SIZE + std::size_t(chunk.length);
+			const uint8_t* payload = this->chunk_buffer.data() + RECORDING_CHUNK_HEADER_SIZE;
+
+			if ( chunk.tag != CHUNK_FRAME ) {
+				this->report.skipped_chunks++;
+				if ( out != nullptr ) out->writeBytes(this->chunk_buffer.data(), chunk_size);
+				offset += chunk_size;
+				continue;
+			}
+
+			// Frame payloads start with width, height and timestamp (then the kind of delta frames).
+			uint64_t timestamp = 0;
+			uint32_t kind = DELTA_KEYFRAME;
+			std::memcpy(&timestamp, payload + 2 * sizeof(uint32_t), sizeof(uint64_t));
+			if ( bDelta && chunk.length >= RECORDING_FRAME_HEADER_SIZE + sizeof(uint32_t) ) std::memcpy(&kind, payload + RECORDING_FRAME_HEADER_SIZE, sizeof(uint32_t));
+
+			if ( bChainBroken && kind != DELTA_KEYFRAME ) {
+				this->report.dropped_frames++;
+				bIndexMatch = false;
+				offset += chunk_size;
+				continue;
+			}
+
+			std::size_t frame = this->index.size();
+			if ( frame >= this->stored_index.size() || this->stored_index[frame].offset != offset ) bIndexMatch = false;
+
+			RecordingIndexEntry entry;
+			entry.offset = (out != nullptr) ? out->tell() : offset;
+			entry.timestamp = timestamp;
+			this->index.push_back(entry);
+			if ( out != nullptr ) out->writeBytes(this->chunk_buffer.data(), chunk_size);
+
+			bChainBroken = false;
+			offset += chunk_size;
+			continue;
+		}
+
+		// A last chunk that only lacks its end is a truncated file, not damage.
+		uint64_t next = this->resync(offset + 1, end);
+		bool bCutOff = chunk.isValid() && offset + RECORDING_CHUNK_HEADER_SIZE + uint64_t(chunk.length) > end;
+		if ( next == end && (offset + RECORDING_CHUNK_HEADER_SIZE > end || bCutOff) ) this->report.bTruncated = true;
+		else {
+			if ( this->report.damaged_regions == 0 ) this->report.first_error_offset = offset;
+			this->report.damaged_regions++;
+			bChainBroken = bDelta;
+			bIndexMatch = false;
+		}
+
+		this->report.bytes_damaged += next - offset;
+		offset = next;
+	}
+
+	if ( this->in.getStatus() != FILE_OK ) {
+		std::cerr << "[RecordingScanner:scan] Error: " << FileStatusToString(this->in.getStatus()) << " in: " << filename << std::endl;
+		this->in.close();
+		return false;
+	}
+	this->in.close();
+
+	if ( out != nullptr ) {
+		RecordingFooter footer;
+		footer.index_offset = out->tell();
+		footer.frame_count = static_cast<uint64_t>(this->index.size());
+		footer.magic = RECORDING_INDEX_MAGIC;
+
+		for ( std::size_t i = 0; i < this->index.size(); i++ ) {
+			out->write(this->index[i].offset);
+			out->write(this->index[i].timestamp);
+		}
+
+		out->write(footer.index_offset);
+		out->write(footer.frame_count);
+		out->write(footer.magic);
+	}
+
+	this->report.frames = this->index.size();
+	this->report.bIndexValid = this->report.bIndexed && bIndexMatch && this->index.size() == this->stored_index.size();
+	this->report.bytes_scanned = end;
+	this->report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+	return true;
+}
+
+const RecordingScanReport& RecordingScanner::getReport() const {
+	return this->report;
+}
+
+const std::vector<RecordingIndexEntry>& RecordingScanner::getIndex() const {
+	return this->index;
+}
+
+}
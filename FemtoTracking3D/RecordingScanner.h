@@ -0,0 +1,80 @@
+#ifndef PX_RECORDING_SCANNER_H
+#define PX_RECORDING_SCANNER_H
+
+#include <string>
+#include <vector>
+#include "RecordingFormat.h"
+#include "BufferedFileReader.h"
+#include "BufferedFileWriter.h"
+
+namespace px {
+
+/* Result of a RecordingScanner pass. Damaged regions are counted once each
+ * (from the first bad chunk up to the next chunk that verifies); a last
+ * chunk that runs past the end of the file counts as truncation instead.
+ * Dropped frames are intact delta frames that salvage() left out because
+ * their reference frame was lost.
+ */
+struct RecordingScanReport {
+	std::size_t frames;
+	std::size_t damaged_regions;
+	std::size_t skipped_chunks;
+	std::size_t dropped_frames;
+	uint64_t bytes_scanned;
+	uint64_t bytes_damaged;
+	uint64_t first_error_offset;
+	bool bTruncated;
+	bool bIndexed;
+	bool bIndexValid;
+	double seconds;
+
+	RecordingScanReport();
+	bool isClean() const;
+	std::string toString() const;
+};
+
+/* Integrity check and repair of chunked recordings (see RecordingFormat.h).
+ *
+ * scan() hops from chunk to chunk through large sequential reads; with
+ * bVerify the payload checksums are checked, otherwise only the chunk
+ * headers are read. Payloads are never decoded, so a scan runs at disk
+ * speed. On damage the scanner resynchronizes on the next chunk magic whose
+ * chunk verifies.
+ *
+ * salvage() writes a new recording with the header and every intact frame
+ * of the input and a fresh index. In delta coded recordings the frames
+ * after a damaged region are kept from the next keyframe on.
+ */
+class RecordingScanner {
+public:
+	RecordingScanner();
+
+	bool scan(const std::string& filename, bool bVerify = true);
+	bool salvage(const std::string& filename, const std::string& output_filename);
+
+	const RecordingScanReport& getReport() const;
+
+	/* Intact frames found by the last pass (offsets into the output file
+	 * after salvage()).
+	 */
+	const std::vector<RecordingIndexEntry>& getIndex() const;
+
+protected:
+	RecordingScanner(const RecordingScanner&) = delete;
+	RecordingScanner& operator = (const RecordingScanner&) = delete;
+
+	bool run(const std::string& filename, bool bVerify, BufferedFileWriter* out);
+	bool readChunk(uint64_t offset, uint64_t end, bool bVerify, RecordingChunkHeader& chunk);
+	uint64_t resync(uint64_t offset, uint64_t end);
+
+	BufferedFileReader in;
+	RecordingScanReport report;
+	std::vector<RecordingIndexEntry> index;
+	std::vector<RecordingIndexEntry> stored_index;
+	std::vector<uint8_t> chunk_buffer;
+	std::vector<uint8_t> window;
+};
+
+}
+
+#endif
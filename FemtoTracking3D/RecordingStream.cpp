@@ -0,0 +1,204 @@
+#include "RecordingStream.h"
+
+namespace px {
+
+const static std::chrono::milliseconds STREAM_POLL_MS(50);
+
+RecordingStream::FrameStore::FrameStore(std::size_t count) : free_frames(count, QUEUE_BLOCK) {
+	this->outstanding = 0;
+	for ( std::size_t i = 0; i < count; i++ ) {
+		this->frames.push_back(std::make_unique<DepthCloud>());
+		this->free_frames.push(this->frames.back().get());
+	}
+}
+
+RecordingStream::RecordingStream(std::size_t max_resident, bool bPrefetch) {
+	// Prefetching needs one frame in the consumer's hands and one being decoded.
+	if ( max_resident < 1 ) max_resident = 1;
+	if ( bPrefetch && max_resident < 2 ) max_resident = 2;
+
+	this->store = nullptr;
+	this->ready_frames = nullptr;
+	this->bPrefetching = false;
+	this->max_resident = max_resident;
+	this->frame_index = 0;
+	this->bPrefetch = bPrefetch;
+}
+
+RecordingStream::~RecordingStream() {
+	this->close();
+}
+
+bool RecordingStream::open(const std::string& filename, SerializeType legacy_type) {
+	if ( this->isOpen() ) this->close();
+	if ( this->reader.open(filename, legacy_type) == false ) return false;
+
+	this->store = std::make_shared<FrameStore>(this->max_resident);
+	this->ready_frames = std::make_unique<BoundedQueue<DepthCloud*> >(this->max_resident, QUEUE_BLOCK);
+	this->frame_index = 0;
+
+	if ( this->bPrefetch ) this->startPrefetch();
+	return true;
+}
+
+bool RecordingStream::close() {
+	if ( this->isOpen() == false ) return false;
+
+	this->stopPrefetch();
+	this->reader.close();
+	this->ready_frames = nullptr;
+	this->store = nullptr;
+	return true;
+}
+
+bool RecordingStream::isOpen() const {
+	return this->reader.isOpen();
+}
+
+bool RecordingStream::startPrefetch() {
+	if ( this->bPrefetching ) return false;
+	this->ready_frames->reopen();
+	this->bPrefetching = true;
+	this->prefetch_thread = std::thread(&RecordingStream::prefetchLoop, this);
+	return true;
+}
+
+/* Stops the prefetch thread and returns the frames it decoded ahead to the
+ * free list; the reader is then positioned at the first undelivered frame.
+ */
+bool RecordingStream::stopPrefetch() {
+	if ( this->bPrefetching == false ) return false;
+
+	this->bPrefetching = false;
+	this->ready_frames->close();
+	if ( this->prefetch_thread.joinable() ) this->prefetch_thread.join();
+
+	DepthCloud* frame = nullptr;
+	while ( this->ready_frames->tryPop(frame) )
+		this->store->free_frames.push(frame);
+
+	this->reader.seekFrame(this->frame_index);
+	return true;
+}
+
+bool RecordingStream::prefetchLoop() {
+	while ( this->bPrefetching ) {
+		if ( this->reader.hasNext() == false ) break;
+
+		DepthCloud* frame = nullptr;
+		if ( this->store->free_frames.pop(frame, STREAM_POLL_MS) == false ) continue;
+
+		if ( this->reader.read(*frame) == false ) {
+			this->store->free_frames.push(frame);
+			break;
+		}
+
+		if ( this->ready_frames->push(frame) == false ) {
+			this->store->free_frames.push(frame);
+			break;
+		}
+	}
+
+	// End of the recording (or stopped): consumers drain what is left.
+	this->ready_frames->close();
+	return true;
+}
+
+std::shared_ptr<const DepthCloud> RecordingStream::handOut(DepthCloud* frame) {
+	std::shared_ptr<FrameStore> frame_store = this->store;
+	frame_store->outstanding++;
+	this->frame_index++;
+
+	return std::shared_ptr<const DepthCloud>(frame, [frame_store](const DepthCloud* cloud) {
+		frame_store->outstanding--;
+		frame_store->free_frames.push(const_cast<DepthCloud*>(cloud));
+	});
+}
+
+std::shared_ptr<const DepthCloud> RecordingStream::next() {
+	if ( this->isOpen() == false ) return nullptr;
+	DepthCloud* frame = nullptr;
+
+	if ( this->bPrefetch ) {
+		while ( this->ready_frames->pop(frame, STREAM_POLL_MS) == false ) {
+			if ( this->ready_frames->isClosed() && this->ready_frames->isEmpty() ) return nullptr;
+			if ( this->store->outstanding >= this->max_resident ) {
+				std::cerr << "[RecordingStream:next] Error: All " << this->max_resident << " resident frames are still held by the consumer." << std::endl;
+				return nullptr;
+			}
+		}
+
+		return this->handOut(frame);
+	}
+
+	if ( this->reader.hasNext() == false ) return nullptr;
+	if ( this->store->free_frames.tryPop(frame) == false ) {
+		std::cerr << "[RecordingStream:next] Error: All " << this->max_resident << " resident frames are still held by the consumer." << std::endl;
+		return nullptr;
+	}
+
+	if ( this->reader.read(*frame) == false ) {
+		this->store->free_frames.push(frame);
+		return nullptr;
+	}
+
+	return this->handOut(frame);
+}
+
+std::size_t RecordingStream::forEach(const Visitor& visitor) {
+	std::size_t count = 0;
+
+	while ( true ) {
+		std::size_t frame_number = this->frame_index;
+		std::shared_ptr<const DepthCloud> frame = this->next();
+		if ( frame == nullptr ) break;
+
+		count++;
+		if ( visitor(*frame, frame_number) == false ) break;
+	}
+
+	return count;
+}
+
+bool RecordingStream::seekFrame(std::size_t frame) {
+	if ( this->isOpen() == false ) return false;
+	if ( frame >= this->reader.getFrameCount() ) return false;
+
+	this->stopPrefetch();
+	this->frame_index = frame;
+	if ( this->reader.seekFrame(frame) == false ) return false;
+	if ( this->bPrefetch ) this->startPrefetch();
+	return true;
+}
+
+bool RecordingStream::seekTimestamp(uint64_t timestamp) {
+	if ( this->isOpen() == false ) return false;
+	return this->seekFrame(this->reader.findFrame(timestamp));
+}
+
+std::size_t RecordingStream::getFrameIndex() const {
+	return this->frame_index;
+}
+
+std::size_t RecordingStream::getFrameCount() const {
+	return this->reader.getFrameCount();
+}
+
+std::size_t RecordingStream::getMaxResident() const {
+	return this->max_resident;
+}
+
+std::size_t RecordingStream::getOutstanding() const {
+	if ( this->store == nullptr ) return 0;
+	return this->store->outstanding;
+}
+
+bool RecordingStream::isPrefetching() const {
+	return this->bPrefetching;
+}
+
+const RecordingReader& RecordingStream::getReader() const {
+	return this->reader;
+}
+
+}
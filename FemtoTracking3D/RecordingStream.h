@@ -0,0 +1,85 @@
+#ifndef PX_RECORDING_STREAM_H
+#define PX_RECORDING_STREAM_H
+
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include "BoundedQueue.h"
+#include "RecordingReader.h"
+
+namespace px {
+
+/* Sequential, bounded-memory access to a DepthCloud recording.
+ *
+ * At most max_resident frames exist at any time. Frames are handed out as
+ * shared pointers and go back to the stream for reuse once every copy of
+ * the pointer is released. With prefetching enabled, a background thread
+ * decodes the following frames into the free slots while the current frame
+ * is processed.
+ *
+ * A consumer that holds on to all max_resident frames stalls the stream;
+ * next() then reports an error instead of blocking forever.
+ */
+class RecordingStream {
+public:
+	typedef std::function<bool(const DepthCloud& cloud, std::size_t frame)> Visitor;
+
+	RecordingStream(std::size_t max_resident = 3, bool bPrefetch = true);
+	~RecordingStream();
+
+	bool open(const std::string& filename, SerializeType legacy_type = SERIALIZE_COMPRESSED);
+	bool close();
+	bool isOpen() const;
+
+	/* Returns the next frame, or nullptr at the end of the recording. */
+	std::shared_ptr<const DepthCloud> next();
+
+	/* Calls the visitor for every remaining frame until it returns false.
+	 * Returns the number of frames visited.
+	 */
+	std::size_t forEach(const Visitor& visitor);
+
+	bool seekFrame(std::size_t frame);
+	bool seekTimestamp(uint64_t timestamp);
+
+	std::size_t getFrameIndex() const;
+	std::size_t getFrameCount() const;
+	std::size_t getMaxResident() const;
+	std::size_t getOutstanding() const;
+	bool isPrefetching() const;
+	const RecordingReader& getReader() const;
+
+protected:
+	RecordingStream(const RecordingStream&) = delete;
+	RecordingStream& operator = (const RecordingStream&) = delete;
+
+	/* Frame storage is shared with the deleters of handed out frames, so
+	 * frames still held by a consumer outlive the stream.
+	 */
+	struct FrameStore {
+		FrameStore(std::size_t count);
+
+		std::vector<std::unique_ptr<DepthCloud> > frames;
+		BoundedQueue<DepthCloud*> free_frames;
+		std::atomic<std::size_t> outstanding;
+	};
+
+	bool startPrefetch();
+	bool stopPrefetch();
+	bool prefetchLoop();
+	std::shared_ptr<const DepthCloud> handOut(DepthCloud* frame);
+
+	RecordingReader reader;
+	std::shared_ptr<FrameStore> store;
+	std::unique_ptr<BoundedQueue<DepthCloud*> > ready_frames;
+	std::thread prefetch_thread;
+	std::atomic<bool> bPrefetching;
+	std::size_t max_resident;
+	std::size_t frame_index;
+	bool bPrefetch;
+};
+
+}
+
+#endif
@@ -0,0 +1,345 @@
+#include "RecordingTranscoder.h"
+#include <sstream>
+#include <cstring>
+#include <chrono>
+#include <mutex>
+#include <algorithm>
+#include <filesystem>
+
+namespace px {
+
+const static double BYTES_PER_MB = 1024.0 * 1024.0;
+
+TranscodeOptions::TranscodeOptions() {
+	this->type = SERIALIZE_DEFAULT;
+	this->legacy_type = SERIALIZE_COMPRESSED;
+	this->keyframe_interval = 0;
+	this->bChunked = true;
+	this->roi_x = 0;
+	this->roi_y = 0;
+	this->roi_width = 0;
+	this->roi_height = 0;
+	this->first_frame = 0;
+	this->frame_count = 0;
+	this->frame_step = 1;
+	this->thread_count = 0;
+	this->queue_depth = 0;
+}
+
+bool TranscodeOptions::hasRoi() const {
+	return this->roi_width != 0 && this->roi_height != 0;
+}
+
+TranscodeReport::TranscodeReport() {
+	this->frames_read = 0;
+	this->frames_written = 0;
+	this->frames_failed = 0;
+	this->bytes_read = 0;
+	this->bytes_written = 0;
+	this->seconds = 0.0;
+	this->bSuccess = false;
+}
+
+double TranscodeReport::getReadRate() const {
+	if ( this->seconds <= 0.0 ) return 0.0;
+	return double(this->bytes_read) / BYTES_PER_MB / this->seconds;
+}
+
+double TranscodeReport::getWriteRate() const {
+	if ( this->seconds <= 0.0 ) return 0.0;
+	return double(this->bytes_written) / BYTES_PER_MB / this->seconds;
+}
+
+double TranscodeReport::getFrameRate() const {
+	if ( this->seconds <= 0.0 ) return 0.0;
+	return double(this->frames_written) / this->seconds;
+}
+
+std::string TranscodeReport::toString() const {
+	std::stringstream stream;
+	stream << this->input << " -> " << this->output << (this->bSuccess ? "" : " (FAILED)") << std::endl;
+	stream << "Frames: " << this->frames_written << " written, " << this->frames_read << " read, " << this->frames_failed << " failed" << std::endl;
+	stream << "Data: " << double(this->bytes_read) / BYTES_PER_MB << " MB in, " << double(this->bytes_written) / BYTES_PER_MB << " MB out in " << this->seconds << " s" << std::endl;
+	stream << "Rate: " << this->getReadRate() << " MB/s in, " << this->getWriteRate() << " MB/s out, " << this->getFrameRate() << " frames/s" << std::endl;
+	return stream.str();
+}
+
+RecordingTranscoder::RecordingTranscoder(const TranscodeOptions& options) {
+	this->options = options;
+	this->input_type = SERIALIZE_COMPRESSED;
+	this->output_type = SERIALIZE_COMPRESSED;
+	this->bytes_read = 0;
+}
+
+RecordingTranscoder::~RecordingTranscoder() {
+	if ( this->writer.isOpen() ) this->writer.close();
+	if ( this->reader.isOpen() ) this->reader.close();
+}
+
+bool RecordingTranscoder::setOptions(const TranscodeOptions& options) {
+	this->options = options;
+	return true;
+}
+
+const TranscodeOptions& RecordingTranscoder::getOptions() const {
+	return this->options;
+}
+
+/* Output intrinsics follow the crop (the principal point moves with the
+ * ROI origin), so SERIALIZE_DEPTH output rebuilds the same points.
+ */
+bool RecordingTranscoder::configure(const std::string& output) {
+	this->input_type = this->reader.getSerializeType();
+	this->output_type = (this->options.type == SERIALIZE_DEFAULT) ? this->input_type : this->options.type;
+	this->input_rays = this->reader.getRayTable();
+	this->output_rays = nullptr;
+
+	std::size_t width = this->reader.getWidth();
+	std::size_t height = this->reader.getHeight();
+	if ( this->options.hasRoi() && (this->options.roi_x + this->options.roi_width > width || this->options.roi_y + this->options.roi_height > height) ) {
+		std::cerr << "[RecordingTranscoder:configure] Error: ROI exceeds the frame size " << width << "x" << height << std::endl;
+		return false;
+	}
+
+	CameraIntrinsics intrinsics = this->reader.getIntrinsics();
+	if ( intrinsics.isValid() && this->options.hasRoi() ) {
+		intrinsics.width = static_cast<uint32_t>(this->options.roi_width);
+		intrinsics.height = static_cast<uint32_t>(this->options.roi_height);
+		intrinsics.cx -= float(this->options.roi_x);
+		intrinsics.cy -= float(this->options.roi_y);
+	}
+
+	if ( this->output_type == SERIALIZE_DEPTH && intrinsics.isValid() == false ) {
+		std::cerr << "[RecordingTranscoder:configure] Error: SERIALIZE_DEPTH output needs an input recording with intrinsics." << std::endl;
+		return false;
+	}
+
+	if ( this->writer.open(output, this->output_type) == false ) return false;
+	if ( this->writer.setIntrinsics(intrinsics) == false ) return false;
+	if ( this->writer.setKeyframeInterval(this->options.keyframe_interval) == false ) return false;
+	if ( this->writer.setChunked(this->options.bChunked) == false ) return false;
+	if ( this->output_type == SERIALIZE_DEPTH ) this->output_rays = this->writer.getRayTable();
+	return true;
+}
+
+bool RecordingTranscoder::transcode(const std::string& input, const std::string& output, TranscodeReport& report) {
+	report = TranscodeReport();
+	report.input = input;
+	report.output = output;
+	auto start = std::chrono::steady_clock::now();
+
+	if ( this->reader.open(input, this->options.legacy_type) == false ) return false;
+	if ( this->configure(output) == false ) {
+		this->reader.close();
+		if ( this->writer.isOpen() ) this->writer.close();
+		return false;
+	}
+
+	std::vector<std::size_t> frames;
+	std::size_t step = std::max<std::size_t>(this->options.frame_step, 1);
+	std::size_t end = this->reader.getFrameCount();
+	if ( this->options.frame_count != 0 && this->options.first_frame + this->options.frame_count < end ) end = this->options.first_frame + this->options.frame_count;
+	for ( std::size_t frame = this->options.first_frame; frame < end; frame += step ) frames.push_back(frame);
+
+	std::size_t thread_count = this->options.thread_count;
+	if ( thread_count == 0 ) thread_count = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+	std::size_t depth = (this->options.queue_depth != 0) ? this->options.queue_depth : 2 * thread_count + 2;
+
+	this->free_jobs.reset(new BoundedQueue<TranscodeJob*>(depth, QUEUE_BLOCK));
+	this->pending_jobs.reset(new BoundedQueue<TranscodeJob*>(depth, QUEUE_BLOCK));
+	this->processed_jobs.reset(new BoundedQueue<TranscodeJob*>(depth, QUEUE_BLOCK));
+	this->jobs.clear();
+	for ( std::size_t i = 0; i < depth; i++ ) {
+		this->jobs.push_back(std::unique_ptr<TranscodeJob>(new TranscodeJob()));
+		this->free_jobs->push(this->jobs.back().get());
+	}
+
+	this->bytes_read = 0;
+	std::thread read_thread(&RecordingTranscoder::readLoop, this, std::cref(frames));
+	std::vector<std::thread> workers;
+	for ( std::size_t i = 0; i < thread_count; i++ ) workers.push_back(std::thread(&RecordingTranscoder::workLoop, this));
+
+	// At most depth jobs are in flight, so sequence numbers modulo depth never collide.
+	std::vector<TranscodeJob*> reorder(depth, nullptr);
+	uint64_t next_write = 0;
+	TranscodeJob* job = nullptr;
+
+	while ( next_write < frames.size() && this->processed_jobs->pop(job) ) {
+		reorder[job->sequence % depth] = job;
+
+		while ( true ) {
+			TranscodeJob*& next = reorder[next_write % depth];
+			if ( next == nullptr || next->sequence != next_write ) break;
+
+			this->write(*next, report);
+			this->free_jobs->push(next);
+			next = nullptr;
+			next_write++;
+		}
+	}
+
+	this->free_jobs->close();
+	this->pending_jobs->close();
+	read_thread.join();
+	for ( std::size_t i = 0; i < workers.size(); i++ ) workers[i].join();
+	this->processed_jobs->close();
+
+	report.frames_read = frames.size();
+	report.bytes_read = this->bytes_read;
+	bool bClosed = this->writer.close();
+	this->reader.close();
+	this->jobs.clear();
+
+	std::error_code error;
+	uintmax_t size = std::filesystem::file_size(output, error);
+	if ( !error ) report.bytes_written = static_cast<uint64_t>(size);
+
+	report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	report.bSuccess = bClosed && next_write == frames.size() && report.frames_failed == 0;
+	return report.bSuccess;
+}
+
+/* Reads the stored bytes of each selected frame; delta coded frames are
+ * decoded here, in order. Unreadable frames are passed on as invalid jobs
+ * so the writer's sequence stays complete.
+ */
+void RecordingTranscoder::readLoop(const std::vector<std::size_t>& frames) {
+	bool bDelta = this->reader.isDeltaCoded();
+	TranscodeJob* job = nullptr;
+
+	for ( std::size_t i = 0; i < frames.size(); i++ ) {
+		if ( this->free_jobs->pop(job) == false ) break;
+
+		job->sequence = i;
+		job->result = nullptr;
+		job->bDecoded = bDelta;
+		if ( bDelta ) job->bValid = this->reader.read(frames[i], job->source);
+		else job->bValid = this->reader.readFrameData(frames[i], job->frame_data);
+
+		this->bytes_read += this->reader.getFrameSize(frames[i]);
+		if ( this->pending_jobs->push(job) == false ) break;
+	}
+
+	this->pending_jobs->close();
+}
+
+void RecordingTranscoder::workLoop() {
+	TranscodeJob* job = nullptr;
+	while ( this->pending_jobs->pop(job) ) {
+		if ( job->bValid ) job->bValid = this->process(*job);
+		if ( this->processed_jobs->push(job) == false ) break;
+	}
+}
+
+bool RecordingTranscoder::process(TranscodeJob& job) const {
+	if ( job.bDecoded == false ) {
+		if ( this->input_rays != nullptr ) job.source.setRayTable(this->input_rays);
+		if ( job.source.decode(job.frame_data.data(), job.frame_data.size(), this->input_type) == false ) return false;
+	}
+
+	job.result = &job.source;
+	if ( this->options.hasRoi() ) {
+		if ( this->crop(job.source, job.cropped) == false ) return false;
+		job.result = &job.cropped;
+	}
+
+	if ( this->output_rays != nullptr ) job.result->setRayTable(this->output_rays);
+
+	// Depth output of frames without native depth (other input types, crops)
+	// takes it from z; x and y are then rebuilt from the pinhole rays on load.
+	if ( this->output_type == SERIALIZE_DEPTH && job.result->hasNativeDepth() == false ) {
+		if ( job.result->projectNativeDepth() == false ) return false;
+	}
+
+	if ( this->options.keyframe_interval != 0 ) return true;
+	return job.result->encode(job.encoded, this->output_type);
+}
+
+bool RecordingTranscoder::crop(const DepthCloud& source, DepthCloud& target) const {
+	std::size_t width = this->options.roi_width;
+	std::size_t height = this->options.roi_height;
+	if ( this->options.roi_x + width > source.width() || this->options.roi_y + height > source.height() ) return false;
+	if ( target.width() != width || target.height() != height ) {
+		if ( target.resize(width, height) == false ) return false;
+	}
+
+	const PointXYZ<Real>* in = source.constData() + this->options.roi_y * source.width() + this->options.roi_x;
+	PointXYZ<Real>* out = target.getData();
+	for ( std::size_t y = 0; y < height; y++ ) std::memcpy(out + y * width, in + y * source.width(), width * sizeof(PointXYZ<Real>));
+
+	target.clearNativeDepth();
+	target.setTimestamp(source.getTimestamp());
+	target.setDistanceBounds(source.getMinDistance(), source.getMaxDistance());
+	target.setRangeBounds(source.getMinRange(), source.getMaxRange());
+	return true;
+}
+
+bool RecordingTranscoder::write(TranscodeJob& job, TranscodeReport& report) {
+	bool bWritten = job.bValid && job.result != nullptr;
+	if ( bWritten ) {
+		if ( this->options.keyframe_interval != 0 ) bWritten = this->writer.write(*job.result);
+		else bWritten = this->writer.write(*job.result, job.encoded.data(), job.encoded.size());
+	}
+
+	if ( bWritten ) report.frames_written++;
+	else report.frames_failed++;
+	return bWritten;
+}
+
+bool TranscodeDirectory(const std::string& input_directory, const std::string& output_directory, const TranscodeOptions& options, std::vector<TranscodeReport>& reports, std::size_t session_count, const std::string& extension) {
+	namespace fs = std::filesystem;
+	reports.clear();
+
+	std::error_code error;
+	if ( fs::is_directory(input_directory, error) == false ) {
+		std::cerr << "[TranscodeDirectory] Error: Not a directory: " << input_directory << std::endl;
+		return false;
+	}
+
+	fs::create_directories(output_directory, error);
+	if ( fs::equivalent(input_directory, output_directory, error) ) {
+		std::cerr << "[TranscodeDirectory] Error: Input and output directory are the same: " << input_directory << std::endl;
+		return false;
+	}
+
+	std::vector<fs::path> inputs;
+	for ( const fs::directory_entry& entry : fs::directory_iterator(input_directory, error) ) {
+		if ( entry.is_regular_file() == false ) continue;
+		if ( extension.length() != 0 && entry.path().extension() != extension ) continue;
+		inputs.push_back(entry.path());
+	}
+
+	std::sort(inputs.begin(), inputs.end());
+	reports.resize(inputs.size());
+	if ( inputs.size() == 0 ) return true;
+
+	session_count = std::min<std::size_t>(std::max<std::size_t>(session_count, 1), inputs.size());
+	TranscodeOptions session_options = options;
+	if ( session_options.thread_count == 0 ) {
+		std::size_t cores = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+		session_options.thread_count = std::max<std::size_t>(cores / session_count, 1);
+	}
+
+	std::atomic<std::size_t> next(0);
+	std::atomic<bool> bResult(true);
+	std::mutex log_mutex;
+
+	auto session = [&]() {
+		RecordingTranscoder transcoder(session_options);
+		for ( std::size_t i = next++; i < inputs.size(); i = next++ ) {
+			fs::path output = fs::path(output_directory) / inputs[i].filename();
+			if ( transcoder.transcode(inputs[i].string(), output.string(), reports[i]) == false ) bResult = false;
+
+			std::lock_guard<std::mutex> lock(log_mutex);
+			std::cout << reports[i].toString();
+		}
+	};
+
+	std::vector<std::thread> sessions;
+	for ( std::size_t i = 1; i < session_count; i++ ) sessions.push_back(std::thread(session));
+	session();
+	for ( std::size_t i = 0; i < sessions.size(); i++ ) sessions[i].join();
+	return bResult;
+}
+
+}
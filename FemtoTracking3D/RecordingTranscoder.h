@@ -0,0 +1,140 @@
+#ifndef PX_RECORDING_TRANSCODER_H
+#define PX_RECORDING_TRANSCODER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include "BoundedQueue.h"
+#include "RecordingReader.h"
+#include "RecordingWriter.h"
+
+namespace px {
+
+/* Conversion settings of a RecordingTranscoder.
+ *
+ * type: serialize type of the output (SERIALIZE_DEFAULT keeps the input
+ *   type). SERIALIZE_DEPTH needs input recordings with intrinsics; frames
+ *   without native depth (raw or compressed input) store their z, and x and
+ *   y are rebuilt from the pinhole rays on load.
+ * keyframe_interval, bChunked: output codec and framing (see RecordingWriter).
+ * roi_*: crop rectangle in pixels (roi_width or roi_height 0 = whole frame).
+ * first_frame, frame_count, frame_step: the frames first_frame,
+ *   first_frame + frame_step, ... (frame_count 0 = up to the last frame).
+ * thread_count: decode/transform/encode workers (0 = one per core).
+ * queue_depth: frames in flight between the stages (0 = 2 per worker + 2).
+ */
+struct TranscodeOptions {
+	SerializeType type;
+	SerializeType legacy_type;
+	std::size_t keyframe_interval;
+	bool bChunked;
+	std::size_t roi_x, roi_y;
+	std::size_t roi_width, roi_height;
+	std::size_t first_frame;
+	std::size_t frame_count;
+	std::size_t frame_step;
+	std::size_t thread_count;
+	std::size_t queue_depth;
+
+	TranscodeOptions();
+	bool hasRoi() const;
+};
+
+/* Outcome of one transcoded recording. Bytes read are the stored frame
+ * sizes of the selected input frames, bytes written the output file size.
+ */
+struct TranscodeReport {
+	std::string input;
+	std::string output;
+	std::size_t frames_read;
+	std::size_t frames_written;
+	std::size_t frames_failed;
+	uint64_t bytes_read;
+	uint64_t bytes_written;
+	double seconds;
+	bool bSuccess;
+
+	TranscodeReport();
+
+	/* MB/s of input and output, frames/s written. */
+	double getReadRate() const;
+	double getWriteRate() const;
+	double getFrameRate() const;
+	std::string toString() const;
+};
+
+/* Converts a recording (indexed or legacy) to an indexed recording with
+ * another serialize type, codec or framing, optionally cropped and
+ * temporally subsampled.
+ *
+ * The stages run as a pipeline: a reader thread reads the stored frame bytes
+ * (RecordingReader), worker threads decode (DepthCloud::decode), crop and
+ * encode (DepthCloud::encode) them, and the calling thread writes them in
+ * order (RecordingWriter) through a reorder buffer. Frames are recycled
+ * through a fixed pool of queue_depth jobs, so memory is bounded and a slow
+ * writer back-pressures the reader. Delta coded inputs are decoded by the
+ * reader and delta coded outputs encoded by the writer, as those codecs
+ * depend on the previous frame.
+ *
+ * Damaged input frames are skipped and counted as failed.
+ */
+class RecordingTranscoder {
+public:
+	RecordingTranscoder(const TranscodeOptions& options = TranscodeOptions());
+	~RecordingTranscoder();
+
+	bool transcode(const std::string& input, const std::string& output, TranscodeReport& report);
+
+	bool setOptions(const TranscodeOptions& options);
+	const TranscodeOptions& getOptions() const;
+
+protected:
+	RecordingTranscoder(const RecordingTranscoder&) = delete;
+	RecordingTranscoder& operator = (const RecordingTranscoder&) = delete;
+
+	struct TranscodeJob {
+		std::vector<uint8_t> frame_data;
+		std::vector<uint8_t> encoded;
+		DepthCloud source;
+		DepthCloud cropped;
+		DepthCloud* result;
+		uint64_t sequence;
+		bool bDecoded;
+		bool bValid;
+	};
+
+	bool configure(const std::string& output);
+	void readLoop(const std::vector<std::size_t>& frames);
+	void workLoop();
+	bool process(TranscodeJob& job) const;
+	bool crop(const DepthCloud& source, DepthCloud& target) const;
+	bool write(TranscodeJob& job, TranscodeReport& report);
+
+	TranscodeOptions options;
+	RecordingReader reader;
+	RecordingWriter writer;
+	SerializeType input_type;
+	SerializeType output_type;
+	std::shared_ptr<const RayTable> input_rays;
+	std::shared_ptr<const RayTable> output_rays;
+
+	std::vector<std::unique_ptr<TranscodeJob>> jobs;
+	std::unique_ptr<BoundedQueue<TranscodeJob*>> free_jobs;
+	std::unique_ptr<BoundedQueue<TranscodeJob*>> pending_jobs;
+	std::unique_ptr<BoundedQueue<TranscodeJob*>> processed_jobs;
+	std::atomic<uint64_t> bytes_read;
+};
+
+/* Transcodes every recording in input_directory (regular files, optionally
+ * only those with the given extension) to the same file name in
+ * output_directory, session_count recordings at a time. Worker threads are
+ * shared out among the sessions when options.thread_count is 0. One report
+ * per recording is returned, in file name order.
+ */
+bool TranscodeDirectory(const std::string& input_directory, const std::string& output_directory, const TranscodeOptions& options, std::vector<TranscodeReport>& reports, std::size_t session_count = 2, const std::string& extension = "");
+
+}
+
+#endif
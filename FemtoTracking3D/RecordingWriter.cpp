@@ -0,0 +1,290 @@
+#include "RecordingWriter.h"
+#include <limits>
+
+namespace px {
+
+RecordingWriter::RecordingWriter(FileOverflowPolicy overflow, std::size_t memory_limit, FileSyncPolicy policy) : out(memory_limit, policy, overflow) {
+	this->overflow = overflow;
+	this->type = SERIALIZE_COMPRESSED;
+	this->header = RecordingHeader();
+	this->rays = nullptr;
+	this->keyframe_interval = 0;
+	this->bChunked = true;
+	this->bHeaderWritten = false;
+}
+
+RecordingWriter::~RecordingWriter() {
+	if ( this->out.isOpen() ) this->close();
+}
+
+bool RecordingWriter::open(const std::string& filename, SerializeType type) {
+	if ( this->out.isOpen() ) this->close();
+
+	if ( this->out.open(filename) == false ) {
+		std::cerr << "[RecordingWriter:open] Error: Could not open: " << filename << std::endl;
+		return false;
+	}
+
+	this->type = type;
+	CameraIntrinsics intrinsics = this->header.intrinsics;
+	this->header = RecordingHeader();
+	this->header.intrinsics = intrinsics;
+	this->rays = nullptr;
+	if ( intrinsics.isValid() ) this->rays = std::make_shared<RayTable>(intrinsics);
+	this->index.clear();
+	this->bHeaderWritten = false;
+	return true;
+}
+
+bool RecordingWriter::writeHeader(const DepthCloud& cloud) {
+	this->header.magic = RECORDING_MAGIC;
+	this->header.version = RECORDING_VERSION;
+	this->header.serialize_type = static_cast<uint32_t>(this->type);
+	this->header.width = static_cast<uint32_t>(cloud.width());
+	this->header.height = static_cast<uint32_t>(cloud.height());
+	this->header.min_distance = cloud.getMinDistance();
+	this->header.max_distance = cloud.getMaxDistance();
+	this->header.min_range = cloud.getMinRange();
+	this->header.max_range = cloud.getMaxRange();
+	this->header.intrinsics.width = this->header.width;
+	this->header.intrinsics.height = this->header.height;
+	this->header.codec = (this->keyframe_interval != 0) ? RECORDING_CODEC_DELTA : RECORDING_CODEC_NONE;
+	this->header.keyframe_interval = static_cast<uint32_t>(this->keyframe_interval);
+	this->header.framing = this->bChunked ? RECORDING_FRAMING_CHUNKED : RECORDING_FRAMING_NONE;
+
+	// The header comes first in an empty buffer, it is never dropped.
+	this->out.setOverflowPolicy(OVERFLOW_BLOCK);
+	this->out.writeUInt32(this->header.magic);
+	this->out.writeUInt32(this->header.version);
+	this->out.writeUInt32(this->header.serialize_type);
+	this->out.writeUInt32(this->header.width);
+	this->out.writeUInt32(this->header.height);
+	this->out.writeFloat(this->header.min_distance);
+	this->out.writeFloat(this->header.max_distance);
+	this->out.writeFloat(this->header.min_range);
+	this->out.writeFloat(this->header.max_range);
+	this->out.writeFloat(this->header.intrinsics.fx);
+	this->out.writeFloat(this->header.intrinsics.fy);
+	this->out.writeFloat(this->header.intrinsics.cx);
+	this->out.writeFloat(this->header.intrinsics.cy);
+	this->out.writeFloat(this->header.intrinsics.depth_scale);
+	this->out.writeUInt32(this->header.codec);
+	this->out.writeUInt32(this->header.keyframe_interval);
+	this->out.writeUInt32(this->header.framing);
+	this->out.setOverflowPolicy(this->overflow);
+
+	this->bHeaderWritten = true;
+	return this->out.getStatus() == FILE_OK;
+}
+
+bool RecordingWriter::setIntrinsics(const CameraIntrinsics& intrinsics) {
+	if ( this->bHeaderWritten ) {
+		std::cerr << "[RecordingWriter:setIntrinsics] Error: The header was already written." << std::endl;
+		return false;
+	}
+
+	this->header.intrinsics = intrinsics;
+	this->rays = nullptr;
+	if ( intrinsics.isValid() ) this->rays = std::make_shared<RayTable>(intrinsics);
+	return true;
+}
+
+/* An interval of n stores every n-th frame as a keyframe and the others as
+ * deltas against their predecessor (0 disables delta coding). Random access
+ * decodes up to n-1 frames, so the interval trades size for seek latency.
+ */
+bool RecordingWriter::setKeyframeInterval(std::size_t interval) {
+	if ( this->bHeaderWritten ) {
+		std::cerr << "[RecordingWriter:setKeyframeInterval] Error: The header was already written." << std::endl;
+		return false;
+	}
+
+	if ( interval != 0 && this->type == SERIALIZE_RAW ) {
+		std::cerr << "[RecordingWriter:setKeyframeInterval] Error: Delta coding is not supported for SERIALIZE_RAW recordings." << std::endl;
+		return false;
+	}
+
+	this->keyframe_interval = interval;
+	return true;
+}
+
+/* Common checks of write(): the header goes out with the first frame and all
+ * frames must match its dimensions.
+ */
+bool RecordingWriter::prepare(const DepthCloud& cloud) {
+	if ( this->out.isOpen() == false ) return false;
+
+	if ( this->type == SERIALIZE_DEPTH && this->rays == nullptr ) {
+		if ( this->header.intrinsics.isValid() == false ) {
+			std::cerr << "[RecordingWriter:write] Error: SERIALIZE_DEPTH recordings need camera intrinsics." << std::endl;
+			return false;
+		}
+
+		this->rays = std::make_shared<RayTable>(this->header.intrinsics);
+	}
+
+	if ( this->bHeaderWritten == false ) {
+		if ( this->keyframe_interval != 0 && this->encoder.configure(this->type, this->keyframe_interval) == false ) return false;
+		this->writeHeader(cloud);
+	}
+
+	if ( cloud.width() != this->header.width || cloud.height() != this->header.height ) {
+		std::cerr << "[RecordingWriter:write] Error: Frame size " << cloud.width() << "x" << cloud.height() << " does not match the recording size " << this->header.width << "x" << this->header.height << std::endl;
+		return false;
+	}
+
+	// Without native depth SERIALIZE_DEPTH keeps z only, which is lossless
+	// only if x and y are rebuilt by the rays on load.
+	if ( this->type == SERIALIZE_DEPTH && cloud.hasNativeDepth() == false ) {
+		const std::shared_ptr<const RayTable>& rays = (cloud.getRayTable() != nullptr) ? cloud.getRayTable() : this->rays;
+		if ( rays->matches(cloud.constData(), cloud.size()) == false ) {
+			std::cerr << "[RecordingWriter:write] Error: Frame has no native depth and its points do not follow the pinhole rays, SERIALIZE_DEPTH would not preserve x and y. Record SERIALIZE_COMPRESSED or SERIALIZE_RAW instead." << std::endl;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/* Chunked recordings (the default) checksum every frame, see RecordingFormat.h. */
+bool RecordingWriter::setChunked(bool bChunked) {
+	if ( this->bHeaderWritten ) {
+		std::cerr << "[RecordingWriter:setChunked] Error: The header was already written." << std::endl;
+		return false;
+	}
+
+	this->bChunked = bChunked;
+	return true;
+}
+
+bool RecordingWriter::writeChunk(uint32_t tag, const uint8_t* data, std::size_t length) {
+	if ( length > std::numeric_limits<uint32_t>::max() ) {
+		std::cerr << "[RecordingWriter:writeChunk] Error: Chunk of " << length << " bytes is too large." << std::endl;
+		return false;
+	}
+
+	uint32_t size = static_cast<uint32_t>(length);
+	this->out.writeUInt32(RECORDING_CHUNK_MAGIC);
+	this->out.writeUInt32(tag);
+	this->out.writeUInt32(size);
+	this->out.writeUInt32(RecordingChunkChecksum(tag, size, data));
+	return this->out.writeBuffer(data, length);
+}
+
+/* Writes one encoded frame as a single AsyncFileWriter frame, so a full
+ * buffer drops it as a whole. The index only takes frames that were kept.
+ */
+bool RecordingWriter::writeFrame(const DepthCloud& cloud, const uint8_t* frame_data, std::size_t length) {
+	RecordingIndexEntry entry;
+	entry.offset = this->out.tell();
+	entry.timestamp = static_cast<uint64_t>(cloud.getTimestamp());
+
+	this->out.beginFrame();
+	bool bWritten = this->bChunked ? this->writeChunk(CHUNK_FRAME, frame_data, length) : this->out.writeBuffer(frame_data, length);
+
+	if ( this->out.endFrame() == false ) {
+		// The next delta frame would predict from the dropped one.
+		if ( this->keyframe_interval != 0 ) this->encoder.reset();
+		return false;
+	}
+
+	if ( bWritten == false ) return false;
+	this->index.push_back(entry);
+	return true;
+}
+
+bool RecordingWriter::write(DepthCloud& cloud) {
+	if ( this->prepare(cloud) == false ) return false;
+
+	// Clouds that do not come from the sensor's ray table use the recording's one.
+	if ( this->type == SERIALIZE_DEPTH && cloud.getRayTable() == nullptr ) cloud.setRayTable(this->rays);
+
+	bool bEncoded = (this->keyframe_interval != 0) ? this->encoder.encode(cloud, this->frame_buffer) : cloud.encode(this->frame_buffer, this->type);
+	if ( bEncoded == false ) return false;
+	return this->writeFrame(cloud, this->frame_buffer.data(), this->frame_buffer.size());
+}
+
+/* Appends a frame that was already encoded with DepthCloud::encode (using the
+ * recording's serialize type); the cloud provides the header and index data.
+ * Delta coded recordings encode sequentially and cannot take encoded frames.
+ */
+bool RecordingWriter::write(const DepthCloud& cloud, const uint8_t* frame_data, std::size_t length) {
+	if ( frame_data == nullptr ) return false;
+
+	if ( this->keyframe_interval != 0 ) {
+		std::cerr << "[RecordingWriter:write] Error: Pre-encoded frames cannot be written to delta coded recordings." << std::endl;
+		return false;
+	}
+
+	if ( length != DepthCloud::SerializedSize(cloud.width(), cloud.height(), this->type) ) {
+		std::cerr << "[RecordingWriter:write] Error: Encoded frame size does not match the serialize type." << std::endl;
+		return false;
+	}
+
+	if ( this->prepare(cloud) == false ) return false;
+	return this->writeFrame(cloud, frame_data, length);
+}
+
+bool RecordingWriter::writeIndex() {
+	RecordingFooter footer;
+	footer.index_offset = this->out.tell();
+	footer.frame_count = static_cast<uint64_t>(this->index.size());
+	footer.magic = RECORDING_INDEX_MAGIC;
+
+	for ( std::size_t i = 0; i < this->index.size(); i++ ) {
+		this->out.writeUInt64(this->index[i].offset);
+		this->out.writeUInt64(this->index[i].timestamp);
+	}
+
+	this->out.writeUInt64(footer.index_offset);
+	this->out.writeUInt64(footer.frame_count);
+	this->out.writeUInt32(footer.magic);
+	return true;
+}
+
+bool RecordingWriter::close() {
+	if ( this->out.isOpen() == false ) return false;
+
+	if ( this->bHeaderWritten == false ) this->writeHeader(DepthCloud());
+
+	// The index waits for room rather than being dropped.
+	this->out.setOverflowPolicy(OVERFLOW_BLOCK);
+	this->writeIndex();
+	bool bClosed = this->out.close();
+	this->out.setOverflowPolicy(this->overflow);
+	return bClosed;
+}
+
+bool RecordingWriter::isOpen() const {
+	return this->out.isOpen();
+}
+
+std::size_t RecordingWriter::getFrameCount() const {
+	return this->index.size();
+}
+
+std::size_t RecordingWriter::getDroppedFrames() const {
+	return this->out.getDroppedFrames();
+}
+
+bool RecordingWriter::isChunked() const {
+	return this->bChunked;
+}
+
+std::size_t RecordingWriter::getKeyframeInterval() const {
+	return this->keyframe_interval;
+}
+
+SerializeType RecordingWriter::getSerializeType() const {
+	return this->type;
+}
+
+const std::shared_ptr<const RayTable>& RecordingWriter::getRayTable() const {
+	return this->rays;
+}
+
+const std::vector<RecordingIndexEntry>& RecordingWriter::getIndex() const {
+	return this->index;
+}
+
+}
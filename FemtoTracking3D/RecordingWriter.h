@@ -0,0 +1,87 @@
+#ifndef PX_RECORDING_WRITER_H
+#define PX_RECORDING_WRITER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "RecordingFormat.h"
+#include "DepthCloud.h"
+#include "DeltaCodec.h"
+#include "AsyncFileWriter.h"
+
+namespace px {
+
+/* Writes DepthCloud sequences in the indexed recording container (see
+ * RecordingFormat.h). The header is written with the first frame (it takes
+ * the dimensions and compression bounds of that frame), the frame index and
+ * footer are written by close(). All frames must share the dimensions of the
+ * first frame.
+ *
+ * SERIALIZE_DEPTH recordings need the sensor intrinsics (setIntrinsics)
+ * before the first frame; they are stored once in the header.
+ * They store the native depth of the frames (DepthCloud::setNativeDepth,
+ * e.g. the sensor's Y16 depth) and rebuild x and y with the pinhole rays on
+ * load. Frames without native depth store z instead, which is only lossless
+ * if the points are on the rays: other frames (RayTable::matches) are
+ * refused. Delta coding
+ * (setKeyframeInterval, SERIALIZE_COMPRESSED and SERIALIZE_DEPTH only) is
+ * lossless with respect to the serialize type. Frames are written in
+ * checksummed chunks unless setChunked(false) is called.
+ *
+ * The file is written by the flush thread of an AsyncFileWriter, so write()
+ * only encodes and copies the frame. With OVERFLOW_BLOCK (the default) a
+ * full write buffer makes write() wait; with OVERFLOW_DROP, for capture, the
+ * frame is dropped instead (write() returns false, getDroppedFrames counts
+ * it and a delta coded recording restarts with a keyframe). The header and
+ * the index are never dropped.
+ */
+class RecordingWriter {
+public:
+	RecordingWriter(FileOverflowPolicy overflow = OVERFLOW_BLOCK, std::size_t memory_limit = 64 << 20, FileSyncPolicy policy = SYNC_NONE);
+	~RecordingWriter();
+
+	bool open(const std::string& filename, SerializeType type = SERIALIZE_COMPRESSED);
+	bool write(DepthCloud& cloud);
+	bool write(const DepthCloud& cloud, const uint8_t* frame_data, std::size_t length);
+	bool setIntrinsics(const CameraIntrinsics& intrinsics);
+	bool setKeyframeInterval(std::size_t interval);
+	bool setChunked(bool bChunked);
+	bool close();
+
+	bool isOpen() const;
+	std::size_t getFrameCount() const;
+	std::size_t getDroppedFrames() const;
+	std::size_t getKeyframeInterval() const;
+	bool isChunked() const;
+	SerializeType getSerializeType() const;
+	const std::vector<RecordingIndexEntry>& getIndex() const;
+
+	/* Ray table built from the intrinsics (SERIALIZE_DEPTH). */
+	const std::shared_ptr<const RayTable>& getRayTable() const;
+
+protected:
+	RecordingWriter(const RecordingWriter&) = delete;
+	RecordingWriter& operator = (const RecordingWriter&) = delete;
+
+	bool prepare(const DepthCloud& cloud);
+	bool writeHeader(const DepthCloud& cloud);
+	bool writeIndex();
+	bool writeFrame(const DepthCloud& cloud, const uint8_t* frame_data, std::size_t length);
+	bool writeChunk(uint32_t tag, const uint8_t* data, std::size_t length);
+
+	AsyncFileWriter out;
+	FileOverflowPolicy overflow;
+	SerializeType type;
+	RecordingHeader header;
+	std::vector<RecordingIndexEntry> index;
+	std::shared_ptr<const RayTable> rays;
+	DeltaFrameEncoder encoder;
+	std::vector<uint8_t> frame_buffer;
+	std::size_t keyframe_interval;
+	bool bChunked;
+	bool bHeaderWritten;
+};
+
+}
+
+#endif
@@ -0,0 +1,252 @@
+#include "ReplayCamera.h"
+#include <thread>
+#include <sstream>
+
+namespace px {
+
+ReplayCamera::ReplayCamera(const std::string& depth_filename, const std::string& infrared_filename, SerializeType type) : PhysicalCamera() {
+	this->depth_filename = depth_filename;
+	this->infrared_filename = infrared_filename;
+	this->serialize_type = type;
+	this->infrared_image = nullptr;
+	this->depth_cloud = nullptr;
+	this->mode = REPLAY_REALTIME;
+	this->bConnected = false;
+	this->bLoop = false;
+	this->bFinished = false;
+	this->frame_index = 0;
+	this->current_frame = 0;
+	this->delivered_frames = 0;
+	this->bAnchored = false;
+	this->anchor_stamp = 0;
+	this->last_stamp = 0;
+}
+
+ReplayCamera::~ReplayCamera() {
+	this->disconnect();
+}
+
+bool ReplayCamera::connect() {
+	if ( this->bConnected ) return true;
+
+	if ( this->recording.open(this->depth_filename, this->serialize_type) == false ) return false;
+
+	if ( this->infrared_filename.length() != 0 && this->infrared_in.open(this->infrared_filename) == false ) {
+		std::cerr << "[ReplayCamera:connect] Error: Could not open: " << this->infrared_filename << std::endl;
+		this->recording.close();
+		return false;
+	}
+
+	this->depth_cloud = std::make_shared<DepthCloud>();
+	if ( this->infrared_in.isOpen() ) this->infrared_image = std::make_shared<IntensityImage<uint16_t>>();
+
+	this->bFinished = false;
+	this->frame_index = 0;
+	this->current_frame = 0;
+	this->delivered_frames = 0;
+	this->bAnchored = false;
+	this->start_time = std::chrono::steady_clock::now();
+	this->bConnected = true;
+	return true;
+}
+
+bool ReplayCamera::disconnect() {
+	if ( this->bConnected == false ) return false;
+
+	this->recording.close();
+	if ( this->infrared_in.isOpen() ) this->infrared_in.close();
+	this->depth_cloud = nullptr;
+	this->infrared_image = nullptr;
+	this->bConnected = false;
+	return true;
+}
+
+bool ReplayCamera::isConnected() const {
+	return this->bConnected;
+}
+
+bool ReplayCamera::rewind() {
+	return this->seekFrame(0);
+}
+
+bool ReplayCamera::seekFrame(std::size_t frame) {
+	if ( this->bConnected == false ) return false;
+	if ( this->recording.seekFrame(frame) == false ) return false;
+	if ( this->infrared_in.isOpen() ) this->seekInfrared(frame);
+
+	this->bFinished = false;
+	this->frame_index = frame;
+	this->delivered_frames = 0;
+	this->bAnchored = false;
+	this->start_time = std::chrono::steady_clock::now();
+	return true;
+}
+
+bool ReplayCamera::seekTimestamp(uint64_t timestamp) {
+	if ( this->bConnected == false ) return false;
+	return this->seekFrame(this->recording.findFrame(timestamp));
+}
+
+/* The infrared stream has no index; frames are skipped by hopping over
+ * their headers (frame data is not read).
+ */
+bool ReplayCamera::seekInfrared(std::size_t frame) {
+	if ( this->infrared_in.seek(0) == false ) return false;
+
+	for ( std::size_t i = 0; i < frame; i++ ) {
+		if ( this->infrared_in.hasNext() == false ) return false;
+		uint64_t offset = this->infrared_in.tell();
+		uint32_t width = this->infrared_in.readUInt32();
+		uint32_t height = this->infrared_in.readUInt32();
+		this->infrared_in.readUInt64();
+		uint64_t frame_size = RECORDING_FRAME_HEADER_SIZE + uint64_t(width) * uint64_t(height) * sizeof(uint16_t);
+		if ( this->infrared_in.seek(offset + frame_size) == false ) return false;
+	}
+
+	return true;
+}
+
+/* Frames handed out by getDepthCloud/getInfraredImage are overwritten in
+ * place, unless a consumer still holds a copy of the shared_ptr, in which
+ * case a fresh frame is decoded instead (same policy as OrbbecCamera).
+ */
+bool ReplayCamera::readFrame() {
+	if ( this->recording.hasNext() == false ) return false;
+
+	std::size_t frame = this->recording.getFrameIndex();
+	if ( this->depth_cloud.use_count() > 1 ) this->depth_cloud = std::make_shared<DepthCloud>();
+	if ( this->recording.read(*this->depth_cloud) == false ) return false;
+
+	if ( this->infrared_in.isOpen() && this->infrared_in.hasNext() ) {
+		if ( this->infrared_image.use_count() > 1 ) this->infrared_image = std::make_shared<IntensityImage<uint16_t>>();
+		this->infrared_image->deserialize(this->infrared_in);
+	}
+
+	this->current_frame = frame;
+	return true;
+}
+
+/* Sleeps until the frame with the given timestamp (microseconds) is due,
+ * relative to the first frame played. Timestamps that run backwards (e.g.
+ * concatenated recordings) re-anchor the playback clock.
+ */
+bool ReplayCamera::pace(std::size_t stamp) {
+	auto now = std::chrono::steady_clock::now();
+
+	if ( this->bAnchored == false || stamp < this->last_stamp ) {
+		this->anchor_stamp = stamp;
+		this->anchor_time = now;
+		this->bAnchored = true;
+	}
+
+	this->last_stamp = stamp;
+	if ( this->mode == REPLAY_FAST ) return true;
+
+	auto due = this->anchor_time + std::chrono::microseconds(stamp - this->anchor_stamp);
+	if ( due > now ) std::this_thread::sleep_until(due);
+	return true;
+}
+
+bool ReplayCamera::update() {
+	if ( this->bConnected == false ) return false;
+	if ( this->bFinished ) return false;
+
+	if ( this->readFrame() == false ) {
+		if ( this->bLoop == false || this->recording.getFrameCount() == 0 ) {
+			this->bFinished = true;
+			return false;
+		}
+
+		if ( this->rewind() == false ) return false;
+		if ( this->readFrame() == false ) {
+			this->bFinished = true;
+			return false;
+		}
+	}
+
+	this->pace(this->depth_cloud->getTimestamp());
+	this->frame_index++;
+	this->delivered_frames++;
+	return true;
+}
+
+std::string ReplayCamera::toString() const {
+	std::stringstream stream;
+	stream << "Replay: " << this->depth_filename << std::endl;
+	if ( this->infrared_filename.length() != 0 ) stream << "Infrared: " << this->infrared_filename << std::endl;
+	stream << "Mode: " << (this->mode == REPLAY_REALTIME ? "real-time" : "fast") << std::endl;
+	stream << "Frame: " << this->frame_index << " / " << this->recording.getFrameCount() << std::endl;
+	return stream.str();
+}
+
+bool ReplayCamera::setMode(ReplayMode mode) {
+	this->mode = mode;
+	this->bAnchored = false;
+	return true;
+}
+
+ReplayMode ReplayCamera::getMode() const {
+	return this->mode;
+}
+
+bool ReplayCamera::setLoop(bool bLoop) {
+	this->bLoop = bLoop;
+	return true;
+}
+
+bool ReplayCamera::isLooping() const {
+	return this->bLoop;
+}
+
+bool ReplayCamera::isFinished() const {
+	return this->bFinished;
+}
+
+std::size_t ReplayCamera::getFrameIndex() const {
+	return this->frame_index;
+}
+
+std::size_t ReplayCamera::getCurrentFrame() const {
+	return this->current_frame;
+}
+
+std::size_t ReplayCamera::getFrameCount() const {
+	return this->recording.getFrameCount();
+}
+
+std::size_t ReplayCamera::getInfraredWidth() const {
+	if ( this->infrared_image == nullptr ) return 0;
+	return this->infrared_image->width();
+}
+
+std::size_t ReplayCamera::getInfraredHeight() const {
+	if ( this->infrared_image == nullptr ) return 0;
+	return this->infrared_image->height();
+}
+
+std::size_t ReplayCamera::getCloudWidth() const {
+	if ( this->depth_cloud == nullptr ) return 0;
+	return this->depth_cloud->width();
+}
+
+std::size_t ReplayCamera::getCloudHeight() const {
+	if ( this->depth_cloud == nullptr ) return 0;
+	return this->depth_cloud->height();
+}
+
+double ReplayCamera::getFrameRate() const {
+	if ( this->delivered_frames == 0 ) return 0.0;
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - this->start_time;
+	if ( elapsed.count() <= 0.0 ) return 0.0;
+	return double(this->delivered_frames) / elapsed.count();
+}
+
+std::shared_ptr<IntensityImage<uint16_t>> ReplayCamera::getInfraredImage() const {
+	return this->infrared_image;
+}
+
+std::shared_ptr<DepthCloud> ReplayCamera::getDepthCloud() const {
+	return this->depth_cloud;
+}
+
+}
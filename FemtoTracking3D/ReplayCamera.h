@@ -0,0 +1,101 @@
+#pragma once
+
+#include <memory>
+#include <chrono>
+#include "PhysicalCamera.h"
+#include "IntensityImage.h"
+#include "DepthCloud.h"
+#include "RecordingReader.h"
+
+namespace px {
+
+/* REPLAY_REALTIME paces frames by their recorded timestamps (update() sleeps
+ * until the frame is due). REPLAY_FAST delivers frames as fast as they can be
+ * read and decoded, for throughput measurements.
+ */
+enum ReplayMode {
+	REPLAY_REALTIME,
+	REPLAY_FAST
+};
+
+/* Hardware-free camera that plays back recorded streams. The depth stream is
+ * an indexed recording (RecordingWriter) or a legacy file of
+ * DepthCloud::serialize frames (written with the given serialize type). The
+ * optional infrared stream is a file of DataFrame::serialize frames, read in
+ * lockstep with the depth frames. The frame buffers are reused across
+ * frames, playback does not allocate per frame.
+ *
+ * Bodies recorded with the depth frames are replayed by a JointTrackReplay
+ * next to the camera (kept out of this class so depth replay builds without
+ * the body tracking SDK), using getCurrentFrame().
+ */
+class ReplayCamera : public PhysicalCamera {
+public:
+	ReplayCamera(const std::string& depth_filename, const std::string& infrared_filename = "", SerializeType type = SERIALIZE_COMPRESSED);
+	virtual ~ReplayCamera();
+
+	bool connect();
+	bool update();
+	bool disconnect();
+	bool isConnected() const;
+	bool rewind();
+
+	/* Positions playback so the next update() delivers the given frame (or
+	 * the first frame at or after the given timestamp).
+	 */
+	bool seekFrame(std::size_t frame);
+	bool seekTimestamp(uint64_t timestamp);
+	std::string toString() const;
+
+	bool setMode(ReplayMode mode);
+	ReplayMode getMode() const;
+	bool setLoop(bool bLoop);
+	bool isLooping() const;
+	bool isFinished() const;
+
+	std::size_t getFrameIndex() const;
+
+	/* Recording index of the frame delivered by the last update(). */
+	std::size_t getCurrentFrame() const;
+	std::size_t getFrameCount() const;
+	std::size_t getInfraredWidth() const;
+	std::size_t getInfraredHeight() const;
+	std::size_t getCloudWidth() const;
+	std::size_t getCloudHeight() const;
+
+	/* Frames delivered per second of wall time since connect/seek. */
+	double getFrameRate() const;
+
+	std::shared_ptr<IntensityImage<uint16_t>> getInfraredImage() const;
+	std::shared_ptr<DepthCloud> getDepthCloud() const;
+
+protected:
+	bool readFrame();
+	bool pace(std::size_t stamp);
+	bool seekInfrared(std::size_t frame);
+
+	std::string depth_filename;
+	std::string infrared_filename;
+	SerializeType serialize_type;
+	RecordingReader recording;
+	BinaryFileReader infrared_in;
+
+	std::shared_ptr<IntensityImage<uint16_t>> infrared_image;
+	std::shared_ptr<DepthCloud> depth_cloud;
+
+	ReplayMode mode;
+	bool bConnected;
+	bool bLoop;
+	bool bFinished;
+	std::size_t frame_index;
+	std::size_t current_frame;
+	std::size_t delivered_frames;
+
+	bool bAnchored;
+	std::size_t anchor_stamp;
+	std::size_t last_stamp;
+	std::chrono::steady_clock::time_point anchor_time;
+	std::chrono::steady_clock::time_point start_time;
+};
+
+}
@@ -1,25 +1,30 @@
-
-#ifndef PX_SERIALIZABLE_H
-#define PX_SERIALIZABLE_H
-
-#include "Interface.h"
-#include "BinaryFileReader.h"
-#include "BinaryFileWriter.h"
-
-namespace px {
-
-enum SerializeType {
-	SERIALIZE_DEFAULT,
-	SERIALIZE_RAW,
-	SERIALIZE_COMPRESSED
-};
-
-class Serializable : public Interface {
-public:
-	virtual bool serialize(BinaryFileWriter& out, SerializeType type = SERIALIZE_DEFAULT) = 0;
-	virtual bool deserialize(BinaryFileReader& in, SerializeType type = SERIALIZE_DEFAULT) = 0;
-};
-
-}
-
-#endif
+
+#ifndef PX_SERIALIZABLE_H
+#define PX_SERIALIZABLE_H
+
+#include "Interface.h"
+#include "BinaryFileReader.h"
+#include "BinaryFileWriter.h"
+
+namespace px {
+
+/* SERIALIZE_DEPTH stores the native 16-bit depth of each sample (2 bytes
+ * per point); points are rebuilt on load from a RayTable. The depth is kept
+ * exactly, x and y only for clouds that follow the pinhole rays of that table.
+ */
+enum SerializeType {
+	SERIALIZE_DEFAULT,
+	SERIALIZE_RAW,
+	SERIALIZE_COMPRESSED,
+	SERIALIZE_DEPTH
+};
+
+class Serializable : public Interface {
+public:
+	virtual bool serialize(BinaryFileWriter& out, SerializeType type = SERIALIZE_DEFAULT) = 0;
+	virtual bool deserialize(BinaryFileReader& in, SerializeType type = SERIALIZE_DEFAULT) = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,133 @@
+#ifndef PX_SPAN_H
+#define PX_SPAN_H
+
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+
+namespace px {
+
+/* Non-owning view of a contiguous array (a C++17 stand-in for std::span).
+ * Used for bulk reads and writes of trivially copyable element arrays.
+ */
+template <typename T>
+class Span {
+public:
+	Span();
+	Span(T* data, std::size_t size);
+	template <typename U, typename = typename std::enable_if<std::is_convertible<U(*)[], T(*)[]>::value>::type>
+	Span(const Span<U>& span);
+	template <typename U, typename A>
+	Span(std::vector<U, A>& vector);
+	template <typename U, typename A>
+	Span(const std::vector<U, A>& vector);
+
+	T* data() const;
+	std::size_t size() const;
+	std::size_t bytes() const;
+	bool empty() const;
+
+	T& operator [] (std::size_t index) const;
+	T* begin() const;
+	T* end() const;
+
+	Span<T> subspan(std::size_t offset, std::size_t count) const;
+
+protected:
+	T* pointer;
+	std::size_t count;
+};
+
+template <typename T>
+Span<T> MakeSpan(T* data, std::size_t size) {
+	return Span<T>(data, size);
+}
+
+/* True for Span types (keeps spans out of the scalar write overloads). */
+template <typename T>
+struct IsSpan : std::false_type {};
+
+template <typename T>
+struct IsSpan<Span<T> > : std::true_type {};
+
+//------------------------------------------------------------------------------
+// Implementation
+//------------------------------------------------------------------------------
+template <typename T>
+Span<T>::Span() {
+	this->pointer = nullptr;
+	this->count = 0;
+}
+
+template <typename T>
+Span<T>::Span(T* data, std::size_t size) {
+	this->pointer = data;
+	this->count = size;
+}
+
+template <typename T>
+template <typename U, typename>
+Span<T>::Span(const Span<U>& span) {
+	this->pointer = span.data();
+	this->count = span.size();
+}
+
+template <typename T>
+template <typename U, typename A>
+Span<T>::Span(std::vector<U, A>& vector) {
+	this->pointer = vector.data();
+	this->count = vector.size();
+}
+
+template <typename T>
+template <typename U, typename A>
+Span<T>::Span(const std::vector<U, A>& vector) {
+	this->pointer = vector.data();
+	this->count = vector.size();
+}
+
+template <typename T>
+T* Span<T>::data() const {
+	return this->pointer;
+}
+
+template <typename T>
+std::size_t Span<T>::size() const {
+	return this->count;
+}
+
+template <typename T>
+std::size_t Span<T>::bytes() const {
+	return this->count * sizeof(T);
+}
+
+template <typename T>
+bool Span<T>::empty() const {
+	return this->count == 0;
+}
+
+template <typename T>
+T& Span<T>::operator [] (std::size_t index) const {
+	return this->pointer[index];
+}
+
+template <typename T>
+T* Span<T>::begin() const {
+	return this->pointer;
+}
+
+template <typename T>
+T* Span<T>::end() const {
+	return this->pointer + this->count;
+}
+
+template <typename T>
+Span<T> Span<T>::subspan(std::size_t offset, std::size_t count) const {
+	if ( offset > this->count ) return Span<T>();
+	if ( count > this->count - offset ) count = this->count - offset;
+	return Span<T>(this->pointer + offset, count);
+}
+
+}
+
+#endif
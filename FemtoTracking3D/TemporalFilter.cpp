@@ -0,0 +1,216 @@
+#include "TemporalFilter.h"
+#include "TileExecutor.h"
+#include <limits>
+#include <algorithm>
+
+namespace px {
+
+const static std::size_t TEMPORAL_FILTER_TILE_SIZE = 16384;
+const static uint8_t TEMPORAL_FILTER_MAX_COUNT = std::numeric_limits<uint8_t>::max();
+
+/* Running variance limit in multiples of the model variance. Accepted
+ * samples of a surface moving steadily in depth feed the variance with
+ * their lag, which would otherwise widen the change threshold until the
+ * motion is never detected.
+ */
+const static float TEMPORAL_FILTER_VARIANCE_CAP = 2.0f;
+
+TemporalFilterOptions::TemporalFilterOptions() {
+	this->alpha = Real(0.1);
+	this->noise_base = Real(2);
+	this->noise_scale = Real(0.002);
+	this->change_sigmas = Real(3);
+}
+
+bool TemporalFilterOptions::isValid() const {
+	if ( (this->alpha > Real(0) && this->alpha <= Real(1)) == false ) return false;
+	if ( (this->noise_base >= Real(0)) == false ) return false;
+	if ( (this->noise_scale >= Real(0)) == false ) return false;
+	if ( this->noise_base == Real(0) && this->noise_scale == Real(0) ) return false;
+	if ( (this->change_sigmas > Real(0)) == false ) return false;
+	return true;
+}
+
+TemporalFilter::TemporalFilter() {
+	this->w = 0;
+	this->h = 0;
+	this->frames = 0;
+	this->changed = 0;
+	this->setOptions(TemporalFilterOptions());
+}
+
+TemporalFilter::TemporalFilter(const TemporalFilterOptions& options) {
+	this->w = 0;
+	this->h = 0;
+	this->frames = 0;
+	this->changed = 0;
+	if ( this->setOptions(options) == false ) this->setOptions(TemporalFilterOptions());
+}
+
+TemporalFilter::~TemporalFilter() {}
+
+bool TemporalFilter::setOptions(const TemporalFilterOptions& options) {
+	if ( options.isValid() == false ) {
+		std::cerr << "[TemporalFilter:setOptions] Error: Invalid filter options." << std::endl;
+		return false;
+	}
+
+	this->options = options;
+	this->weights.resize(std::size_t(TEMPORAL_FILTER_MAX_COUNT) + 1);
+	for ( std::size_t i = 0; i < this->weights.size(); i++ ) {
+		float weight = 1.0f / static_cast<float>(i + 1);
+		this->weights[i] = weight > static_cast<float>(options.alpha) ? weight : static_cast<float>(options.alpha);
+	}
+
+	return true;
+}
+
+const TemporalFilterOptions& TemporalFilter::getOptions() const {
+	return this->options;
+}
+
+bool TemporalFilter::update(const OrganizedCloud<PointXYZ<Real> >& input, OrganizedCloud<PointXYZ<Real> >& output, IntensityImage<uint8_t>& change_mask) {
+	const PointXYZ<Real>* points = input.constData();
+	if ( points == nullptr || input.width() == 0 || input.height() == 0 ) {
+		std::cerr << "[TemporalFilter:update] Error: Empty input cloud." << std::endl;
+		return false;
+	}
+
+	const std::size_t n = input.width() * input.height();
+	if ( input.width() != this->w || input.height() != this->h ) {
+		if ( this->allocate(input.width(), input.height()) == false ) return false;
+	}
+
+	if ( &output != &input && (output.width() != this->w || output.height() != this->h || output.constData() == nullptr) ) {
+		if ( output.resize(this->w, this->h) == false ) return false;
+	}
+
+	if ( change_mask.width() != this->w || change_mask.height() != this->h || change_mask.constData() == nullptr ) {
+		if ( change_mask.resize(this->w, this->h) == false ) return false;
+	}
+
+	const float k2 = static_cast<float>(this->options.change_sigmas * this->options.change_sigmas);
+	const float noise_base = static_cast<float>(this->options.noise_base);
+	const float noise_scale = static_cast<float>(this->options.noise_scale);
+	const float* weights = this->weights.data();
+
+	PointXYZ<Real>* result = output.getData();
+	uint8_t* mask = change_mask.getData();
+	float* mean = this->mean.data();
+	float* variance = this->variance.data();
+	uint8_t* count = this->count.data();
+
+	this->tile_changed.assign(TileExecutor::GetTileCount(n, TEMPORAL_FILTER_TILE_SIZE), 0);
+	TileExecutor::Get().run(n, TEMPORAL_FILTER_TILE_SIZE, [&](std::size_t tile, std::size_t begin, std::size_t end) {
+		std::size_t changes = 0;
+		for ( std::size_t i = begin; i < end; i++ ) {
+			const PointXYZ<Real> p = points[i];
+			const float z = static_cast<float>(p.z);
+			const uint8_t stable = count[i];
+
+			// No return: a change if the pixel had statistics.
+			if ( (z > 0.0f) == false ) {
+				result[i] = p;
+				mask[i] = stable > 0 ? TEMPORAL_CHANGED : TEMPORAL_UNCHANGED;
+				changes += stable > 0 ? 1 : 0;
+				mean[i] = 0.0f;
+				variance[i] = 0.0f;
+				count[i] = 0;
+				continue;
+			}
+
+			const float sigma = noise_base + noise_scale * z;
+			const float model = sigma * sigma;
+			const float d = z - mean[i];
+			const float deviation = variance[i] > model ? variance[i] : model;
+
+			// New pixel or motion: restart from the sample.
+			if ( stable == 0 || d * d > k2 * deviation ) {
+				result[i] = p;
+				mask[i] = TEMPORAL_CHANGED;
+				changes++;
+				mean[i] = z;
+				variance[i] = model;
+				count[i] = 1;
+				continue;
+			}
+
+			const float a = weights[stable];
+			const float m = mean[i] + a * d;
+			const float v = (1.0f - a) * (variance[i] + a * d * d);
+			variance[i] = v < TEMPORAL_FILTER_VARIANCE_CAP * model ? v : TEMPORAL_FILTER_VARIANCE_CAP * model;
+			mean[i] = m;
+			count[i] = stable < TEMPORAL_FILTER_MAX_COUNT ? stable + 1 : stable;
+
+			// Moves the point along its viewing ray to the running mean.
+			const Real s = static_cast<Real>(m / z);
+			result[i].x = p.x * s;
+			result[i].y = p.y * s;
+			result[i].z = static_cast<Real>(m);
+			mask[i] = TEMPORAL_UNCHANGED;
+		}
+		this->tile_changed[tile] = changes;
+	});
+
+	this->changed = 0;
+	for ( std::size_t i = 0; i < this->tile_changed.size(); i++ )
+		this->changed += this->tile_changed[i];
+
+	this->frames++;
+	output.setTimestamp(input.getTimestamp());
+	change_mask.setTimestamp(input.getTimestamp());
+	return true;
+}
+
+bool TemporalFilter::reset() {
+	std::fill(this->mean.begin(), this->mean.end(), 0.0f);
+	std::fill(this->variance.begin(), this->variance.end(), 0.0f);
+	std::fill(this->count.begin(), this->count.end(), uint8_t(0));
+	this->frames = 0;
+	this->changed = 0;
+	return true;
+}
+
+Real TemporalFilter::getMean(std::size_t i, std::size_t j) const {
+	if ( i >= this->h || j >= this->w ) return Real(0);
+	return static_cast<Real>(this->mean[i * this->w + j]);
+}
+
+Real TemporalFilter::getVariance(std::size_t i, std::size_t j) const {
+	if ( i >= this->h || j >= this->w ) return Real(0);
+	return static_cast<Real>(this->variance[i * this->w + j]);
+}
+
+std::size_t TemporalFilter::getChangedCount() const {
+	return this->changed;
+}
+
+std::size_t TemporalFilter::getFrameCount() const {
+	return this->frames;
+}
+
+std::size_t TemporalFilter::width() const {
+	return this->w;
+}
+
+std::size_t TemporalFilter::height() const {
+	return this->h;
+}
+
+bool TemporalFilter::allocate(std::size_t width, std::size_t height) {
+	if ( width == 0 || height == 0 ) {
+		std::cerr << "[TemporalFilter:allocate] Error: Width or height = 0." << std::endl;
+		return false;
+	}
+
+	this->w = width;
+	this->h = height;
+	this->mean.assign(width * height, 0.0f);
+	this->variance.assign(width * height, 0.0f);
+	this->count.assign(width * height, uint8_t(0));
+	this->frames = 0;
+	this->changed = 0;
+	return true;
+}
+
+}
@@ -0,0 +1,107 @@
+#ifndef PX_TEMPORAL_FILTER_H
+#define PX_TEMPORAL_FILTER_H
+
+#include <vector>
+#include <cstdint>
+#include "OrganizedCloud.h"
+#include "IntensityImage.h"
+#include "Mathematics.h"
+
+namespace px {
+
+/* Change mask values of a TemporalFilter. */
+const static uint8_t TEMPORAL_UNCHANGED = 0;
+const static uint8_t TEMPORAL_CHANGED = 1;
+
+/* Settings of a TemporalFilter.
+ *
+ * alpha: weight of a new sample in the running mean once a pixel has been
+ *   stable for 1 / alpha frames (before that the mean is the plain average).
+ * noise_base, noise_scale: sensor noise model, the expected standard
+ *   deviation of a depth z is noise_base + noise_scale * z (cloud units,
+ *   millimetres for Femto clouds).
+ * change_sigmas: a sample further than change_sigmas deviations from the
+ *   running mean is a change. The deviation is the larger of the model and
+ *   the pixel's running deviation, which is capped at twice the model
+ *   variance: a surface moving in depth is flagged whenever the mean lags
+ *   it by more than the threshold (every few frames), it cannot widen its
+ *   own threshold.
+ */
+struct TemporalFilterOptions {
+	Real alpha;
+	Real noise_base;
+	Real noise_scale;
+	Real change_sigmas;
+
+	TemporalFilterOptions();
+	bool isValid() const;
+};
+
+/* Stateful per-pixel temporal denoiser for a stream of organized clouds of
+ * the same size.
+ *
+ * Every pixel keeps a running mean and variance of its depth (exponential
+ * moving average) and the number of frames it has been stable, stored as
+ * separate planes (9 bytes per pixel). Each update:
+ *   - a sample within the noise model of the mean updates the statistics
+ *     and the output point is moved along its viewing ray to the mean;
+ *   - a sample outside it (motion), a pixel appearing or disappearing
+ *     restarts the statistics from the sample and is flagged in the change
+ *     mask, the output point is the input point.
+ * Invalid pixels (z <= 0) stay invalid. Later stages can skip the pixels
+ * whose mask is TEMPORAL_UNCHANGED.
+ *
+ * A frame of another size resets the filter. Pixels are processed in tiles
+ * on the shared TileExecutor, input and output may be the same cloud.
+ */
+class TemporalFilter {
+public:
+	TemporalFilter();
+	TemporalFilter(const TemporalFilterOptions& options);
+	virtual ~TemporalFilter();
+
+	bool setOptions(const TemporalFilterOptions& options);
+	const TemporalFilterOptions& getOptions() const;
+
+	/* Filters the next frame, the change mask is resized to the frame. */
+	bool update(const OrganizedCloud<PointXYZ<Real> >& input, OrganizedCloud<PointXYZ<Real> >& output, IntensityImage<uint8_t>& change_mask);
+
+	/* Forgets the statistics, the next frame is all changes. */
+	bool reset();
+
+	/* Running statistics of pixel (i, j) (row, column); variance is 0 for
+	 * pixels without statistics.
+	 */
+	Real getMean(std::size_t i, std::size_t j) const;
+	Real getVariance(std::size_t i, std::size_t j) const;
+
+	std::size_t getChangedCount() const;
+	std::size_t getFrameCount() const;
+	std::size_t width() const;
+	std::size_t height() const;
+
+protected:
+	TemporalFilter(const TemporalFilter&) = delete;
+	TemporalFilter& operator = (const TemporalFilter&) = delete;
+
+	bool allocate(std::size_t width, std::size_t height);
+
+	TemporalFilterOptions options;
+	std::size_t w, h;
+	std::size_t frames;
+	std::size_t changed;
+
+	// Per-pixel statistics, one plane each. count is the number of stable
+	// frames (saturating), 0 for pixels without statistics.
+	std::vector<float> mean;
+	std::vector<float> variance;
+	std::vector<uint8_t> count;
+	std::vector<std::size_t> tile_changed;
+
+	// Mean update weight by stable frame count, max(1 / (count + 1), alpha).
+	std::vector<float> weights;
+};
+
+}
+
+#endif
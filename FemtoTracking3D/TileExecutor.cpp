@@ -0,0 +1,114 @@
+#include "TileExecutor.h"
+#include <algorithm>
+
+namespace px {
+
+TileExecutor::TileExecutor(std::size_t thread_count) : run_owner(std::thread::id()), next_tile(0) {
+	this->generation = 0;
+	this->active = 0;
+	this->bStop = false;
+	this->task = nullptr;
+	this->count = 0;
+	this->tile_size = 0;
+	this->tile_count = 0;
+
+	if ( thread_count == 0 ) thread_count = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+	for ( std::size_t i = 1; i < thread_count; i++ )
+		this->workers.push_back(std::thread(&TileExecutor::workLoop, this));
+}
+
+TileExecutor::~TileExecutor() {
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->bStop = true;
+	}
+	this->start_condition.notify_all();
+
+	for ( std::size_t i = 0; i < this->workers.size(); i++ )
+		this->workers[i].join();
+}
+
+bool TileExecutor::run(std::size_t count, std::size_t tile_size, const TileTask& task) {
+	if ( count == 0 ) return true;
+	if ( tile_size == 0 ) tile_size = count;
+	std::size_t tile_count = GetTileCount(count, tile_size);
+
+	// Single tiles, no workers, a run from within a task of this thread's
+	// range or a busy executor: run on the caller.
+	bool bNested = this->run_owner.load() == std::this_thread::get_id();
+	if ( tile_count == 1 || this->workers.size() == 0 || bNested || this->run_mutex.try_lock() == false ) {
+		for ( std::size_t tile = 0; tile < tile_count; tile++ )
+			task(tile, tile * tile_size, std::min((tile + 1) * tile_size, count));
+		return true;
+	}
+
+	this->run_owner.store(std::this_thread::get_id());
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->task = &task;
+		this->count = count;
+		this->tile_size = tile_size;
+		this->tile_count = tile_count;
+		this->next_tile.store(0);
+		this->active = this->workers.size();
+		this->generation++;
+	}
+	this->start_condition.notify_all();
+
+	this->work();
+
+	{
+		std::unique_lock<std::mutex> lock(this->mutex);
+		this->done_condition.wait(lock, [this] { return this->active == 0; });
+		this->task = nullptr;
+	}
+
+	this->run_owner.store(std::thread::id());
+	this->run_mutex.unlock();
+	return true;
+}
+
+void TileExecutor::work() {
+	while ( true ) {
+		std::size_t tile = this->next_tile.fetch_add(1);
+		if ( tile >= this->tile_count ) return;
+		(*this->task)(tile, tile * this->tile_size, std::min((tile + 1) * this->tile_size, this->count));
+	}
+}
+
+void TileExecutor::workLoop() {
+	uint64_t seen = 0;
+	while ( true ) {
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->start_condition.wait(lock, [&] { return this->bStop || this->generation != seen; });
+			if ( this->bStop ) return;
+			seen = this->generation;
+		}
+
+		this->work();
+
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if ( --this->active == 0 ) this->done_condition.notify_all();
+	}
+}
+
+std::size_t TileExecutor::getThreadCount() const {
+	return this->workers.size() + 1;
+}
+
+std::size_t TileExecutor::GetTileCount(std::size_t count, std::size_t tile_size) {
+	if ( count == 0 ) return 0;
+	if ( tile_size == 0 ) return 1;
+	return (count + tile_size - 1) / tile_size;
+}
+
+TileExecutor& TileExecutor::Get() {
+	// Intentionally never destroyed, like the frame pools: images with static
+	// storage duration may still run operations during shutdown.
+	static TileExecutor* executor = new TileExecutor();
+	return *executor;
+}
+
+}
@@ -0,0 +1,73 @@
+#ifndef PX_TILE_EXECUTOR_H
+#define PX_TILE_EXECUTOR_H
+
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <condition_variable>
+
+namespace px {
+
+/* Runs a task over the tiles of a range [0, count) on a fixed set of worker
+ * threads, for per-frame image operations that are too short to start
+ * threads for. Tiles are claimed dynamically, the calling thread works on
+ * tiles too and run() returns when every tile is done.
+ *
+ * One range runs at a time: a run() while another one is in progress (from
+ * another thread, or from within a task) runs its tiles on the calling
+ * thread instead of waiting. Tasks get the tile number, so reductions can
+ * write a partial result per tile and combine them after run().
+ */
+class TileExecutor {
+public:
+	typedef std::function<void(std::size_t tile, std::size_t begin, std::size_t end)> TileTask;
+
+	/* thread_count: threads working on a range including the caller
+	 * (0 = one per core, 1 = everything runs on the caller).
+	 */
+	TileExecutor(std::size_t thread_count = 0);
+	~TileExecutor();
+
+	bool run(std::size_t count, std::size_t tile_size, const TileTask& task);
+
+	std::size_t getThreadCount() const;
+	static std::size_t GetTileCount(std::size_t count, std::size_t tile_size);
+
+	/* Executor shared by the image operations, one thread per core. */
+	static TileExecutor& Get();
+
+protected:
+	TileExecutor(const TileExecutor&) = delete;
+	TileExecutor& operator = (const TileExecutor&) = delete;
+
+	void workLoop();
+	void work();
+
+	std::vector<std::thread> workers;
+	std::mutex run_mutex;
+
+	// Thread holding run_mutex: a run() from within its own tasks must not
+	// try_lock the mutex it already owns.
+	std::atomic<std::thread::id> run_owner;
+
+	std::mutex mutex;
+	std::condition_variable start_condition;
+	std::condition_variable done_condition;
+	uint64_t generation;
+	std::size_t active;
+	bool bStop;
+
+	// Current range, written before the generation is advanced.
+	const TileTask* task;
+	std::size_t count;
+	std::size_t tile_size;
+	std::size_t tile_count;
+	std::atomic<std::size_t> next_tile;
+};
+
+}
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef PX_TRIPLE_BUFFER_H
+#define PX_TRIPLE_BUFFER_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace px {
+
+/* Lock-free single-producer / single-consumer triple buffer.
+ *
+ * The producer always owns one slot (back) and the consumer always owns one
+ * slot (front). The third slot (middle) holds the most recently published
+ * value. Publishing and consuming are a single atomic exchange of the middle
+ * index, so neither side ever blocks or waits on the other, and the consumer
+ * always observes the latest complete value (intermediate values may be
+ * skipped when the producer is faster than the consumer).
+ *
+ * Usage:
+ * Producer: fill buffer.back(), then buffer.publish().
+ * Consumer: buffer.update(), then read buffer.front().
+ */
+template <typename T>
+class TripleBuffer {
+public:
+	TripleBuffer();
+
+	/* Producer side. */
+	T& back();
+	bool publish();
+
+	/* Consumer side. Swaps in the latest published slot, if any, and returns
+	 * true when the front slot changed.
+	 */
+	bool update();
+	bool hasUpdate() const;
+	T& front();
+	const T& front() const;
+
+	/* Direct slot access for (re)initialization while neither side is active. */
+	T& slot(std::size_t index);
+	static std::size_t SlotCount();
+
+protected:
+	TripleBuffer(const TripleBuffer<T>&) = delete;
+	TripleBuffer<T>& operator = (const TripleBuffer<T>&) = delete;
+
+	const static uint8_t INDEX_MASK = 0x3;
+	const static uint8_t DIRTY_BIT = 0x4;
+
+	T slots[3];
+	std::atomic<uint8_t> middle_index;
+	uint8_t front_index;
+	uint8_t back_index;
+};
+
+//------------------------------------------------------------------------------
+// Implementation
+//------------------------------------------------------------------------------
+template <typename T>
+TripleBuffer<T>::TripleBuffer() {
+	this->front_index = 0;
+	this->middle_index = 1;
+	this->back_index = 2;
+}
+
+template <typename T>
+T& TripleBuffer<T>::back() {
+	return this->slots[this->back_index];
+}
+
+template <typename T>
+bool TripleBuffer<T>::publish() {
+	uint8_t previous = this->middle_index.exchange(this->back_index | DIRTY_BIT, std::memory_order_acq_rel);
+	this->back_index = previous & INDEX_MASK;
+	return true;
+}
+
+template <typename T>
+bool TripleBuffer<T>::update() {
+	if ( (this->middle_index.load(std::memory_order_relaxed) & DIRTY_BIT) == 0 ) return false;
+	uint8_t previous = this->middle_index.exchange(this->front_index, std::memory_order_acq_rel);
+	this->front_index = previous & INDEX_MASK;
+	return true;
+}
+
+template <typename T>
+bool TripleBuffer<T>::hasUpdate() const {
+	return (this->middle_index.load(std::memory_order_relaxed) & DIRTY_BIT) != 0;
+}
+
+template <typename T>
+T& TripleBuffer<T>::front() {
+	return this->slots[this->front_index];
+}
+
+template <typename T>
+const T& TripleBuffer<T>::front() const {
+	return this->slots[this->front_index];
+}
+
+template <typename T>
+T& TripleBuffer<T>::slot(std::size_t index) {
+	return this->slots[index % 3];
+}
+
+template <typename T>
+std::size_t TripleBuffer<T>::SlotCount() {
+	return 3;
+}
+
+}
+
+#endif
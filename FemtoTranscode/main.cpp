@@ -0,0 +1,129 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <chrono>
+
+/* Recording */
+#include <RecordingTranscoder.h>
+
+using namespace px;
+
+void usage() {
+	std::cout << "Usage: FemtoTranscode [options] <input> <output>" << std::endl;
+	std::cout << "       FemtoTranscode [options] --dir <input directory> <output directory>" << std::endl;
+	std::cout << std::endl;
+	std::cout << "  --type raw|compressed|depth   output serialize type (default: as input)" << std::endl;
+	std::cout << "  --legacy raw|compressed|depth serialize type of headerless inputs (default: compressed)" << std::endl;
+	std::cout << "  --keyframes <n>               delta code the output, a keyframe every n frames" << std::endl;
+	std::cout << "  --unchunked                   write frames without checksummed chunks" << std::endl;
+	std::cout << "  --roi <x> <y> <w> <h>         crop every frame" << std::endl;
+	std::cout << "  --first <n> --count <n>       frame range (default: all frames)" << std::endl;
+	std::cout << "  --step <n>                    keep every n-th frame" << std::endl;
+	std::cout << "  --threads <n>                 worker threads per recording (default: one per core)" << std::endl;
+	std::cout << "  --queue <n>                   frames in flight per recording" << std::endl;
+	std::cout << "  --sessions <n>                recordings transcoded at once with --dir (default: 2)" << std::endl;
+	std::cout << "  --ext <.ext>                  only transcode files with this extension with --dir" << std::endl;
+}
+
+bool ParseType(const std::string& name, SerializeType& type) {
+	if ( name == "raw" ) type = SERIALIZE_RAW;
+	else if ( name == "compressed" ) type = SERIALIZE_COMPRESSED;
+	else if ( name == "depth" ) type = SERIALIZE_DEPTH;
+	else {
+		std::cerr << "[FemtoTranscode] Error: Unknown serialize type: " << name << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+bool ParseCount(const std::string& text, std::size_t& value) {
+	char* end = nullptr;
+	unsigned long long number = std::strtoull(text.c_str(), &end, 10);
+	if ( text.length() == 0 || end == nullptr || *end != '\0' ) {
+		std::cerr << "[FemtoTranscode] Error: Not a number: " << text << std::endl;
+		return false;
+	}
+
+	value = static_cast<std::size_t>(number);
+	return true;
+}
+
+int main(int argc, char** argv) {
+	TranscodeOptions options;
+	std::vector<std::string> paths;
+	std::size_t session_count = 2;
+	std::string extension;
+	bool bDirectory = false;
+
+	for ( int i = 1; i < argc; i++ ) {
+		std::string arg = argv[i];
+		int remaining = argc - i - 1;
+		bool bValid = true;
+
+		if ( arg == "--help" || arg == "-h" ) {
+			usage();
+			return 0;
+		}
+		else if ( arg == "--dir" ) bDirectory = true;
+		else if ( arg == "--unchunked" ) options.bChunked = false;
+		else if ( arg == "--type" && remaining >= 1 ) bValid = ParseType(argv[++i], options.type);
+		else if ( arg == "--legacy" && remaining >= 1 ) bValid = ParseType(argv[++i], options.legacy_type);
+		else if ( arg == "--keyframes" && remaining >= 1 ) bValid = ParseCount(argv[++i], options.keyframe_interval);
+		else if ( arg == "--first" && remaining >= 1 ) bValid = ParseCount(argv[++i], options.first_frame);
+		else if ( arg == "--count" && remaining >= 1 ) bValid = ParseCount(argv[++i], options.frame_count);
+		else if ( arg == "--step" && remaining >= 1 ) bValid = ParseCount(argv[++i], options.frame_step);
+		else if ( arg == "--threads" && remaining >= 1 ) bValid = ParseCount(argv[++i], options.thread_count);
+		else if ( arg == "--queue" && remaining >= 1 ) bValid = ParseCount(argv[++i], options.queue_depth);
+		else if ( arg == "--sessions" && remaining >= 1 ) bValid = ParseCount(argv[++i], session_count);
+		else if ( arg == "--ext" && remaining >= 1 ) extension = argv[++i];
+		else if ( arg == "--roi" && remaining >= 4 ) {
+			bValid = ParseCount(argv[i + 1], options.roi_x) && ParseCount(argv[i + 2], options.roi_y) &&
+				ParseCount(argv[i + 3], options.roi_width) && ParseCount(argv[i + 4], options.roi_height);
+			i += 4;
+		}
+		else if ( arg.length() > 1 && arg[0] == '-' ) {
+			std::cerr << "[FemtoTranscode] Error: Unknown or incomplete option: " << arg << std::endl;
+			bValid = false;
+		}
+		else paths.push_back(arg);
+
+		if ( bValid == false ) return 1;
+	}
+
+	if ( paths.size() != 2 ) {
+		usage();
+		return 1;
+	}
+
+	if ( bDirectory ) {
+		std::vector<TranscodeReport> reports;
+		auto start = std::chrono::steady_clock::now();
+		bool bResult = TranscodeDirectory(paths[0], paths[1], options, reports, session_count, extension);
+
+		TranscodeReport total;
+		total.input = paths[0];
+		total.output = paths[1];
+		total.bSuccess = bResult;
+		for ( std::size_t i = 0; i < reports.size(); i++ ) {
+			total.frames_read += reports[i].frames_read;
+			total.frames_written += reports[i].frames_written;
+			total.frames_failed += reports[i].frames_failed;
+			total.bytes_read += reports[i].bytes_read;
+			total.bytes_written += reports[i].bytes_written;
+		}
+
+		// Sessions overlap, so the total rate is over the wall time, not the sum of the sessions.
+		total.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		std::cout << std::endl << reports.size() << " recordings" << std::endl << total.toString();
+		return bResult ? 0 : 1;
+	}
+
+	RecordingTranscoder transcoder(options);
+	TranscodeReport report;
+	bool bResult = transcoder.transcode(paths[0], paths[1], report);
+	std::cout << report.toString();
+	return bResult ? 0 : 1;
+}